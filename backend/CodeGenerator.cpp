@@ -25,13 +25,15 @@ CodeGenerator::CodeGenerator(Module * _module) : module(_module)
 {}
 
 /// @brief 代码产生器运行，结果保存到指定的文件中
-/// @param outFileName 输出内容所在文件
+/// @param outFileName 输出内容所在文件，为"-"时输出到标准输出
 /// @return true：成功，false：失败
 bool CodeGenerator::run(std::string outFileName)
 {
     // 打开文件，也可以以C++的方式打开文件进行操作
     // 这里主要便于C语言学习的学生
-    if (!outFileName.empty()) {
+    if (outFileName == "-") {
+        fp = stdout;
+    } else if (!outFileName.empty()) {
         // 指定文件非空时，则创建文件
         fp = fopen(outFileName.c_str(), "w");
         if (nullptr == fp) {
@@ -45,11 +47,14 @@ bool CodeGenerator::run(std::string outFileName)
     // 执行真正的代码
     const bool result = run();
 
-    // 关闭文件
-    if (fp) {
+    // 关闭文件，标准输出只刷新
+    if (fp == stdout) {
+        fflush(fp);
+    } else if (fp) {
         fclose(fp);
-        fp = nullptr;
     }
 
+    fp = nullptr;
+
     return result;
 }
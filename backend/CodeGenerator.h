@@ -15,11 +15,14 @@
 ///
 #pragma once
 
+#include <cstdint>
 #include <cstdio>
 #include <string>
 
 #include "Module.h"
 
+class FunctionCodeCache;
+
 /// @brief 代码生成的一般类
 class CodeGenerator {
 
@@ -32,7 +35,7 @@ public:
     virtual ~CodeGenerator() = default;
 
     /// @brief 代码产生器运行，结果保存到指定的文件中
-    /// @param outFileName 输出内容所在文件
+    /// @param outFileName 输出内容所在文件，为"-"时输出到标准输出
     /// @return true：成功，false：失败
     bool run(std::string outFileName);
 
@@ -45,6 +48,33 @@ public:
         this->showLinearIR = show;
     }
 
+    ///
+    /// @brief 设置按函数并行生成代码的线程数
+    /// @param _jobs 线程数，0表示取硬件的并发数，1表示不并行
+    ///
+    void setJobs(int32_t _jobs)
+    {
+        this->jobs = _jobs;
+    }
+
+    ///
+    /// @brief 设置优化级别，-O0时后端不做基于活跃变量的栈槽共享等优化
+    /// @param level 优化级别
+    ///
+    void setOptLevel(int32_t level)
+    {
+        this->optLevel = level;
+    }
+
+    ///
+    /// @brief 设置函数级增量编译的缓存：复用函数的汇编直接输出，新产生的函数汇编加入缓存
+    /// @param cache 缓存，为空时不使用
+    ///
+    void setFunctionCodeCache(FunctionCodeCache * cache)
+    {
+        this->codeCache = cache;
+    }
+
 protected:
     /// @brief 代码产生器运行，结果保存到指定的文件中
     /// @param fp 输出内容所在文件的指针
@@ -63,4 +93,19 @@ protected:
     /// @brief 显示IR指令内容
     ///
     bool showLinearIR = false;
+
+    ///
+    /// @brief 按函数并行生成代码的线程数，0表示取硬件的并发数
+    ///
+    int32_t jobs = 0;
+
+    ///
+    /// @brief 优化级别，0表示不优化
+    ///
+    int32_t optLevel = 0;
+
+    ///
+    /// @brief 函数级增量编译的缓存，为空时不使用
+    ///
+    FunctionCodeCache * codeCache = nullptr;
 };
@@ -17,41 +17,124 @@
 #include "CodeGeneratorAsm.h"
 #include "Module.h"
 #include "Function.h"
+#include "FunctionCodeCache.h"
+#include "IRConstant.h"
+#include "ThreadPool.h"
 
 /// @brief 构造函数
 CodeGeneratorAsm::CodeGeneratorAsm(Module * _module) : CodeGenerator(_module)
 {}
 
+/// @brief 并行生成代码前对函数的串行预处理
+/// @param func 要处理的函数
+void CodeGeneratorAsm::prepareCodeSection(Function * func)
+{
+    (void) func;
+}
+
 /// @brief .text代码段，主要存放CPU指令，以函数为单位
-void CodeGeneratorAsm::genCodeSection()
+/// @param out 输出缓冲区
+void CodeGeneratorAsm::genCodeSection(OutputBuffer & out)
 {
     // 重新设置为0
     labelIndex = 0;
 
-    // 遍历所有的函数，以函数为单位，产生指令
+    std::vector<Function *> funcs;
+
+    // 各函数的Label起始编号，最后一项为Label的总数
+    std::vector<int64_t> labelBases;
+
+    // 各函数输出的内容，复用缓存的函数在串行处理时取得
+    std::vector<std::string> outs;
+
+    // 串行处理：Label的名字必须是程序级别的唯一，按函数次序全局编号，保证输出与并行与否无关
     for (auto func: module->getFunctionList()) {
 
-        if (!func->isBuiltin()) {
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        labelBases.push_back(labelIndex);
+        outs.emplace_back();
+
+        if (func->isCodeReused()) {
+
+            // 复用缓存的汇编，Label按当前的起始编号重新编号
+            int64_t labelCount = 0;
+            codeCache->getCode(func->getName(), labelIndex, outs.back(), labelCount);
+            labelIndex += labelCount;
+
+        } else {
+
+            for (auto inst: func->getInterCode().getInsts()) {
+                if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+                    inst->setName(IR_LABEL_PREFIX + std::to_string(labelIndex++));
+                }
+            }
+
+            prepareCodeSection(func);
+        }
+
+        funcs.push_back(func);
+    }
+
+    labelBases.push_back(labelIndex);
 
-            // 针对func产生汇编指令
-            genCodeSection(func);
+    // 以函数为单位并行产生指令，每个函数输出到各自的内存缓冲区
+    {
+        ThreadPool pool(funcs.size() > 1 ? jobs : 1);
+
+        for (size_t k = 0; k < funcs.size(); ++k) {
+
+            if (funcs[k]->isCodeReused()) {
+                continue;
+            }
+
+            pool.submit([this, &funcs, &outs, k]() {
+                OutputBuffer out(outs[k]);
+                genCodeSection(funcs[k], out);
+            });
         }
+
+        pool.wait();
+    }
+
+    // 新产生的函数汇编加入缓存
+    if (codeCache) {
+        for (size_t k = 0; k < funcs.size(); ++k) {
+            if (!funcs[k]->isCodeReused()) {
+                codeCache->store(funcs[k]->getName(), outs[k], labelBases[k], labelBases[k + 1] - labelBases[k]);
+            }
+        }
+    }
+
+    // 按函数次序输出
+    for (auto & funcOut: outs) {
+        out.put(funcOut);
     }
 }
 
-/// @brief 产生汇编文件
-/// @param fp 要输出的文件
-/// @return true:成功，false:失败
-bool CodeGeneratorAsm::run()
+/// @brief 产生完整的汇编
+/// @param out 输出缓冲区
+void CodeGeneratorAsm::generate(OutputBuffer & out)
 {
     // 产生头
-    genHeader();
+    genHeader(out);
 
     // 产生数据段，含初始化和未初始化数据
-    genDataSection();
+    genDataSection(out);
 
     // 产生代码段，即CPU指令，以函数为单位
-    genCodeSection();
+    genCodeSection(out);
+}
+
+/// @brief 产生汇编文件，整个文件经由一个输出缓冲区写出
+/// @return true:成功，false:失败
+bool CodeGeneratorAsm::run()
+{
+    OutputBuffer out(fp);
+
+    generate(out);
 
     return true;
 }
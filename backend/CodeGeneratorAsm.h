@@ -15,16 +15,14 @@
 ///
 #include <cstdio>
 #include <cstring>
+#include <string>
 
 #include "CodeGenerator.h"
+#include "OutputBuffer.h"
 
 /// @brief 生成汇编的代码生成器共同类
 class CodeGeneratorAsm : public CodeGenerator {
 
-protected:
-    /// @brief .text代码段，主要存放CPU指令，以函数为单位
-    void genCodeSection(FILE * fp);
-
 public:
     /// @brief 构造函数
     CodeGeneratorAsm(Module * module);
@@ -32,15 +30,27 @@ public:
     /// @brief 析构函数
     ~CodeGeneratorAsm() override = default;
 
+    /// @brief 产生完整的汇编，各部分依次写入同一个输出缓冲区，可输出到文件或内存
+    /// @param out 输出缓冲区
+    void generate(OutputBuffer & out);
+
     /// @brief 产生汇编头部分
-    virtual void genHeader() = 0;
+    /// @param out 输出缓冲区
+    virtual void genHeader(OutputBuffer & out) = 0;
 
     /// @brief 全局变量Section，主要包含初始化的和未初始化过的
-    virtual void genDataSection() = 0;
+    /// @param out 输出缓冲区
+    virtual void genDataSection(OutputBuffer & out) = 0;
+
+    /// @brief 并行生成代码前对函数的串行预处理，如调整函数调用指令等会改动跨函数共享Value的工作
+    /// @param func 要处理的函数
+    virtual void prepareCodeSection(Function * func);
 
-    /// @brief 针对函数进行汇编指令生成，放到.text代码段中
+    /// @brief 针对函数进行汇编指令生成，放到.text代码段中。
+    /// 不同函数可能在多个线程中同时调用，只能改动本函数内的数据
     /// @param func 要处理的函数
-    virtual void genCodeSection(Function * func) = 0;
+    /// @param out 汇编指令写入该输出缓冲区
+    virtual void genCodeSection(Function * func, OutputBuffer & out) = 0;
 
     /// @brief 寄存器分配
     /// @param func 要处理的函数
@@ -52,7 +62,8 @@ protected:
     bool run() override;
 
     /// @brief 汇编指令生成，放到.text代码段中
-    void genCodeSection();
+    /// @param out 输出缓冲区
+    void genCodeSection(OutputBuffer & out);
 
     ///
     /// @brief Label索引编号，要求文件级别的编号，而不是函数级别的编号
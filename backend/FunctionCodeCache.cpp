@@ -0,0 +1,128 @@
+///
+/// @file FunctionCodeCache.cpp
+/// @brief 函数级增量编译时各函数汇编的缓存
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <cctype>
+#include <charconv>
+
+#include "FunctionCodeCache.h"
+#include "IRConstant.h"
+
+/// @brief 函数汇编条目的后缀
+static const char * FUNCTION_CODE_SUFFIX = ".fn.s";
+
+/// @brief 条目首行的前缀，其后为Label的个数
+static const std::string_view LABEL_COUNT_PREFIX = "labels ";
+
+FunctionCodeCache::FunctionCodeCache(CompileCache & _cache) : cache(_cache)
+{}
+
+void FunctionCodeCache::lookup(const std::unordered_map<std::string, std::string> & _fingerprints)
+{
+    fingerprints = _fingerprints;
+
+    for (auto & [name, key]: fingerprints) {
+
+        std::string text;
+        if (!cache.lookupText(key, FUNCTION_CODE_SUFFIX, text)) {
+            continue;
+        }
+
+        // 首行为Label的个数，格式不对时当作未命中
+        size_t lineEnd = text.find('\n');
+        if (lineEnd == std::string::npos || text.compare(0, LABEL_COUNT_PREFIX.size(), LABEL_COUNT_PREFIX) != 0) {
+            continue;
+        }
+
+        Entry entry;
+        auto result = std::from_chars(text.data() + LABEL_COUNT_PREFIX.size(), text.data() + lineEnd, entry.labelCount);
+        if (result.ec != std::errc() || entry.labelCount < 0) {
+            continue;
+        }
+
+        entry.code = text.substr(lineEnd + 1);
+
+        entries.emplace(name, std::move(entry));
+        reused.insert(name);
+    }
+}
+
+bool FunctionCodeCache::getCode(const std::string & name,
+                                int64_t labelBase,
+                                std::string & code,
+                                int64_t & labelCount) const
+{
+    auto iter = entries.find(name);
+    if (iter == entries.end()) {
+        return false;
+    }
+
+    code.clear();
+    code.reserve(iter->second.code.size());
+    rebaseLabels(iter->second.code, labelBase, code);
+
+    labelCount = iter->second.labelCount;
+
+    return true;
+}
+
+void FunctionCodeCache::store(const std::string & name, std::string_view code, int64_t labelBase, int64_t labelCount)
+{
+    auto iter = fingerprints.find(name);
+    if (iter == fingerprints.end()) {
+        return;
+    }
+
+    std::string text;
+    text.reserve(code.size() + 32);
+    text.append(LABEL_COUNT_PREFIX).append(std::to_string(labelCount)).append("\n");
+    rebaseLabels(code, -labelBase, text);
+
+    cache.storeText(iter->second, FUNCTION_CODE_SUFFIX, text);
+}
+
+void FunctionCodeCache::rebaseLabels(std::string_view code, int64_t delta, std::string & out)
+{
+    const std::string_view prefix = IR_LABEL_PREFIX;
+
+    size_t pos = 0;
+    while (pos < code.size()) {
+
+        size_t found = code.find(prefix, pos);
+        if (found == std::string_view::npos) {
+            break;
+        }
+
+        size_t digits = found + prefix.size();
+
+        // 只处理不在标识符中间、后跟数字的Label名字
+        bool isLabel = (digits < code.size()) && isdigit((unsigned char) code[digits]) &&
+                       (found == 0 || !(isalnum((unsigned char) code[found - 1]) || code[found - 1] == '_'));
+
+        if (!isLabel) {
+            out.append(code.substr(pos, digits - pos));
+            pos = digits;
+            continue;
+        }
+
+        int64_t index = 0;
+        auto result = std::from_chars(code.data() + digits, code.data() + code.size(), index);
+
+        out.append(code.substr(pos, digits - pos));
+        out.append(std::to_string(index + delta));
+
+        pos = (size_t) (result.ptr - code.data());
+    }
+
+    out.append(code.substr(pos));
+}
@@ -0,0 +1,103 @@
+///
+/// @file FunctionCodeCache.h
+/// @brief 函数级增量编译时各函数汇编的缓存
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "CompileCache.h"
+
+///
+/// @brief 以函数的指纹为键缓存函数的汇编。指纹命中的函数不再生成IR、优化与指令选择，
+/// 代码生成时直接输出缓存的汇编。Label是文件级编号的，缓存中的Label编号从0开始，
+/// 复用时加上函数在当前文件中的起始编号，同时记录Label的个数供后续函数编号
+///
+class FunctionCodeCache {
+
+public:
+    /// @brief 构造函数
+    /// @param _cache 编译缓存
+    explicit FunctionCodeCache(CompileCache & _cache);
+
+    ///
+    /// @brief 按指纹查找各函数缓存的汇编
+    /// @param _fingerprints 函数名到指纹的映射
+    ///
+    void lookup(const std::unordered_map<std::string, std::string> & _fingerprints);
+
+    ///
+    /// @brief 获取汇编可复用的函数，IR生成时跳过这些函数的函数体
+    /// @return const std::unordered_set<std::string>& 函数名
+    ///
+    const std::unordered_set<std::string> & getReusedFunctions() const
+    {
+        return reused;
+    }
+
+    ///
+    /// @brief 获取复用的汇编
+    /// @param name 函数名
+    /// @param labelBase 函数在当前文件中的Label起始编号
+    /// @param code 汇编，Label已重新编号
+    /// @param labelCount 函数占用的Label个数
+    /// @return true 成功
+    /// @return false 函数不可复用
+    ///
+    bool getCode(const std::string & name, int64_t labelBase, std::string & code, int64_t & labelCount) const;
+
+    ///
+    /// @brief 保存新产生的函数汇编，没有指纹的函数不保存
+    /// @param name 函数名
+    /// @param code 汇编
+    /// @param labelBase 函数的Label起始编号
+    /// @param labelCount 函数占用的Label个数
+    ///
+    void store(const std::string & name, std::string_view code, int64_t labelBase, int64_t labelCount);
+
+protected:
+    ///
+    /// @brief 汇编中的Label编号加上偏移
+    /// @param code 汇编
+    /// @param delta 偏移
+    /// @param out 重新编号后的汇编，追加到尾部
+    ///
+    static void rebaseLabels(std::string_view code, int64_t delta, std::string & out);
+
+private:
+    /// @brief 缓存的函数汇编
+    struct Entry {
+
+        /// @brief Label从0开始编号的汇编
+        std::string code;
+
+        /// @brief 占用的Label个数
+        int64_t labelCount = 0;
+    };
+
+    /// @brief 编译缓存
+    CompileCache & cache;
+
+    /// @brief 函数名到指纹的映射
+    std::unordered_map<std::string, std::string> fingerprints;
+
+    /// @brief 命中的函数的汇编
+    std::unordered_map<std::string, Entry> entries;
+
+    /// @brief 汇编可复用的函数
+    std::unordered_set<std::string> reused;
+};
@@ -13,9 +13,14 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <functional>
+#include <queue>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <iostream>
 
@@ -30,6 +35,31 @@
 #include "FuncCallInstruction.h"
 #include "ArgInstruction.h"
 #include "MoveInstruction.h"
+#include "ProfileData.h"
+#include "Liveness.h"
+
+/// @brief 输出汇编字符串常量的内容，引号与反斜杠转义，控制字符等不可打印字符用三位八进制转义，
+/// 使得任意的文件名都能原样出现在.asciz中
+/// @param out 输出缓冲区
+/// @param str 字符串
+static void putAsmString(OutputBuffer & out, const std::string & str)
+{
+    for (char ch: str) {
+
+        auto byte = (unsigned char) ch;
+
+        if ((ch == '"') || (ch == '\\')) {
+            out.put('\\').put(ch);
+        } else if ((byte < 0x20) || (byte == 0x7F)) {
+            out.put('\\');
+            out.put((char) ('0' + (byte >> 6)));
+            out.put((char) ('0' + ((byte >> 3) & 7)));
+            out.put((char) ('0' + (byte & 7)));
+        } else {
+            out.put(ch);
+        }
+    }
+}
 
 /// @brief 构造函数
 /// @param tab 符号表
@@ -41,41 +71,120 @@ CodeGeneratorArm32::~CodeGeneratorArm32()
 {}
 
 /// @brief 产生汇编头部分
-void CodeGeneratorArm32::genHeader()
+/// @param out 输出缓冲区
+void CodeGeneratorArm32::genHeader(OutputBuffer & out)
 {
-    fprintf(fp, "%s\n", ".arch armv7ve");
-    fprintf(fp, "%s\n", ".arm");
-    fprintf(fp, "%s\n", ".fpu vfpv4");
+    out.put(".arch armv7ve\n");
+    out.put(".arm\n");
+    out.put(".fpu vfpv4\n");
 }
 
 /// @brief 全局变量Section，主要包含初始化的和未初始化过的
-void CodeGeneratorArm32::genDataSection()
+/// @param out 输出缓冲区
+void CodeGeneratorArm32::genDataSection(OutputBuffer & out)
 {
     // 生成代码段
-    fprintf(fp, ".text\n");
-
-    // 可直接操作文件指针fp进行写操作
+    out.put(".text\n");
 
     // 目前不支持全局变量和静态变量，以及字符串常量
     // 全局变量分两种情况：初始化的全局变量和未初始化的全局变量
     // TODO 这里先处理未初始化的全局变量
+    auto & counters = module->getProfileCounters();
+    std::unordered_set<GlobalVariable *> counterSet(counters.begin(), counters.end());
+
     for (auto var: module->getGlobalVariables()) {
 
+        if (counterSet.count(var)) {
+            // 插桩的计数器在剖析数据中统一输出
+            continue;
+        }
+
+        const std::string & name = var->getName();
+
         if (var->isInBSSSection()) {
 
             // 在BSS段的全局变量，可以包含初值全是0的变量
-            fprintf(fp, ".comm %s, %d, %d\n", var->getName().c_str(), var->getType()->getSize(), var->getAlignment());
+            out.put(".comm ").put(name).put(", ").putInt(var->getType()->getSize());
+            out.put(", ").putInt(var->getAlignment()).put('\n');
         } else {
 
             // 有初值的全局变量
-            fprintf(fp, ".global %s\n", var->getName().c_str());
-            fprintf(fp, ".data\n");
-            fprintf(fp, ".align %d\n", var->getAlignment());
-            fprintf(fp, ".type %s, %%object\n", var->getName().c_str());
-            fprintf(fp, "%s\n", var->getName().c_str());
+            out.put(".global ").put(name).put('\n');
+            out.put(".data\n");
+            out.put(".align ").putInt(var->getAlignment()).put('\n');
+            out.put(".type ").put(name).put(", %object\n");
+            out.put(name).put('\n');
             // TODO 后面设置初始化的值，具体请参考ARM的汇编
         }
     }
+
+    if (!counters.empty()) {
+        genProfileSection(out);
+    }
+}
+
+/// @brief --profile-generate插桩时输出剖析数据以及程序退出时的转储函数
+/// @param out 输出缓冲区
+void CodeGeneratorArm32::genProfileSection(OutputBuffer & out)
+{
+    auto & counters = module->getProfileCounters();
+
+    // 剖析数据：文件头后紧跟计数器数组，转储时整体写入文件，格式见ProfileData
+    out.put(".data\n");
+    out.put(".align 2\n");
+    out.put(".type __minic_prof_data, %object\n");
+    out.put("__minic_prof_data:\n");
+    out.put(".word ").putUInt(ProfileData::MAGIC).put('\n');
+    out.put(".word ").putUInt(ProfileData::VERSION).put('\n');
+    out.put(".word ").putUInt(module->getProfileChecksum()).put('\n');
+    out.put(".word ").putUInt(counters.size()).put('\n');
+    for (auto counter: counters) {
+        out.put(counter->getName()).put(":\n");
+        out.put(".space 4\n");
+    }
+
+    // 剖析数据文件名
+    out.put(".section .rodata\n");
+    out.put("__minic_prof_file:\n");
+    out.put(".asciz \"");
+    putAsmString(out, module->getProfileFile());
+    out.put("\"\n");
+    out.put("__minic_prof_mode:\n");
+    out.put(".asciz \"wb\"\n");
+
+    // 转储函数：fp = fopen(file, "wb"); fwrite(data, 4, 4 + n, fp); fclose(fp)
+    uint32_t words = (uint32_t) counters.size() + 4;
+
+    out.put(".text\n");
+    out.put(".align 2\n");
+    out.put(".type __minic_prof_dump, %function\n");
+    out.put("__minic_prof_dump:\n");
+    out.put("\tpush {r4,lr}\n");
+    out.put("\tmovw r0,#:lower16:__minic_prof_file\n");
+    out.put("\tmovt r0,#:upper16:__minic_prof_file\n");
+    out.put("\tmovw r1,#:lower16:__minic_prof_mode\n");
+    out.put("\tmovt r1,#:upper16:__minic_prof_mode\n");
+    out.put("\tbl fopen\n");
+    out.put("\tcmp r0,#0\n");
+    out.put("\tbeq 1f\n");
+    out.put("\tmov r4,r0\n");
+    out.put("\tmovw r0,#:lower16:__minic_prof_data\n");
+    out.put("\tmovt r0,#:upper16:__minic_prof_data\n");
+    out.put("\tmov r1,#4\n");
+    out.put("\tmovw r2,#").putUInt(words & 0xFFFF).put('\n');
+    out.put("\tmovt r2,#").putUInt(words >> 16).put('\n');
+    out.put("\tmov r3,r4\n");
+    out.put("\tbl fwrite\n");
+    out.put("\tmov r0,r4\n");
+    out.put("\tbl fclose\n");
+    out.put("1:\n");
+    out.put("\tpop {r4,pc}\n");
+
+    // 通过.fini_array在main返回或者exit时调用转储函数
+    out.put(".section .fini_array,\"aw\"\n");
+    out.put(".align 2\n");
+    out.put(".word __minic_prof_dump\n");
+    out.put(".text\n");
 }
 
 ///
@@ -110,9 +219,22 @@ void CodeGeneratorArm32::getIRValueStr(Value * val, std::string & str)
     }
 }
 
+/// @brief 并行生成代码前对函数的串行预处理，这里调整函数调用指令
+/// @param func 要处理的函数
+void CodeGeneratorArm32::prepareCodeSection(Function * func)
+{
+    // 调整函数调用指令，主要是前四个寄存器传值，后面用栈传递
+    // 为了更好的进行寄存器分配，可以进行对函数调用的指令进行预处理
+    // 当然也可以不做处理，不过性能更差。这个处理是可选的。
+    // 新插入的赋值指令会在全局变量、常量等跨函数共享的Value上增加use，因此不能并行
+    adjustFormalParamUses(func);
+    adjustFuncCallInsts(func);
+}
+
 /// @brief 针对函数进行汇编指令生成，放到.text代码段中
 /// @param func 要处理的函数
-void CodeGeneratorArm32::genCodeSection(Function * func)
+/// @param out 汇编指令写入该输出缓冲区
+void CodeGeneratorArm32::genCodeSection(Function * func, OutputBuffer & out)
 {
     // 寄存器分配以及栈内局部变量的站内地址重新分配
     registerAllocation(func);
@@ -120,16 +242,12 @@ void CodeGeneratorArm32::genCodeSection(Function * func)
     // 获取函数的指令列表
     std::vector<Instruction *> & IrInsts = func->getInterCode().getInsts();
 
-    // 汇编指令输出前要确保Label的名字有效，必须是程序级别的唯一，而不是函数内的唯一。要全局编号。
-    for (auto inst: IrInsts) {
-        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
-            inst->setName(IR_LABEL_PREFIX + std::to_string(labelIndex++));
-        }
-    }
-
     // ILOC代码序列
     ILocArm32 iloc(module);
 
+    // 简单的朴素寄存器分配方法，每个函数各自一个
+    SimpleRegisterAllocator simpleRegisterAllocator;
+
     // 指令选择生成汇编指令
     InstSelectorArm32 instSelector(IrInsts, iloc, func, simpleRegisterAllocator);
     instSelector.setShowLinearIR(this->showLinearIR);
@@ -139,36 +257,40 @@ void CodeGeneratorArm32::genCodeSection(Function * func)
     iloc.deleteUnusedLabel();
 
     // ILOC代码输出为汇编代码
-    fprintf(fp, ".align %d\n", func->getAlignment());
-    fprintf(fp, ".global %s\n", func->getName().c_str());
-    fprintf(fp, ".type %s, %%function\n", func->getName().c_str());
-    fprintf(fp, "%s:\n", func->getName().c_str());
+    const std::string & name = func->getName();
+    out.put(".align ").putInt(func->getAlignment()).put('\n');
+    out.put(".global ").put(name).put('\n');
+    out.put(".type ").put(name).put(", %function\n");
+    out.put(name).put(":\n");
 
     // 开启时输出IR指令作为注释
     if (this->showLinearIR) {
 
+        // 各变量共用一个字符串
+        std::string str;
+
         // 输出有关局部变量的注释，便于查找问题
         for (auto localVar: func->getVarValues()) {
-            std::string str;
+            str.clear();
             getIRValueStr(localVar, str);
             if (!str.empty()) {
-                fprintf(fp, "%s\n", str.c_str());
+                out.put(str).put('\n');
             }
         }
 
         // 输出指令关联的临时变量信息
         for (auto inst: func->getInterCode().getInsts()) {
             if (inst->hasResultValue()) {
-                std::string str;
+                str.clear();
                 getIRValueStr(inst, str);
                 if (!str.empty()) {
-                    fprintf(fp, "%s\n", str.c_str());
+                    out.put(str).put('\n');
                 }
             }
         }
     }
 
-    iloc.outPut(fp);
+    iloc.outPut(out);
 }
 
 /// @brief 寄存器分配
@@ -203,13 +325,15 @@ void CodeGeneratorArm32::registerAllocation(Function * func)
         protectedRegNo.push_back(ARM32_LX_REG_NO);
     }
 
-    // 调整函数调用指令，主要是前四个寄存器传值，后面用栈传递
-    // 为了更好的进行寄存器分配，可以进行对函数调用的指令进行预处理
-    // 当然也可以不做处理，不过性能更差。这个处理是可选的。
-    adjustFuncCallInsts(func);
+    // 函数调用指令已在prepareCodeSection中串行调整
 
     // 为局部变量和临时变量在栈内分配空间，指定偏移，进行栈空间的分配
-    stackAlloc(func);
+    // 优化时按活跃区间共用栈槽，-O0时每个值独占一个栈槽
+    if (optLevel > 0) {
+        stackAllocByLiveness(func);
+    } else {
+        stackAlloc(func);
+    }
 
     // 函数形参要求前四个寄存器分配，后面的参数采用栈传递，实现实参的值传递给形参
     // 这一步是必须的
@@ -250,106 +374,115 @@ void CodeGeneratorArm32::adjustFormalParamInsts(Function * func)
     }
 }
 
-/// @brief 寄存器分配前对函数内的指令进行调整，以便方便寄存器分配
+/// @brief 寄存器传值的形参若不是在入口处就复制到局部变量，入口处先复制到局部变量
 /// @param func 要处理的函数
-void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
+void CodeGeneratorArm32::adjustFormalParamUses(Function * func)
 {
-    std::vector<Instruction *> newInsts;
-
-    // 当前函数的指令列表
+    // 形参所在的R0-R3会被后面的指令或函数调用改写，必须在入口处、其它指令之前复制出来。
+    // 普通形参的复制指令通常紧跟入口指令，但数组形参等直接使用形参，
+    // 插桩等变换也可能在复制指令之前插入指令，这些形参需要先复制到局部变量中再使用
+    auto & params = func->getParams();
     auto & insts = func->getInterCode().getInsts();
 
-    // 函数返回值用R0寄存器，若函数调用有返回值，则赋值R0到对应寄存器
-    // 通过栈传递的实参，采用SP + 偏移的方式殉职，偏移肯定非负。
-    for (auto pIter = insts.begin(); pIter != insts.end(); pIter++) {
+    // 紧跟入口指令的形参复制指令所复制的形参
+    std::unordered_set<Value *> copied;
+    for (size_t k = 1; k < insts.size(); ++k) {
+        Instanceof(moveInst, MoveInstruction *, insts[k]);
+        if ((!moveInst) || moveInst->getIsPointerStore() || moveInst->getIsPointerLoad() ||
+            (!dynamic_cast<FormalParam *>(moveInst->getOperand(1)))) {
+            break;
+        }
+        copied.insert(moveInst->getOperand(1));
+    }
 
-        // 检查是否是函数调用指令，并且含有返回值
-        if (Instanceof(callInst, FuncCallInstruction *, *pIter)) {
+    std::vector<Instruction *> copyInsts;
 
-            // 实参前四个要寄存器传值，其它参数通过栈传递
+    for (int32_t k = 0; k < (int32_t) params.size() && k < PlatformArm32::maxRegArgNum; k++) {
 
-            int32_t argNum = callInst->getOperandsNum();
+        FormalParam * param = params[k];
 
-            // 除前四个整数寄存器外，后面的参数采用栈传递
-            int esp = 0;
-            for (int32_t k = 4; k < argNum; k++) {
+        if (param->getUses().empty() || copied.count(param)) {
+            continue;
+        }
 
-                // 获取实参的值
-                auto arg = callInst->getOperand(k);
+        LocalVariable * copy = func->newLocalVarValue(param->getType());
+        param->replaceAllUseWith(copy);
 
-                // 栈帧空间（低地址在前，高地址在后）
-                // --------------------- sp
-                // 实参栈传递的空间（排除寄存器传递的实参空间）
-                // ---------------------
-                // 需要保存在栈中的局部变量或临时变量或形参对应变量空间
-                // --------------------- fp
-                // 保护寄存器的空间
-                // ---------------------
+        copyInsts.push_back(new MoveInstruction(func, copy, param));
+    }
 
-                // 新建一个内存变量，把实参的值保存到栈中，以便栈传值，其寻址为SP + 非负偏移
-                MemVariable * newVal = func->newMemVariable(IntegerType::getTypeInt());
-                newVal->setMemoryAddr(ARM32_SP_REG_NO, esp);
-                esp += 4;
+    // 复制指令紧跟在入口指令之后
+    if (!copyInsts.empty()) {
+        insts.insert(insts.begin() + 1, copyInsts.begin(), copyInsts.end());
+    }
+}
 
-                // 引入赋值指令，把实参的值保存到内存变量上
-                Instruction * assignInst = new MoveInstruction(func, newVal, arg);
+/// @brief 寄存器分配前对函数内的指令进行调整，以便方便寄存器分配
+/// @param func 要处理的函数
+void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
+{
+    // 当前函数的指令列表
+    auto & insts = func->getInterCode().getInsts();
 
-                // 更换实参变量为内存变量
-                callInst->setOperand(k, newVal);
+    // 一遍扫描产生新的指令序列，避免在vector中间插入造成后面的指令整体移动
+    std::vector<Instruction *> newInsts;
+    newInsts.reserve(insts.size());
 
-                // 赋值指令插入到函数调用指令的前面
-                // 函数调用指令前插入后，pIter仍指向函数调用指令
-                pIter = insts.insert(pIter, assignInst);
-                pIter++;
-            }
+    // 函数返回值用R0寄存器，若函数调用有返回值，则赋值R0到对应寄存器
+    // 通过栈传递的实参，采用SP + 偏移的方式寻址，偏移肯定非负。
+    for (auto inst: insts) {
 
-            // ARM32的函数调用约定，前四个参数通过寄存器传递
-            for (int k = 0; k < argNum && k < 4; k++) {
+        Instanceof(callInst, FuncCallInstruction *, inst);
+        if ((!callInst) || callInst->lowered) {
+            newInsts.push_back(inst);
+            continue;
+        }
 
-                // 把实参的值通过move指令传递给寄存器
+        // 实参前四个要寄存器传值，其它参数通过栈传递
+        int32_t argNum = callInst->getOperandsNum();
 
-                auto arg = callInst->getOperand(k);
+        // 除前四个整数寄存器外，后面的参数采用栈传递，再传送寄存器传递的实参，
+        // 这样栈传递实参的赋值不会破坏已传送到寄存器的实参
+        for (int32_t k = PlatformArm32::maxRegArgNum; k < argNum; k++) {
+            newInsts.push_back(lowerCallArg(func, callInst, k));
+        }
 
-                Instruction * assignInst = new MoveInstruction(func, PlatformArm32::intRegVal[k], arg);
+        for (int32_t k = 0; k < argNum && k < PlatformArm32::maxRegArgNum; k++) {
+            newInsts.push_back(lowerCallArg(func, callInst, k));
+        }
 
-                callInst->setOperand(k, PlatformArm32::intRegVal[k]);
+        newInsts.push_back(callInst);
 
-                // 函数调用指令前插入后，pIter仍指向函数调用指令
-                pIter = insts.insert(pIter, assignInst);
-                pIter++;
-            }
+        // 赋值指令
+        if (callInst->hasResultValue() && (callInst->getRegId() != 0)) {
 
-#if 0
-            for (int k = 0; k < callInst->getOperandsNum(); k++) {
+            // 结果变量的寄存器和返回值寄存器不一样，需要产生赋值指令
+            newInsts.push_back(new MoveInstruction(func, callInst, PlatformArm32::getIntRegVal(func, 0)));
+        }
 
-                auto arg = callInst->getOperand(k);
+        callInst->lowered = true;
+    }
 
-                // 产生ARG指令
-                pIter = insts.insert(pIter, new ArgInstruction(func, arg));
-                pIter++;
-            }
-#endif
+    insts.swap(newInsts);
+}
 
-            // 有arg指令后可不用参数，展示不删除
-            // args.clear();
+/// @brief 产生把函数调用的第index个实参传送到其传递位置的赋值指令，并把实参替换为传递位置
+/// @param func 调用者函数
+/// @param callInst 函数调用指令
+/// @param index 实参序号
+/// @return Instruction* 赋值指令
+Instruction * CodeGeneratorArm32::lowerCallArg(Function * func, FuncCallInstruction * callInst, int32_t index)
+{
+    Value * arg = callInst->getOperand(index);
+    Value * argVal = PlatformArm32::getArgValue(func, index);
 
-            // 赋值指令
-            if (callInst->hasResultValue()) {
+    // 引入赋值指令，把实参的值传送到寄存器或者栈内存上
+    Instruction * assignInst = new MoveInstruction(func, argVal, arg);
 
-                if (callInst->getRegId() == 0) {
-                    // 结果变量的寄存器和返回值寄存器一样，则什么都不需要做
-                    ;
-                } else {
-                    // 其它情况，需要产生赋值指令
-                    // 新建一个赋值操作
-                    Instruction * assignInst = new MoveInstruction(func, callInst, PlatformArm32::intRegVal[0]);
+    // 更换实参变量为传递位置
+    callInst->setOperand(index, argVal);
 
-                    // 函数调用指令的下一个指令的前面插入指令，因为有Exit指令，+1肯定有效
-                    pIter = insts.insert(pIter + 1, assignInst);
-                }
-            }
-        }
-    }
+    return assignInst;
 }
 
 /// @brief 栈空间分配
@@ -377,8 +510,47 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
 
     int32_t sp_esp = 0;
 
+    // 带有剖析数据时，按访问的动态次数从高到低分配，使得热的变量靠近fp，
+    // 偏移能直接编码在ldr/str指令中，冷的变量以及大数组的偏移超出范围时才需要额外的指令
+    std::vector<LocalVariable *> vars = func->getVarValues();
+    std::vector<Instruction *> temps;
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (inst->hasResultValue()) {
+            temps.push_back(inst);
+        }
+    }
+
+    if (func->hasProfile()) {
+
+        auto & insts = func->getInterCode().getInsts();
+
+        std::vector<uint64_t> instCounts;
+        ProfileData::getInstCounts(func, instCounts);
+
+        std::unordered_map<Instruction *, uint64_t> countOf;
+        for (size_t k = 0; k < insts.size(); ++k) {
+            countOf[insts[k]] = instCounts[k];
+        }
+
+        std::unordered_map<Value *, uint64_t> weight;
+        for (size_t k = 0; k < insts.size(); ++k) {
+            for (auto operand: insts[k]->getOperands()) {
+                weight[operand->getUsee()] += instCounts[k];
+            }
+        }
+
+        // 指令结果的定值也访问一次栈槽
+        for (auto inst: temps) {
+            weight[inst] += countOf[inst];
+        }
+
+        auto hotter = [&weight](Value * a, Value * b) { return weight[a] > weight[b]; };
+        std::stable_sort(vars.begin(), vars.end(), hotter);
+        std::stable_sort(temps.begin(), temps.end(), hotter);
+    }
+
     // 遍历函数变量列表
-    for (auto var: func->getVarValues()) {
+    for (auto var: vars) {
 
         // 对于简单类型的寄存器分配策略，假定临时变量和局部变量都保存在栈中，属于内存
         // 而对于图着色等，临时变量一般是寄存器，局部变量也可能修改为寄存器
@@ -409,9 +581,9 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
     }
 
     // 遍历包含有值的指令，也就是临时变量
-    for (auto inst: func->getInterCode().getInsts()) {
+    for (auto inst: temps) {
 
-        if (inst->hasResultValue() && (inst->getRegId() == -1)) {
+        if (inst->getRegId() == -1) {
             // 有值，并且没有分配寄存器
 
             int32_t size = inst->getType()->getSize();
@@ -444,3 +616,248 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
     // 设置函数的最大栈帧深度，没有考虑寄存器保护的空间大小
     func->setMaxDep(sp_esp);
 }
+
+///
+/// @brief 栈内分配的栈槽，活跃区间不相交的多个值可共用一个栈槽
+///
+struct StackSlot {
+
+    /// @brief 大小，4字节的整数倍
+    int32_t size;
+
+    /// @brief 相对fp的偏移
+    int32_t offset;
+
+    /// @brief 剖析数据中共用该栈槽的值被访问的总次数
+    uint64_t weight;
+};
+
+/// @brief 基于活跃变量分析的栈空间分配，活跃区间不相交的值共用栈槽
+/// @param func 要处理的函数
+void CodeGeneratorArm32::stackAllocByLiveness(Function * func)
+{
+    // 栈内分配的空间除了寄存器保护所分配的空间之外，还需要管理如下的空间
+    // (1) 没有指派寄存器的局部变量、形参或临时变量的栈内分配
+    // (2) 函数调用时需要栈内传递的实参
+    // (3) 函数内定义的数组变量需要在栈内分配
+    // (4) 函数内定义的静态变量空间分配按静态分配处理
+
+    // 遍历函数内的所有指令，查找没有寄存器分配的变量，然后进行栈内空间分配
+
+    // 栈帧空间
+    // --------------------- sp
+    // 实参栈传递的空间（排除寄存器传递的实参空间）
+    // ---------------------
+    // 需要保存在栈中的局部变量或临时变量或形参对应变量空间
+    // --------------------- fp
+    // 保护寄存器的空间
+    // ---------------------
+
+    // 这里对临时变量和局部变量都在栈上进行分配，采用FP+偏移的寻址方式，偏移为负数
+
+    int32_t sp_esp = 0;
+
+    auto & insts = func->getInterCode().getInsts();
+
+    // 需要分配栈空间的值：没有指派寄存器的局部变量与临时变量，数组按地址访问，不参与活跃变量分析，单独分配
+    std::vector<Value *> scalars;
+    std::vector<LocalVariable *> arrays;
+
+    for (auto var: func->getVarValues()) {
+
+        // regId不为-1，则说明该变量分配为寄存器
+        // baseRegNo不等于-1，则说明该变量肯定在栈上，属于内存变量，之前肯定已经分配过
+        if ((var->getRegId() == -1) && (!var->getMemoryAddr())) {
+            if (var->getType()->isArrayType()) {
+                arrays.push_back(var);
+            } else {
+                scalars.push_back(var);
+            }
+        }
+    }
+
+    for (auto inst: insts) {
+        if (inst->hasResultValue() && (inst->getRegId() == -1)) {
+            scalars.push_back(inst);
+        }
+    }
+
+    // 值的活跃区间为线性指令序列上包含其全部定值、使用以及活跃位置的最小区间。
+    // 区间不相交的两个值，一个写栈槽时另一个必然不活跃，可以共用一个栈槽
+    Liveness liveness(func);
+    auto & numbering = liveness.getNumbering();
+    auto & blocks = liveness.getCFG().getBlocks();
+
+    std::vector<size_t> rangeStart(numbering.size(), SIZE_MAX);
+    std::vector<size_t> rangeEnd(numbering.size(), 0);
+
+    auto extend = [&rangeStart, &rangeEnd](uint32_t n, size_t pos) {
+        rangeStart[n] = std::min(rangeStart[n], pos);
+        rangeEnd[n] = std::max(rangeEnd[n], pos);
+    };
+
+    for (uint32_t b = 0; b < liveness.getCFG().size(); ++b) {
+
+        size_t first = blocks[b].begin;
+        size_t last = blocks[b].end - 1;
+
+        liveness.getLiveIn(b).forEach([&extend, first](uint32_t n) { extend(n, first); });
+        liveness.getLiveOut(b).forEach([&extend, last](uint32_t n) { extend(n, last); });
+
+        for (size_t k = first; k <= last; ++k) {
+
+            Instruction * inst = insts[k];
+            if (inst->isDead()) {
+                continue;
+            }
+
+            int32_t def = liveness.getDefNumber(inst);
+            if (def != -1) {
+                extend((uint32_t) def, k);
+            }
+
+            liveness.forEachUse(inst, [&extend, k](uint32_t n) { extend(n, k); });
+        }
+    }
+
+    // 按区间的开始位置线性扫描，区间已结束的值释放其栈槽供后面同样大小的值复用。
+    // 从不被访问的值没有区间，放到任一同样大小的栈槽中
+    std::stable_sort(scalars.begin(), scalars.end(), [&numbering, &rangeStart](Value * a, Value * b) {
+        return rangeStart[numbering.getNumber(a)] < rangeStart[numbering.getNumber(b)];
+    });
+
+    std::vector<StackSlot> slots;
+    std::vector<uint32_t> slotOf(scalars.size());
+
+    // 占用中的栈槽，按区间的结束位置从小到大出队
+    std::priority_queue<std::pair<size_t, uint32_t>,
+                        std::vector<std::pair<size_t, uint32_t>>,
+                        std::greater<std::pair<size_t, uint32_t>>>
+        active;
+
+    // 按大小分类的空闲栈槽
+    std::unordered_map<int32_t, std::vector<uint32_t>> freeSlots;
+
+    for (size_t k = 0; k < scalars.size(); ++k) {
+
+        uint32_t n = (uint32_t) numbering.getNumber(scalars[k]);
+
+        // 32位ARM平台按照4字节的大小整数倍分配局部变量
+        int32_t size = (scalars[k]->getType()->getSize() + 3) & ~3;
+
+        while (!active.empty() && (active.top().first < rangeStart[n])) {
+            uint32_t slot = active.top().second;
+            freeSlots[slots[slot].size].push_back(slot);
+            active.pop();
+        }
+
+        uint32_t slot = (uint32_t) slots.size();
+
+        if (rangeStart[n] == SIZE_MAX) {
+
+            // 没有区间，复用第一个同样大小的栈槽
+            for (uint32_t s = 0; s < slots.size(); ++s) {
+                if (slots[s].size == size) {
+                    slot = s;
+                    break;
+                }
+            }
+        } else {
+
+            auto & candidates = freeSlots[size];
+            if (!candidates.empty()) {
+                slot = candidates.back();
+                candidates.pop_back();
+            }
+
+            active.emplace(rangeEnd[n], slot);
+        }
+
+        if (slot == slots.size()) {
+            slots.push_back(StackSlot{size, 0, 0});
+        }
+
+        slotOf[k] = slot;
+    }
+
+    // 栈槽在栈帧中的次序，默认按创建的次序
+    std::vector<uint32_t> slotOrder(slots.size());
+    for (uint32_t s = 0; s < slots.size(); ++s) {
+        slotOrder[s] = s;
+    }
+
+    // 带有剖析数据时，按访问的动态次数从高到低分配，使得热的栈槽靠近fp，
+    // 偏移能直接编码在ldr/str指令中，冷的变量以及大数组的偏移超出范围时才需要额外的指令
+    if (func->hasProfile()) {
+
+        std::vector<uint64_t> instCounts;
+        ProfileData::getInstCounts(func, instCounts);
+
+        std::unordered_map<Value *, uint64_t> weight;
+        for (size_t k = 0; k < insts.size(); ++k) {
+            for (auto operand: insts[k]->getOperands()) {
+                weight[operand->getUsee()] += instCounts[k];
+            }
+
+            // 指令结果的定值也访问一次栈槽
+            if (insts[k]->hasResultValue()) {
+                weight[insts[k]] += instCounts[k];
+            }
+        }
+
+        for (size_t k = 0; k < scalars.size(); ++k) {
+            slots[slotOf[k]].weight += weight[scalars[k]];
+        }
+
+        std::stable_sort(slotOrder.begin(), slotOrder.end(), [&slots](uint32_t a, uint32_t b) {
+            return slots[a].weight > slots[b].weight;
+        });
+
+        std::stable_sort(arrays.begin(), arrays.end(), [&weight](LocalVariable * a, LocalVariable * b) {
+            return weight[a] > weight[b];
+        });
+    }
+
+    // 这里要注意检查变量栈的偏移范围。一般采用机制寄存器+立即数方式间接寻址
+    // 若立即数满足要求，可采用基址寄存器+立即数变量的方式访问变量
+    // 否则，需要先把偏移量放到寄存器中，然后机制寄存器+偏移寄存器来寻址
+    for (auto s: slotOrder) {
+
+        // 累计当前作用域大小
+        sp_esp += slots[s].size;
+        slots[s].offset = -sp_esp;
+    }
+
+    for (size_t k = 0; k < scalars.size(); ++k) {
+
+        int32_t offset = slots[slotOf[k]].offset;
+
+        if (Instanceof(var, LocalVariable *, scalars[k])) {
+            var->setMemoryAddr(ARM32_FP_REG_NO, offset);
+        } else {
+            static_cast<Instruction *>(scalars[k])->setMemoryAddr(ARM32_FP_REG_NO, offset);
+        }
+    }
+
+    // 数组各自独占栈空间，放在标量的栈槽之后
+    for (auto var: arrays) {
+
+        int32_t size = (var->getType()->getSize() + 3) & ~3;
+
+        sp_esp += size;
+
+        var->setMemoryAddr(ARM32_FP_REG_NO, -sp_esp);
+    }
+
+    // 通过栈传递的实参，ARM32的前四个通过寄存器传递
+    int maxFuncCallArgCnt = func->getMaxFuncCallArgCnt();
+    if (maxFuncCallArgCnt > 4) {
+        sp_esp += (maxFuncCallArgCnt - 4) * 4;
+    }
+
+    // 只有int类型时可以4字节对齐，支持浮点或者向量运算时要16字节对齐
+    // sp_esp = (sp_esp + 15) & ~15;
+
+    // 设置函数的最大栈帧深度，没有考虑寄存器保护的空间大小
+    func->setMaxDep(sp_esp);
+}
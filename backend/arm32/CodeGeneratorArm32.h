@@ -16,6 +16,8 @@
 #include "CodeGeneratorAsm.h"
 #include "SimpleRegisterAllocator.h"
 
+class FuncCallInstruction;
+
 class CodeGeneratorArm32 : public CodeGeneratorAsm {
 
 public:
@@ -28,14 +30,25 @@ public:
 
 protected:
     /// @brief 产生汇编头部分
-    void genHeader() override;
+    /// @param out 输出缓冲区
+    void genHeader(OutputBuffer & out) override;
 
     /// @brief 全局变量Section，主要包含初始化的和未初始化过的
-    void genDataSection() override;
+    /// @param out 输出缓冲区
+    void genDataSection(OutputBuffer & out) override;
+
+    /// @brief --profile-generate插桩时输出剖析数据以及程序退出时的转储函数
+    /// @param out 输出缓冲区
+    void genProfileSection(OutputBuffer & out);
+
+    /// @brief 并行生成代码前对函数的串行预处理，这里调整函数调用指令
+    /// @param func 要处理的函数
+    void prepareCodeSection(Function * func) override;
 
     /// @brief 针对函数进行汇编指令生成，放到.text代码段中
     /// @param func 要处理的函数
-    void genCodeSection(Function * func) override;
+    /// @param out 汇编指令写入该输出缓冲区
+    void genCodeSection(Function * func, OutputBuffer & out) override;
 
     /// @brief 寄存器分配
     /// @param func 要处理的函数
@@ -45,10 +58,25 @@ protected:
     /// @param func 要处理的函数
     void stackAlloc(Function * func);
 
+    /// @brief 基于活跃变量分析的栈空间分配，活跃区间不相交的值共用栈槽
+    /// @param func 要处理的函数
+    void stackAllocByLiveness(Function * func);
+
+    /// @brief 寄存器传值的形参若不是在入口处就复制到局部变量，入口处先复制到局部变量
+    /// @param func 要处理的函数
+    void adjustFormalParamUses(Function * func);
+
     /// @brief 寄存器分配前对函数内的指令进行调整，以便方便寄存器分配
     /// @param func 要处理的函数
     void adjustFuncCallInsts(Function * func);
 
+    /// @brief 产生把函数调用的第index个实参传送到其传递位置的赋值指令，并把实参替换为传递位置
+    /// @param func 调用者函数
+    /// @param callInst 函数调用指令
+    /// @param index 实参序号
+    /// @return Instruction* 赋值指令
+    static Instruction * lowerCallArg(Function * func, FuncCallInstruction * callInst, int32_t index);
+
     /// @brief 寄存器分配前对形参指令调整，便于栈内空间分配以及寄存器分配
     /// @param func 要处理的函数
     void adjustFormalParamInsts(Function * func);
@@ -58,10 +86,4 @@ protected:
     /// @param str
     ///
     void getIRValueStr(Value * val, std::string & str);
-
-private:
-    ///
-    /// @brief 简单的朴素寄存器分配方法
-    ///
-    SimpleRegisterAllocator simpleRegisterAllocator;
 };
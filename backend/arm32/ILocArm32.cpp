@@ -13,11 +13,13 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <charconv>
 #include <cstdio>
 #include <string>
 
 #include "ILocArm32.h"
 #include "Common.h"
+#include "CompileReport.h"
 #include "Function.h"
 #include "PlatformArm32.h"
 #include "Module.h"
@@ -29,7 +31,9 @@ ArmInst::ArmInst(std::string _opcode,
                  std::string _cond,
                  std::string _addition)
     : opcode(_opcode), cond(_cond), result(_result), arg1(_arg1), arg2(_arg2), addition(_addition), dead(false)
-{}
+{
+    countObject(CountedObject::ARM_INST);
+}
 
 /*
     指令内容替换
@@ -41,6 +45,16 @@ void ArmInst::replace(std::string _opcode,
                       std::string _cond,
                       std::string _addition)
 {
+    // 原来的跳转或Label不再存在
+    if (label) {
+        if (label->inst == this) {
+            label->inst = nullptr;
+        } else if (!dead) {
+            label->useCount--;
+        }
+        label = nullptr;
+    }
+
     opcode = _opcode;
     result = _result;
     arg1 = _arg1;
@@ -61,55 +75,52 @@ void ArmInst::replace(std::string _opcode,
 */
 void ArmInst::setDead()
 {
+    if (!dead && isBranch()) {
+        label->useCount--;
+    }
+
     dead = true;
 }
 
 /*
-    输出函数
+    输出函数，直接写入输出缓冲区，不产生临时字符串
 */
-std::string ArmInst::outPut()
+void ArmInst::outPut(OutputBuffer & out)
 {
-    // 无用代码，什么都不输出
-    if (dead) {
-        return "";
-    }
-
-    // 占位指令,可能需要输出一个空操作，看是否支持 FIXME
-    if (opcode.empty()) {
-        return "";
+    // 无用代码或占位指令，什么都不输出。占位指令可能需要输出一个空操作，看是否支持 FIXME
+    if (isEmpty()) {
+        return;
     }
 
-    std::string ret = opcode;
+    out.put(opcode);
 
     if (!cond.empty()) {
-        ret += cond;
+        out.put(cond);
     }
 
     // 结果输出
     if (!result.empty()) {
         if (result == ":") {
-            ret += result;
+            out.put(':');
         } else {
-            ret += " " + result;
+            out.put(' ').put(result);
         }
     }
 
     // 第一元参数输出
     if (!arg1.empty()) {
-        ret += "," + arg1;
+        out.put(',').put(arg1);
     }
 
     // 第二元参数输出
     if (!arg2.empty()) {
-        ret += "," + arg2;
+        out.put(',').put(arg2);
     }
 
     // 其他附加信息输出
     if (!addition.empty()) {
-        ret += "," + addition;
+        out.put(',').put(addition);
     }
-
-    return ret;
 }
 
 #define emit(...) code.push_back(new ArmInst(__VA_ARGS__))
@@ -131,31 +142,22 @@ ILocArm32::~ILocArm32()
     }
 }
 
+/// @brief 获取Label，不存在时新建
+/// @param name Label名字
+/// @return ArmLabel* Label
+ArmLabel * ILocArm32::getLabel(const std::string & name)
+{
+    // unordered_map的元素地址在插入后不变，指令可直接保存指针
+    return &labels[name];
+}
+
 /// @brief 删除无用的Label指令
 void ILocArm32::deleteUnusedLabel()
 {
-    std::list<ArmInst *> labelInsts;
+    // 跳转指令产生或删除时已维护了Label的引用次数，没有跳转指令引用的Label设置为dead
     for (ArmInst * arm: code) {
-        if ((!arm->dead) && (arm->opcode[0] == '.') && (arm->result == ":")) {
-            labelInsts.push_back(arm);
-        }
-    }
-
-    // 检测Label指令是否在被使用，也就是是否有跳转到该Label的指令
-    // 如果没有使用，则设置为dead
-    for (ArmInst * labelArm: labelInsts) {
-        bool labelUsed = false;
-
-        for (ArmInst * arm: code) {
-            // TODO 转移语句的指令标识符根据定义修改判断
-            if ((!arm->dead) && (arm->opcode[0] == 'b') && (arm->result == labelArm->opcode)) {
-                labelUsed = true;
-                break;
-            }
-        }
-
-        if (!labelUsed) {
-            labelArm->setDead();
+        if ((!arm->dead) && arm->label && (arm->label->inst == arm) && (arm->label->useCount == 0)) {
+            arm->setDead();
         }
     }
 }
@@ -165,21 +167,33 @@ void ILocArm32::deleteUnusedLabel()
 /// @param outputEmpty 是否输出空语句
 void ILocArm32::outPut(FILE * file, bool outputEmpty)
 {
-    for (auto arm: code) {
+    OutputBuffer out(file);
 
-        std::string s = arm->outPut();
+    outPut(out, outputEmpty);
+}
+
+/// @brief 逐条指令输出汇编到输出缓冲区
+/// @param out 输出缓冲区
+/// @param outputEmpty 是否输出空语句
+void ILocArm32::outPut(OutputBuffer & out, bool outputEmpty)
+{
+    for (auto arm: code) {
 
-        if (arm->result == ":") {
-            // Label指令，不需要Tab输出
-            fprintf(file, "%s\n", s.c_str());
+        // 删除的指令以及删除的Label指令都是空语句
+        if (arm->isEmpty()) {
+            if (outputEmpty) {
+                out.put('\n');
+            }
             continue;
         }
 
-        if (!s.empty()) {
-            fprintf(file, "\t%s\n", s.c_str());
-        } else if ((outputEmpty)) {
-            fprintf(file, "\n");
+        // Label指令，不需要Tab输出
+        if (arm->result != ":") {
+            out.put('\t');
         }
+
+        arm->outPut(out);
+        out.put('\n');
     }
 }
 
@@ -195,15 +209,17 @@ std::list<ArmInst *> & ILocArm32::getCode()
  */
 std::string ILocArm32::toStr(int num, bool flag)
 {
-    std::string ret;
+    // 直接格式化到栈上的数组，结果不超过短字符串的长度，不需要分配堆空间
+    char buf[16];
+    char * p = buf;
 
     if (flag) {
-        ret = "#";
+        *p++ = '#';
     }
 
-    ret += std::to_string(num);
+    p = std::to_chars(p, buf + sizeof(buf), num).ptr;
 
-    return ret;
+    return std::string(buf, (size_t) (p - buf));
 }
 
 /*
@@ -213,6 +229,10 @@ void ILocArm32::label(std::string name)
 {
     // .L1:
     emit(name, ":");
+
+    ArmLabel * armLabel = getLabel(name);
+    armLabel->inst = code.back();
+    code.back()->label = armLabel;
 }
 
 /// @brief 0个源操作数指令
@@ -383,8 +403,12 @@ void ILocArm32::load_var(int rs_reg_no, Value * src_var)
         // movt r8, #:lower16:a
         load_symbol(rs_reg_no, globalVar->getName());
 
-        // ldr r8, [r8]
-        emit("ldr", PlatformArm32::regName[rs_reg_no], "[" + PlatformArm32::regName[rs_reg_no] + "]");
+        // 全局数组的值就是其地址，标量才需要读取内存
+        if (!globalVar->getType()->isArrayType()) {
+
+            // ldr r8, [r8]
+            emit("ldr", PlatformArm32::regName[rs_reg_no], "[" + PlatformArm32::regName[rs_reg_no] + "]");
+        }
 
     } else {
 
@@ -401,9 +425,15 @@ void ILocArm32::load_var(int rs_reg_no, Value * src_var)
 
         // 对于栈内分配的局部数组，可直接在栈指针上进行移动与运算
         // 但对于形参，其保存的是调用函数栈的数组的地址，需要读取出来
+        if (src_var->getType()->isArrayType()) {
 
-        // ldr r8,[sp,#16]
-        load_base(rs_reg_no, var_baseRegId, var_offset);
+            // add r8,fp,#-16
+            leaStack(rs_reg_no, var_baseRegId, (int) var_offset);
+        } else {
+
+            // ldr r8,[sp,#16]
+            load_base(rs_reg_no, var_baseRegId, var_offset);
+        }
     }
 }
 
@@ -552,6 +582,20 @@ void ILocArm32::nop()
 ///
 void ILocArm32::jump(std::string label)
 {
-    emit("b", label);
+    branch("b", label);
+}
+
+///
+/// @brief 跳转到Label的指令，如beq、bne、b等，引用计数记录在Label上
+/// @param op 操作码
+/// @param label 目标Label名称
+///
+void ILocArm32::branch(std::string op, std::string label)
+{
+    ArmLabel * armLabel = getLabel(label);
+    armLabel->useCount++;
+
+    emit(op, label);
+    code.back()->label = armLabel;
 }
 
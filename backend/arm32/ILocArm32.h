@@ -17,11 +17,25 @@
 
 #include <list>
 #include <string>
+#include <unordered_map>
 
 #include "Module.h"
+#include "OutputBuffer.h"
 
 #define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
 
+struct ArmInst;
+
+/// @brief 汇编中的Label，跳转指令通过它引用目标，不需要按名字比较
+struct ArmLabel {
+
+    /// @brief 定义该Label的指令，尚未定义时为空
+    ArmInst * inst = nullptr;
+
+    /// @brief 未删除的跳转指令引用该Label的次数
+    int32_t useCount = 0;
+};
+
 /// @brief 底层汇编指令：ARM32
 struct ArmInst {
 
@@ -46,6 +60,9 @@ struct ArmInst {
     /// @brief 标识指令是否无效
     bool dead;
 
+    /// @brief Label指令定义的Label，或者跳转指令的目标Label，其它指令为空
+    ArmLabel * label = nullptr;
+
     /// @brief 构造函数
     /// @param op
     /// @param rs
@@ -72,12 +89,26 @@ struct ArmInst {
                  std::string cond = "",
                  std::string extra = "");
 
-    /// @brief 设置死指令
+    /// @brief 设置死指令，跳转指令同时减少目标Label的引用次数
     void setDead();
 
-    /// @brief 指令字符串输出函数
-    /// @return
-    std::string outPut();
+    /// @brief 是否是跳转到Label的指令
+    /// @return true：是
+    bool isBranch() const
+    {
+        return label && (label->inst != this);
+    }
+
+    /// @brief 是否是不输出任何内容的指令，即无效指令或者占位指令
+    /// @return true：不输出
+    bool isEmpty() const
+    {
+        return dead || opcode.empty();
+    }
+
+    /// @brief 指令输出函数，写入输出缓冲区
+    /// @param out 输出缓冲区
+    void outPut(OutputBuffer & out);
 };
 
 /// @brief 底层汇编序列-ARM32
@@ -89,6 +120,14 @@ class ILocArm32 {
     /// @brief 符号表
     Module * module;
 
+    /// @brief Label名字到Label的映射，跳转指令先于Label指令出现时先建立Label
+    std::unordered_map<std::string, ArmLabel> labels;
+
+    /// @brief 获取Label，不存在时新建
+    /// @param name Label名字
+    /// @return ArmLabel* Label
+    ArmLabel * getLabel(const std::string & name);
+
     /// @brief 加载立即数 ldr r0,=#100
     /// @param rs_reg_no 结果寄存器号
     /// @param num 立即数
@@ -207,12 +246,23 @@ public:
     ///
     void jump(std::string label);
 
+    ///
+    /// @brief 跳转到Label的指令，如beq、bne、b等，引用计数记录在Label上
+    /// @param op 操作码
+    /// @param label 目标Label名称
+    ///
+    void branch(std::string op, std::string label);
 
     /// @brief 输出汇编
     /// @param file 输出的文件指针
     /// @param outputEmpty 是否输出空语句
     void outPut(FILE * file, bool outputEmpty = false);
 
-    /// @brief 删除无用的Label指令
+    /// @brief 逐条指令输出汇编到输出缓冲区
+    /// @param out 输出缓冲区
+    /// @param outputEmpty 是否输出空语句
+    void outPut(OutputBuffer & out, bool outputEmpty = false);
+
+    /// @brief 删除无用的Label指令，即没有跳转指令引用的Label，只需遍历一遍指令序列
     void deleteUnusedLabel();
 };
@@ -20,7 +20,6 @@
 #include "InstSelectorArm32.h"
 #include "PlatformArm32.h"
 
-#include "PointerType.h"
 #include "RegVariable.h"
 #include "Function.h"
 
@@ -77,10 +76,22 @@ InstSelectorArm32::~InstSelectorArm32()
 /// @brief 指令选择执行
 void InstSelectorArm32::run()
 {
-    for (auto inst: ir) {
+    for (size_t k = 0; k < ir.size(); ++k) {
+
+        Instruction * inst = ir[k];
 
         // 逐个指令进行翻译
         if (!inst->isDead()) {
+
+            // 记录顺序执行的下一条指令，跳转到该指令时可省去跳转
+            nextInst = nullptr;
+            for (size_t next = k + 1; next < ir.size(); ++next) {
+                if (!ir[next]->isDead()) {
+                    nextInst = ir[next];
+                    break;
+                }
+            }
+
             translate(inst);
         }
     }
@@ -161,17 +172,24 @@ void InstSelectorArm32::translate_goto(Instruction * inst)
         
         // 比较与0
         iloc.inst("cmp", PlatformArm32::regName[condRegNo], "#0");
-        
-        // 如果不等于0，跳转到trueLabel
-        iloc.inst("bne", trueLabel);
-        
-        // 否则跳转到falseLabel
-        iloc.inst("b", falseLabel);
+
+        if (nextInst == gotoInst->getTarget()) {
+            // 真分支紧随其后，等于0时跳转到falseLabel，否则顺序执行
+            iloc.branch("beq", falseLabel);
+        } else {
+            // 如果不等于0，跳转到trueLabel
+            iloc.branch("bne", trueLabel);
+
+            // 否则跳转到falseLabel，假分支紧随其后时顺序执行
+            if (nextInst != gotoInst->getFalseTarget()) {
+                iloc.branch("b", falseLabel);
+            }
+        }
         
         // 释放条件寄存器
         simpleRegisterAllocator.free(condition);
-    } else {
-        // 无条件跳转
+    } else if (nextInst != gotoInst->getTarget()) {
+        // 无条件跳转，目标紧随其后时顺序执行
         iloc.jump(gotoInst->getTarget()->getName());
     }
 }
@@ -230,9 +248,22 @@ void InstSelectorArm32::translate_exit(Instruction * inst)
 /// @param inst IR指令
 void InstSelectorArm32::translate_assign(Instruction * inst)
 {
-    Value * result = inst->getOperand(0);
-    Value * arg1 = inst->getOperand(1);
+    auto moveInst = static_cast<MoveInstruction *>(inst);
+
+    if (moveInst->getIsPointerStore()) {
+        translate_store(inst->getOperand(0), inst->getOperand(1));
+    } else if (moveInst->getIsPointerLoad()) {
+        translate_load(inst->getOperand(0), inst->getOperand(1));
+    } else {
+        translate_assign(inst->getOperand(0), inst->getOperand(1));
+    }
+}
 
+/// @brief 赋值翻译成ARM32汇编，不需要构造赋值指令，不会改动操作数的use链
+/// @param result 目的操作数
+/// @param arg1 源操作数
+void InstSelectorArm32::translate_assign(Value * result, Value * arg1)
+{
     int32_t arg1_regId = arg1->getRegId();
     int32_t result_regId = result->getRegId();
 
@@ -261,6 +292,64 @@ void InstSelectorArm32::translate_assign(Instruction * inst)
     }
 }
 
+/// @brief 指针读取*p翻译成ARM32汇编
+/// @param result 目的操作数
+/// @param addr 指针
+void InstSelectorArm32::translate_load(Value * result, Value * addr)
+{
+    int32_t result_regId = result->getRegId();
+
+    // 结果是寄存器变量时直接读到结果寄存器中，否则借助临时寄存器
+    int32_t load_regno = (result_regId != -1) ? result_regId : simpleRegisterAllocator.Allocate();
+
+    // p -> r8
+    iloc.load_var(load_regno, addr);
+
+    // ldr r8,[r8]
+    iloc.inst("ldr", PlatformArm32::regName[load_regno], "[" + PlatformArm32::regName[load_regno] + "]");
+
+    if (result_regId == -1) {
+
+        // r8 -> rs 可能用到r9
+        iloc.store_var(load_regno, result, ARM32_TMP_REG_NO);
+
+        simpleRegisterAllocator.free(load_regno);
+    }
+}
+
+/// @brief 指针存储*p = v翻译成ARM32汇编
+/// @param addr 指针
+/// @param arg1 源操作数
+void InstSelectorArm32::translate_store(Value * addr, Value * arg1)
+{
+    int32_t arg1_regId = arg1->getRegId();
+    int32_t addr_regId = addr->getRegId();
+
+    // 源操作数与指针不是寄存器变量时，分别加载到临时寄存器中
+    int32_t src_regno = arg1_regId;
+    if (src_regno == -1) {
+        src_regno = simpleRegisterAllocator.Allocate();
+        iloc.load_var(src_regno, arg1);
+    }
+
+    int32_t addr_regno = addr_regId;
+    if (addr_regno == -1) {
+        addr_regno = simpleRegisterAllocator.Allocate();
+        iloc.load_var(addr_regno, addr);
+    }
+
+    // str r8,[r9]
+    iloc.inst("str", PlatformArm32::regName[src_regno], "[" + PlatformArm32::regName[addr_regno] + "]");
+
+    if (addr_regId == -1) {
+        simpleRegisterAllocator.free(addr_regno);
+    }
+
+    if (arg1_regId == -1) {
+        simpleRegisterAllocator.free(src_regno);
+    }
+}
+
 /// @brief 二元操作指令翻译成ARM32汇编
 /// @param inst IR指令
 /// @param operator_name 操作码
@@ -370,39 +459,17 @@ void InstSelectorArm32::translate_call(Instruction * inst)
         simpleRegisterAllocator.Allocate(2);
         simpleRegisterAllocator.Allocate(3);
 
-        // 前四个的后面参数采用栈传递
-        int esp = 0;
-        for (int32_t k = 4; k < operandNum; k++) {
+        // 调整过的调用，实参已由调整时插入的赋值指令传送到位，否则按同样的传递位置在这里传送
+        if (!callInst->lowered) {
 
-            auto arg = callInst->getOperand(k);
-
-            // 新建一个内存变量，用于栈传值到形参变量中
-            MemVariable * newVal = func->newMemVariable((Type *) PointerType::get(arg->getType()));
-            newVal->setMemoryAddr(ARM32_SP_REG_NO, esp);
-            esp += 4;
-
-            Instruction * assignInst = new MoveInstruction(func, newVal, arg);
-
-            // 翻译赋值指令
-            translate_assign(assignInst);
-
-            delete assignInst;
-        }
-
-        for (int32_t k = 0; k < operandNum && k < 4; k++) {
-
-            auto arg = callInst->getOperand(k);
-
-            // 检查实参的类型是否是临时变量。
-            // 如果是临时变量，该变量可更改为寄存器变量即可，或者设置寄存器号
-            // 如果不是，则必须开辟一个寄存器变量，然后赋值即可
-
-            Instruction * assignInst = new MoveInstruction(func, PlatformArm32::intRegVal[k], arg);
-
-            // 翻译赋值指令
-            translate_assign(assignInst);
+            // 前四个的后面参数采用栈传递
+            for (int32_t k = PlatformArm32::maxRegArgNum; k < operandNum; k++) {
+                translate_assign(PlatformArm32::getArgValue(func, k), callInst->getOperand(k));
+            }
 
-            delete assignInst;
+            for (int32_t k = 0; k < operandNum && k < PlatformArm32::maxRegArgNum; k++) {
+                translate_assign(PlatformArm32::getArgValue(func, k), callInst->getOperand(k));
+            }
         }
     }
 
@@ -415,16 +482,11 @@ void InstSelectorArm32::translate_call(Instruction * inst)
         simpleRegisterAllocator.free(3);
     }
 
-    // 赋值指令
-    if (callInst->hasResultValue()) {
-
-        // 新建一个赋值操作
-        Instruction * assignInst = new MoveInstruction(func, callInst, PlatformArm32::intRegVal[0]);
-
-        // 翻译赋值指令
-        translate_assign(assignInst);
+    // 赋值指令，调整过的调用在其后已有从r0的赋值指令
+    if (callInst->hasResultValue() && (!callInst->lowered)) {
 
-        delete assignInst;
+        // 翻译赋值
+        translate_assign(callInst, PlatformArm32::getIntRegVal(func, 0));
     }
 
     // 函数调用后清零，使得下次可正常统计
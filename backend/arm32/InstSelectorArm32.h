@@ -60,6 +60,21 @@ protected:
     /// @param inst IR指令
     void translate_assign(Instruction * inst);
 
+    /// @brief 赋值翻译成ARM32汇编，不需要构造赋值指令，不会改动操作数的use链
+    /// @param result 目的操作数
+    /// @param arg1 源操作数
+    void translate_assign(Value * result, Value * arg1);
+
+    /// @brief 指针读取*p翻译成ARM32汇编
+    /// @param result 目的操作数
+    /// @param addr 指针
+    void translate_load(Value * result, Value * addr);
+
+    /// @brief 指针存储*p = v翻译成ARM32汇编
+    /// @param addr 指针
+    /// @param arg1 源操作数
+    void translate_store(Value * addr, Value * arg1);
+
     /// @brief Label指令指令翻译成ARM32汇编
     /// @param inst IR指令
     void translate_label(Instruction * inst);
@@ -349,6 +364,11 @@ protected:
     /// @brief 累计的实参个数
     int32_t realArgCount = 0;
 
+    ///
+    /// @brief 当前翻译指令之后顺序执行的下一条有效指令，没有时为空
+    ///
+    Instruction * nextInst = nullptr;
+
     ///
     /// @brief 显示IR指令内容
     ///
@@ -16,6 +16,7 @@
 #include "PlatformArm32.h"
 
 #include "IntegerType.h"
+#include "Function.h"
 
 const std::string PlatformArm32::regName[PlatformArm32::maxRegNum] = {
     "r0",  // 用于传参或返回值等，不需要栈保护
@@ -37,24 +38,40 @@ const std::string PlatformArm32::regName[PlatformArm32::maxRegNum] = {
     "pc", // r15，程序计数器。PC 存储着下一条将要执行的指令的地址。在执行分支指令时，PC会更新为新的地址。
 };
 
-RegVariable * PlatformArm32::intRegVal[PlatformArm32::maxRegNum] = {
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[0], 0),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[1], 1),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[2], 2),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[3], 3),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[4], 4),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[5], 5),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[6], 6),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[7], 7),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[8], 8),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[9], 9),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[10], 10),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[11], 11),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[12], 12),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[13], 13),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[14], 14),
-    new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[15], 15),
-};
+/// @brief 获取函数内整数寄存器对应的Value
+/// @param func 函数
+/// @param regNo 寄存器编号
+/// @return 寄存器Value
+RegVariable * PlatformArm32::getIntRegVal(Function * func, int32_t regNo)
+{
+    return func->getRegVariable(IntegerType::getTypeInt(), regName[regNo], regNo);
+}
+
+/// @brief 获取函数调用时第index个实参的传递位置
+/// @param func 调用者函数
+/// @param index 实参序号
+/// @return 实参的传递位置
+Value * PlatformArm32::getArgValue(Function * func, int32_t index)
+{
+    if (index < maxRegArgNum) {
+        return getIntRegVal(func, index);
+    }
+
+    // 栈帧空间（低地址在前，高地址在后）
+    // --------------------- sp
+    // 实参栈传递的空间（排除寄存器传递的实参空间）
+    // ---------------------
+    // 需要保存在栈中的局部变量或临时变量或形参对应变量空间
+    // --------------------- fp
+    // 保护寄存器的空间
+    // ---------------------
+
+    // 新建一个内存变量，把实参的值保存到栈中，以便栈传值，其寻址为SP + 非负偏移，目前只支持int类型
+    MemVariable * argVal = func->newMemVariable(IntegerType::getTypeInt());
+    argVal->setMemoryAddr(ARM32_SP_REG_NO, (index - maxRegArgNum) * 4);
+
+    return argVal;
+}
 
 /// @brief 循环左移两位
 /// @param num
@@ -19,6 +19,9 @@
 
 #include "RegVariable.h"
 
+class Function;
+class Value;
+
 // 在操作过程中临时借助的寄存器为ARM32_TMP_REG_NO
 #define ARM32_TMP_REG_NO 10
 
@@ -66,6 +69,20 @@ public:
     /// @brief 寄存器的名字，r0-r15
     static const std::string regName[maxRegNum];
 
-    /// @brief 对寄存器R0分配Value，记录位置
-    static RegVariable * intRegVal[PlatformArm32::maxRegNum];
+    /// @brief 获取函数内整数寄存器对应的Value。
+    /// 寄存器Value按函数持有，不同函数的代码生成可并行进行
+    /// @param func 函数
+    /// @param regNo 寄存器编号
+    /// @return 寄存器Value
+    static RegVariable * getIntRegVal(Function * func, int32_t regNo);
+
+    /// @brief 通过寄存器r0-r3传递的实参个数，其余实参通过栈传递
+    static const int32_t maxRegArgNum = 4;
+
+    /// @brief 获取函数调用时第index个实参的传递位置。
+    /// 前maxRegArgNum个为寄存器，其余为新建的SP + 非负偏移寻址的内存变量
+    /// @param func 调用者函数
+    /// @param index 实参序号
+    /// @return 实参的传递位置
+    static Value * getArgValue(Function * func, int32_t index);
 };
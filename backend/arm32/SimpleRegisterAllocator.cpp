@@ -29,9 +29,12 @@ SimpleRegisterAllocator::SimpleRegisterAllocator()
 ///
 int SimpleRegisterAllocator::Allocate(Value * var, int32_t no)
 {
-    if (var && (var->getLoadRegId() != -1)) {
-        // 该变量已经分配了Load寄存器了，不需要再次分配
-        return var->getLoadRegId();
+    if (var) {
+        auto pIter = findValue(var);
+        if (pIter != regValues.end()) {
+            // 该变量已经分配了Load寄存器了，不需要再次分配
+            return pIter->second;
+        }
     }
 
     int32_t regno = -1;
@@ -67,13 +70,8 @@ int SimpleRegisterAllocator::Allocate(Value * var, int32_t no)
         // 没有可用的寄存器分配，需要溢出一个变量的寄存器
 
         // 溢出的策略：选择最迟加入队列的变量
-        Value * oldestVar = regValues.front();
-
-        // 获取Load寄存器编号，设置该变量不再占用Load寄存器
-        regno = oldestVar->getLoadRegId();
-
-        // 设置该变量不再占用寄存器
-        oldestVar->setLoadRegId(-1);
+        // 获取Load寄存器编号，该变量不再占用Load寄存器
+        regno = regValues.front().second;
 
         // 从队列中删除
         regValues.erase(regValues.begin());
@@ -81,8 +79,7 @@ int SimpleRegisterAllocator::Allocate(Value * var, int32_t no)
 
     if (var) {
         // 加入新的变量
-        var->setLoadRegId(regno);
-        regValues.push_back(var);
+        regValues.emplace_back(var, regno);
     }
 
     return regno;
@@ -112,12 +109,15 @@ void SimpleRegisterAllocator::Allocate(int32_t no)
 ///
 void SimpleRegisterAllocator::free(Value * var)
 {
-    if (var && (var->getLoadRegId() != -1)) {
+    if (var) {
+
+        auto pIter = findValue(var);
+        if (pIter != regValues.end()) {
 
-        // 清除该索引的寄存器，变得可使用
-        regBitmap.reset(var->getLoadRegId());
-        regValues.erase(std::find(regValues.begin(), regValues.end(), var));
-        var->setLoadRegId(-1);
+            // 清除该索引的寄存器，变得可使用
+            regBitmap.reset(pIter->second);
+            regValues.erase(pIter);
+        }
     }
 }
 
@@ -136,13 +136,12 @@ void SimpleRegisterAllocator::free(int32_t no)
     regBitmap.reset(no);
 
     // 查找寄存器编号
-    auto pIter = std::find_if(regValues.begin(), regValues.end(), [=](auto val) {
-        return val->getLoadRegId() == no; // 存器编号与 no 匹配
+    auto pIter = std::find_if(regValues.begin(), regValues.end(), [=](auto & item) {
+        return item.second == no; // 存器编号与 no 匹配
     });
 
     if (pIter != regValues.end()) {
-        // 查找到，则清除，并设置为-1
-        (*pIter)->setLoadRegId(-1);
+        // 查找到，则清除
         regValues.erase(pIter);
     }
 }
@@ -155,4 +154,13 @@ void SimpleRegisterAllocator::bitmapSet(int32_t no)
 {
     regBitmap.set(no);
     usedBitmap.set(no);
-}
\ No newline at end of file
+}
+///
+/// @brief 查找变量占用的寄存器
+/// @param var 变量
+/// @return 在regValues中的位置
+///
+std::vector<std::pair<Value *, int32_t>>::iterator SimpleRegisterAllocator::findValue(Value * var)
+{
+    return std::find_if(regValues.begin(), regValues.end(), [=](auto & item) { return item.first == var; });
+}
@@ -15,9 +15,10 @@
 ///
 #pragma once
 
+#include <utility>
 #include <vector>
 
-#include "BitMap.h"
+#include "BitSet.h"
 #include "Value.h"
 #include "PlatformArm32.h"
 
@@ -63,19 +64,27 @@ protected:
     ///
     void bitmapSet(int32_t no);
 
+    ///
+    /// @brief 查找变量占用的寄存器
+    /// @param var 变量
+    /// @return 在regValues中的位置
+    ///
+    std::vector<std::pair<Value *, int32_t>>::iterator findValue(Value * var);
+
 protected:
     ///
     /// @brief 寄存器位图：1已被占用，0未被使用
     ///
-    BitMap<PlatformArm32::maxUsableRegNum> regBitmap;
+    BitSet regBitmap{PlatformArm32::maxUsableRegNum};
 
     ///
-    /// @brief 寄存器被那个Value占用。按照时间次序加入
+    /// @brief 寄存器被那个Value占用。按照时间次序加入。
+    /// 关联关系保存在分配器内而不是Value上，全局变量、常量等跨函数共享的Value在各函数并行生成代码时不会互相干扰
     ///
-    std::vector<Value *> regValues;
+    std::vector<std::pair<Value *, int32_t>> regValues;
 
     ///
     /// @brief 使用过的所有寄存器编号
     ///
-    BitMap<PlatformArm32::maxUsableRegNum> usedBitmap;
+    BitSet usedBitmap{PlatformArm32::maxUsableRegNum};
 };
@@ -0,0 +1,129 @@
+///
+/// @file BenchGen.cpp
+/// @brief 合成MiniC程序的命令行产生器minic-bench-gen
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <getopt.h>
+
+#include "MiniCGenerator.h"
+
+/// @brief 只有长选项的选项值
+enum GenOption {
+    OPT_BASIC = 256,
+    OPT_SEED,
+    OPT_AXIS,
+};
+
+static struct option long_options[] = {
+    {"help", no_argument, 0, 'h'},
+    {"output", required_argument, 0, 'o'},
+    {"functions", required_argument, 0, OPT_AXIS},
+    {"statements", required_argument, 0, OPT_AXIS},
+    {"expr-depth", required_argument, 0, OPT_AXIS},
+    {"nest-depth", required_argument, 0, OPT_AXIS},
+    {"array-rank", required_argument, 0, OPT_AXIS},
+    {"fan-out", required_argument, 0, OPT_AXIS},
+    {"basic", no_argument, 0, OPT_BASIC},
+    {"seed", required_argument, 0, OPT_SEED},
+    {0, 0, 0, 0}
+};
+
+/// @brief 显示帮助
+/// @param exeName 程序名
+static void showHelp(const std::string & exeName)
+{
+    MiniCGenerator::Shape shape;
+
+    std::cout << exeName + " [options] [-o output]\n";
+    std::cout << "Generate a synthetic MiniC program; every axis scales independently of the others.\n";
+    std::cout << "Options:\n";
+    std::cout << "  -h, --help                 Show this help message\n";
+    std::cout << "  -o, --output=FILE          Write the program to FILE instead of stdout\n";
+    std::cout << "      --functions=N          Number of functions in a call chain (default " << shape.functions << ")\n";
+    std::cout << "      --statements=N         Statements per function (default " << shape.statements << ")\n";
+    std::cout << "      --expr-depth=N         Operator nesting depth of each expression (default " << shape.exprDepth
+              << ")\n";
+    std::cout << "      --nest-depth=N         Nesting depth of blocks and loops per function (default "
+              << shape.nestDepth << ")\n";
+    std::cout << "      --array-rank=N         Rank of the local array of each function, 0 for none (default "
+              << shape.arrayRank << ")\n";
+    std::cout << "      --fan-out=N            Number of distinct leaf functions main calls (default " << shape.fanOut
+              << ")\n";
+    std::cout << "      --basic                Use only the grammar the flex/bison front end accepts\n";
+    std::cout << "      --seed=N               Random seed (default " << shape.seed << ")\n";
+}
+
+/// @brief 主程序
+/// @param argc
+/// @param argv
+/// @return 0 成功
+int main(int argc, char * argv[])
+{
+    MiniCGenerator::Shape shape;
+    std::string outputFile;
+
+    int ch;
+    int option_index = 0;
+
+    while ((ch = getopt_long(argc, argv, "ho:", long_options, &option_index)) != -1) {
+        switch (ch) {
+            case 'h':
+                showHelp(argv[0]);
+                return 0;
+            case 'o':
+                outputFile = optarg;
+                break;
+            case OPT_AXIS: {
+                int value = std::atoi(optarg);
+                if (value < 0) {
+                    showHelp(argv[0]);
+                    return -1;
+                }
+                MiniCGenerator::setAxis(shape, long_options[option_index].name, value);
+                break;
+            }
+            case OPT_BASIC:
+                shape.basic = true;
+                break;
+            case OPT_SEED:
+                shape.seed = (uint32_t) std::strtoul(optarg, nullptr, 10);
+                break;
+            default:
+                showHelp(argv[0]);
+                return -1;
+        }
+    }
+
+    MiniCGenerator generator(shape);
+    std::string program = generator.generate();
+
+    FILE * fp = stdout;
+    if (!outputFile.empty()) {
+        fp = fopen(outputFile.c_str(), "w");
+        if (!fp) {
+            fprintf(stderr, "file %s cannot be opened\n", outputFile.c_str());
+            return -1;
+        }
+    }
+
+    fwrite(program.data(), 1, program.size(), fp);
+
+    if (fp != stdout) {
+        fclose(fp);
+    }
+
+    return 0;
+}
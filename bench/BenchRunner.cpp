@@ -0,0 +1,648 @@
+///
+/// @file BenchRunner.cpp
+/// @brief 编译器吞吐量的基准测试运行器minic-bench
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <getopt.h>
+
+#include "MiniCGenerator.h"
+
+///
+/// @brief 前端的描述
+///
+struct FrontEnd {
+
+    /// @brief 名字
+    const char * name;
+
+    /// @brief 选择该前端的minic选项
+    const char * option;
+
+    /// @brief 是否只能分析基本方言
+    bool basic;
+};
+
+/// @brief 所有的前端
+static const FrontEnd gAllFrontEnds[] = {
+    {"rd", "-D", false},
+    {"antlr4", "-A", false},
+    {"flex-bison", "-F", true},
+};
+
+///
+/// @brief 规模轴的扫描：起始值，每步翻倍
+///
+struct AxisSweep {
+
+    /// @brief 轴的名字
+    const char * axis;
+
+    /// @brief 起始值
+    int32_t start;
+};
+
+/// @brief 各轴的缺省起始值，其余轴取产生器的缺省值
+static const AxisSweep gSweeps[] = {
+    {"functions", 64},
+    {"statements", 64},
+    {"expr-depth", 16},
+    {"nest-depth", 4},
+    {"array-rank", 1},
+    {"fan-out", 64},
+};
+
+///
+/// @brief 一次编译的测量结果，取自minic的--time-report=json与--mem-report=json
+///
+struct Sample {
+
+    /// @brief 编译是否成功
+    bool ok = false;
+
+    /// @brief 各阶段名与墙上时间(秒)
+    std::vector<std::pair<std::string, double>> phases;
+
+    /// @brief 各阶段的墙上时间合计(秒)，不含进程的启动与退出
+    double wallSeconds = 0;
+
+    /// @brief 进程的内存峰值(KB)
+    long peakRssKB = 0;
+
+    /// @brief 各阶段的内存峰值增长合计(KB)
+    long rssGrowthKB = 0;
+};
+
+///
+/// @brief 曲线上的一个点
+///
+struct Point {
+
+    /// @brief 轴的值
+    int32_t size;
+
+    /// @brief 测量结果
+    Sample sample;
+};
+
+/// @brief minic可执行程序
+static std::string gMinic;
+
+/// @brief 产生的程序与编译输出所在的工作目录
+static std::string gWorkDir = "bench-work";
+
+/// @brief 参与测量的前端，为空时取全部
+static std::vector<std::string> gFrontEnds;
+
+/// @brief 参与测量的轴，为空时取全部
+static std::vector<std::string> gAxes;
+
+/// @brief 每个轴的点数
+static int32_t gSteps = 4;
+
+/// @brief 起始值的倍数
+static int32_t gScale = 1;
+
+/// @brief 每个点重复编译的次数，取最快的一次
+static int32_t gRepeat = 3;
+
+/// @brief 优化级别
+static int32_t gOptLevel = 0;
+
+/// @brief 允许的最大增长指数，超过则认为是超线性的
+static double gMaxExponent = 1.5;
+
+/// @brief 时间低于该值(秒)时噪声太大，不做增长与回退的判断
+static double gMinSeconds = 0.005;
+
+/// @brief 内存增长低于该值(KB)时不做增长与回退的判断
+static long gMinRssKB = 1024;
+
+/// @brief 与基准相比允许的回退百分比
+static double gTolerance = 25;
+
+/// @brief 用于比较的基准文件
+static std::string gBaselineFile;
+
+/// @brief 保存本次结果作为基准的文件
+static std::string gSaveBaselineFile;
+
+/// @brief 只有长选项的选项值
+enum RunnerOption {
+    OPT_MINIC = 256,
+    OPT_WORK_DIR,
+    OPT_FRONT_ENDS,
+    OPT_AXES,
+    OPT_STEPS,
+    OPT_SCALE,
+    OPT_REPEAT,
+    OPT_OPT_LEVEL,
+    OPT_MAX_EXPONENT,
+    OPT_MIN_TIME,
+    OPT_TOLERANCE,
+    OPT_BASELINE,
+    OPT_SAVE_BASELINE,
+};
+
+static struct option long_options[] = {
+    {"help", no_argument, 0, 'h'},
+    {"minic", required_argument, 0, OPT_MINIC},
+    {"work-dir", required_argument, 0, OPT_WORK_DIR},
+    {"front-ends", required_argument, 0, OPT_FRONT_ENDS},
+    {"axes", required_argument, 0, OPT_AXES},
+    {"steps", required_argument, 0, OPT_STEPS},
+    {"scale", required_argument, 0, OPT_SCALE},
+    {"repeat", required_argument, 0, OPT_REPEAT},
+    {"opt-level", required_argument, 0, OPT_OPT_LEVEL},
+    {"max-exponent", required_argument, 0, OPT_MAX_EXPONENT},
+    {"min-time", required_argument, 0, OPT_MIN_TIME},
+    {"tolerance", required_argument, 0, OPT_TOLERANCE},
+    {"baseline", required_argument, 0, OPT_BASELINE},
+    {"save-baseline", required_argument, 0, OPT_SAVE_BASELINE},
+    {0, 0, 0, 0}
+};
+
+/// @brief 显示帮助
+/// @param exeName 程序名
+static void showHelp(const std::string & exeName)
+{
+    std::cout << exeName + " --minic=PATH [options]\n";
+    std::cout << "Compile synthetic programs of doubling size along each axis with every front end, report the\n";
+    std::cout << "per-phase time and memory curves, and fail on superlinear growth or regressions.\n";
+    std::cout << "Options:\n";
+    std::cout << "  -h, --help                 Show this help message\n";
+    std::cout << "      --minic=PATH           The compiler to measure\n";
+    std::cout << "      --work-dir=DIR         Directory for generated programs and outputs (default bench-work)\n";
+    std::cout << "      --front-ends=LIST      Comma-separated subset of rd,antlr4,flex-bison (default all)\n";
+    std::cout << "      --axes=LIST            Comma-separated subset of functions,statements,expr-depth,\n";
+    std::cout << "                             nest-depth,array-rank,fan-out (default all)\n";
+    std::cout << "      --steps=N              Points per axis, each double the previous (default 4)\n";
+    std::cout << "      --scale=N              Multiply the starting size of every axis by N (default 1)\n";
+    std::cout << "      --repeat=N             Compile each point N times and keep the fastest (default 3)\n";
+    std::cout << "      --opt-level=N          Pass -ON to minic (default 0)\n";
+    std::cout << "      --max-exponent=X       Fail when time or memory grows faster than size^X (default 1.5)\n";
+    std::cout << "      --min-time=SECONDS     Ignore points faster than this as noise (default 0.005)\n";
+    std::cout << "      --tolerance=PCT        Fail when a point is PCT percent slower or larger than the\n";
+    std::cout << "                             baseline (default 25)\n";
+    std::cout << "      --baseline=FILE        Compare against a file written by --save-baseline\n";
+    std::cout << "      --save-baseline=FILE   Save this run's results as a baseline\n";
+}
+
+/// @brief 逗号分隔的列表
+/// @param text 文本
+/// @return std::vector<std::string> 各项
+static std::vector<std::string> splitList(const std::string & text)
+{
+    std::vector<std::string> items;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+
+    return items;
+}
+
+/// @brief 参数解析
+/// @param argc
+/// @param argv
+/// @return 0 成功，1 显示帮助，-1 出错
+static int ArgsAnalysis(int argc, char * argv[])
+{
+    int ch;
+    int option_index = 0;
+
+    while ((ch = getopt_long(argc, argv, "h", long_options, &option_index)) != -1) {
+        switch (ch) {
+            case 'h':
+                return 1;
+            case OPT_MINIC:
+                gMinic = optarg;
+                break;
+            case OPT_WORK_DIR:
+                gWorkDir = optarg;
+                break;
+            case OPT_FRONT_ENDS:
+                gFrontEnds = splitList(optarg);
+                break;
+            case OPT_AXES:
+                gAxes = splitList(optarg);
+                break;
+            case OPT_STEPS:
+                gSteps = std::atoi(optarg);
+                break;
+            case OPT_SCALE:
+                gScale = std::atoi(optarg);
+                break;
+            case OPT_REPEAT:
+                gRepeat = std::atoi(optarg);
+                break;
+            case OPT_OPT_LEVEL:
+                gOptLevel = std::atoi(optarg);
+                break;
+            case OPT_MAX_EXPONENT:
+                gMaxExponent = std::atof(optarg);
+                break;
+            case OPT_MIN_TIME:
+                gMinSeconds = std::atof(optarg);
+                break;
+            case OPT_TOLERANCE:
+                gTolerance = std::atof(optarg);
+                break;
+            case OPT_BASELINE:
+                gBaselineFile = optarg;
+                break;
+            case OPT_SAVE_BASELINE:
+                gSaveBaselineFile = optarg;
+                break;
+            default:
+                return -1;
+        }
+    }
+
+    if (gMinic.empty() || gSteps < 2 || gScale < 1 || gRepeat < 1) {
+        return -1;
+    }
+
+    for (auto & name: gFrontEnds) {
+        auto found = std::find_if(std::begin(gAllFrontEnds), std::end(gAllFrontEnds), [&](const FrontEnd & fe) {
+            return name == fe.name;
+        });
+        if (found == std::end(gAllFrontEnds)) {
+            return -1;
+        }
+    }
+
+    auto & axisNames = MiniCGenerator::axisNames();
+    for (auto & axis: gAxes) {
+        if (std::find(axisNames.begin(), axisNames.end(), axis) == axisNames.end()) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/// @brief 从JSON的一行中取指定键的数值，minic输出的统计每个对象占一行
+/// @param line 一行
+/// @param key 键
+/// @param value 值
+/// @return true 找到
+static bool jsonNumber(const std::string & line, const std::string & key, double & value)
+{
+    std::string pattern = "\"" + key + "\": ";
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos) {
+        return false;
+    }
+
+    value = std::strtod(line.c_str() + pos + pattern.size(), nullptr);
+
+    return true;
+}
+
+/// @brief 从JSON的一行中取指定键的字符串
+/// @param line 一行
+/// @param key 键
+/// @param value 值
+/// @return true 找到
+static bool jsonString(const std::string & line, const std::string & key, std::string & value)
+{
+    std::string pattern = "\"" + key + "\": \"";
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos) {
+        return false;
+    }
+
+    size_t begin = pos + pattern.size();
+    size_t end = line.find('"', begin);
+    if (end == std::string::npos) {
+        return false;
+    }
+
+    value = line.substr(begin, end - begin);
+
+    return true;
+}
+
+/// @brief 解析minic输出的编译阶段统计
+/// @param reportFile 统计文件
+/// @param sample 测量结果
+/// @return true 成功
+static bool parseReport(const std::string & reportFile, Sample & sample)
+{
+    std::ifstream in(reportFile);
+    if (!in) {
+        return false;
+    }
+
+    bool hasTotal = false;
+    std::string line;
+    while (std::getline(in, line)) {
+
+        std::string name;
+        double wall = 0;
+        double rss = 0;
+
+        if (jsonString(line, "name", name) && jsonNumber(line, "wall_seconds", wall)) {
+            if (name == "total") {
+                sample.wallSeconds = wall;
+                if (jsonNumber(line, "peak_rss_delta_kb", rss)) {
+                    sample.rssGrowthKB = (long) rss;
+                }
+                hasTotal = true;
+            } else {
+                sample.phases.emplace_back(name, wall);
+            }
+        } else if (jsonNumber(line, "peak_rss_kb", rss)) {
+            sample.peakRssKB = (long) rss;
+        }
+    }
+
+    return hasTotal;
+}
+
+/// @brief 命令行参数加上双引号
+/// @param arg 参数
+/// @return std::string 加引号后的参数
+static std::string quote(const std::string & arg)
+{
+    return "\"" + arg + "\"";
+}
+
+/// @brief 产生程序并编译，重复多次取最快的一次
+/// @param fe 前端
+/// @param shape 程序的规模
+/// @param name 文件名，不含后缀
+/// @param sample 测量结果
+static void measure(const FrontEnd & fe, MiniCGenerator::Shape shape, const std::string & name, Sample & sample)
+{
+    shape.basic = fe.basic;
+
+    std::string source = gWorkDir + "/" + name + ".c";
+    std::string output = gWorkDir + "/" + name + ".s";
+    std::string report = gWorkDir + "/" + name + ".json";
+
+    {
+        MiniCGenerator generator(shape);
+        std::ofstream out(source, std::ios::binary | std::ios::trunc);
+        out << generator.generate();
+    }
+
+    std::string command = quote(gMinic) + " -S " + fe.option + " -O" + std::to_string(gOptLevel) +
+                          " --time-report=json --mem-report=json -o " + quote(output) + " " + quote(source) + " 2> " +
+                          quote(report);
+
+    sample = Sample();
+
+    for (int32_t k = 0; k < gRepeat; ++k) {
+
+        Sample current;
+        current.ok = (std::system(command.c_str()) == 0) && parseReport(report, current);
+
+        if (!current.ok) {
+            // 前端不支持产生的程序或者编译失败，不再重复
+            sample.ok = false;
+            return;
+        }
+
+        if (!sample.ok || current.wallSeconds < sample.wallSeconds) {
+            long peak = std::max(sample.peakRssKB, current.peakRssKB);
+            sample = current;
+            sample.peakRssKB = peak;
+        }
+    }
+}
+
+/// @brief 两点之间的增长指数：值按size的多少次方增长
+/// @param size0 较小的规模
+/// @param value0 较小规模的值
+/// @param size1 较大的规模
+/// @param value1 较大规模的值
+/// @return double 指数
+static double growthExponent(int32_t size0, double value0, int32_t size1, double value1)
+{
+    if (value0 <= 0 || value1 <= 0 || size1 <= size0) {
+        return 0;
+    }
+
+    return std::log(value1 / value0) / std::log((double) size1 / size0);
+}
+
+/// @brief 取阶段的墙上时间
+/// @param sample 测量结果
+/// @param phase 阶段名
+/// @return double 墙上时间，没有该阶段时为0
+static double phaseSeconds(const Sample & sample, const std::string & phase)
+{
+    for (auto & [name, wall]: sample.phases) {
+        if (name == phase) {
+            return wall;
+        }
+    }
+
+    return 0;
+}
+
+/// @brief 基准的键
+/// @param axis 轴
+/// @param fe 前端
+/// @param size 轴的值
+/// @return std::string 键
+static std::string baselineKey(const std::string & axis, const std::string & fe, int32_t size)
+{
+    return axis + " " + fe + " " + std::to_string(size);
+}
+
+/// @brief 主程序
+/// @param argc
+/// @param argv
+/// @return 0 没有超线性增长与回退，1 有，-1 参数错误
+int main(int argc, char * argv[])
+{
+    int result = ArgsAnalysis(argc, argv);
+    if (result != 0) {
+        showHelp(argv[0]);
+        return result < 0 ? -1 : 0;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(gWorkDir, ec);
+    if (ec) {
+        fprintf(stderr, "work directory %s cannot be created\n", gWorkDir.c_str());
+        return -1;
+    }
+
+    // 基准：键到墙上时间与内存峰值
+    std::map<std::string, std::pair<double, long>> baseline;
+    if (!gBaselineFile.empty()) {
+        std::ifstream in(gBaselineFile);
+        if (!in) {
+            fprintf(stderr, "baseline %s cannot be opened\n", gBaselineFile.c_str());
+            return -1;
+        }
+
+        std::string axis, fe;
+        int32_t size;
+        double wall;
+        long rss;
+        while (in >> axis >> fe >> size >> wall >> rss) {
+            baseline[baselineKey(axis, fe, size)] = {wall, rss};
+        }
+    }
+
+    std::ostringstream saved;
+    int32_t failures = 0;
+
+    // 表格中单独列出的阶段，其余阶段只计入合计
+    static const char * columns[] = {"frontend", "irgen", "optimize", "codegen"};
+
+    for (auto & sweep: gSweeps) {
+
+        std::string axis = sweep.axis;
+        if (!gAxes.empty() && std::find(gAxes.begin(), gAxes.end(), axis) == gAxes.end()) {
+            continue;
+        }
+
+        printf("=== %s ===\n", axis.c_str());
+        printf("  %-11s %8s %10s", "front-end", "size", "total(s)");
+        for (auto column: columns) {
+            printf(" %10s", column);
+        }
+        printf(" %12s %12s\n", "PeakRSS(KB)", "RSS+(KB)");
+
+        for (auto & fe: gAllFrontEnds) {
+
+            if (!gFrontEnds.empty() && std::find(gFrontEnds.begin(), gFrontEnds.end(), fe.name) == gFrontEnds.end()) {
+                continue;
+            }
+
+            if (fe.basic && !MiniCGenerator::basicSupportsAxis(axis)) {
+                printf("  %-11s skipped: the grammar has no %s\n", fe.name, axis.c_str());
+                continue;
+            }
+
+            std::vector<Point> points;
+
+            int32_t size = sweep.start * gScale;
+            for (int32_t step = 0; step < gSteps; ++step, size *= 2) {
+
+                MiniCGenerator::Shape shape;
+                MiniCGenerator::setAxis(shape, axis, size);
+
+                Point point{size, Sample()};
+                measure(fe, shape, axis + "-" + fe.name + "-" + std::to_string(size), point.sample);
+
+                if (!point.sample.ok) {
+                    printf("  %-11s %8d   failed: the compiler rejected the program\n", fe.name, size);
+                    break;
+                }
+
+                const Sample & s = point.sample;
+                printf("  %-11s %8d %10.6f", fe.name, size, s.wallSeconds);
+                for (auto column: columns) {
+                    printf(" %10.6f", phaseSeconds(s, column));
+                }
+                printf(" %12ld %12ld\n", s.peakRssKB, s.rssGrowthKB);
+
+                saved << axis << " " << fe.name << " " << size << " " << s.wallSeconds << " " << s.peakRssKB << "\n";
+
+                // 与基准比较
+                auto iter = baseline.find(baselineKey(axis, fe.name, size));
+                if (iter != baseline.end()) {
+                    double baseWall = iter->second.first;
+                    long baseRss = iter->second.second;
+
+                    if (s.wallSeconds > baseWall * (1 + gTolerance / 100) && s.wallSeconds - baseWall > gMinSeconds) {
+                        printf("  REGRESSION %s %s %d: time %.6f s, baseline %.6f s\n",
+                               axis.c_str(),
+                               fe.name,
+                               size,
+                               s.wallSeconds,
+                               baseWall);
+                        failures++;
+                    }
+
+                    if (s.peakRssKB > baseRss * (1 + gTolerance / 100) && s.peakRssKB - baseRss > gMinRssKB) {
+                        printf("  REGRESSION %s %s %d: peak RSS %ld KB, baseline %ld KB\n",
+                               axis.c_str(),
+                               fe.name,
+                               size,
+                               s.peakRssKB,
+                               baseRss);
+                        failures++;
+                    }
+                }
+
+                points.push_back(point);
+            }
+
+            if (points.size() < 2) {
+                continue;
+            }
+
+            // 最大的两个点受进程启动等固定开销的影响最小，用来判断增长的阶数
+            const Point & p0 = points[points.size() - 2];
+            const Point & p1 = points.back();
+
+            double timeExponent = growthExponent(p0.size, p0.sample.wallSeconds, p1.size, p1.sample.wallSeconds);
+            double memExponent = growthExponent(p0.size,
+                                                (double) p0.sample.rssGrowthKB,
+                                                p1.size,
+                                                (double) p1.sample.rssGrowthKB);
+
+            printf("  %-11s growth: time ^%.2f, memory ^%.2f;", fe.name, timeExponent, memExponent);
+            for (auto & [phase, wall]: p1.sample.phases) {
+                double exponent = growthExponent(p0.size, phaseSeconds(p0.sample, phase), p1.size, wall);
+                printf(" %s ^%.2f", phase.c_str(), exponent);
+            }
+            printf("\n");
+
+            if (p1.sample.wallSeconds >= gMinSeconds && timeExponent > gMaxExponent) {
+                printf("  SUPERLINEAR %s %s: time grows as size^%.2f\n", axis.c_str(), fe.name, timeExponent);
+                failures++;
+            }
+
+            if (p1.sample.rssGrowthKB >= gMinRssKB && memExponent > gMaxExponent) {
+                printf("  SUPERLINEAR %s %s: memory grows as size^%.2f\n", axis.c_str(), fe.name, memExponent);
+                failures++;
+            }
+        }
+
+        printf("\n");
+        fflush(stdout);
+    }
+
+    if (!gSaveBaselineFile.empty()) {
+        std::ofstream out(gSaveBaselineFile, std::ios::trunc);
+        out << saved.str();
+    }
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,605 @@
+///
+/// @file BitSetCheck.cpp
+/// @brief 位集合的随机对照检查minic-bitset-check，以std::set为参照检查BitSet与SparseBitSet的各个运算
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include <getopt.h>
+
+#include "BitSet.h"
+#include "SparseBitSet.h"
+
+/// @brief 参照模型：元素的范围与有序的元素
+struct RefSet {
+
+    /// @brief 元素的范围[0, size)，SparseBitSet不使用
+    uint32_t size = 0;
+
+    /// @brief 元素
+    std::set<uint32_t> elems;
+};
+
+/// @brief 随机种子
+static uint32_t gSeed = 1;
+
+/// @brief 随机运算的轮数
+static uint32_t gRounds = 20000;
+
+/// @brief 随机数产生器
+static std::mt19937 gRand;
+
+/// @brief 发现的不一致个数
+static uint32_t gFailures = 0;
+
+/// @brief 当前的轮次与运算，出错时显示
+static uint32_t gRound = 0;
+static const char * gOpName = "";
+
+enum {
+    OPT_SEED = 256,
+    OPT_ROUNDS,
+};
+
+static struct option long_options[] = {
+    {"help", no_argument, 0, 'h'},
+    {"seed", required_argument, 0, OPT_SEED},
+    {"rounds", required_argument, 0, OPT_ROUNDS},
+    {0, 0, 0, 0}
+};
+
+/// @brief 显示帮助
+/// @param exeName 程序名
+static void showHelp(const std::string & exeName)
+{
+    std::cout << exeName + " [options]\n";
+    std::cout << "Apply random operations to BitSet and SparseBitSet and compare every result with std::set.\n";
+    std::cout << "Options:\n";
+    std::cout << "  -h, --help                 Show this help message\n";
+    std::cout << "      --seed=N               Random seed (default 1)\n";
+    std::cout << "      --rounds=N             Number of random operations per set kind (default 20000)\n";
+}
+
+/// @brief 参数解析
+/// @param argc
+/// @param argv
+/// @return 0 成功，1 显示帮助，-1 出错
+static int ArgsAnalysis(int argc, char * argv[])
+{
+    int ch;
+    int option_index = 0;
+
+    while ((ch = getopt_long(argc, argv, "h", long_options, &option_index)) != -1) {
+        switch (ch) {
+            case 'h':
+                return 1;
+            case OPT_SEED:
+                gSeed = (uint32_t) std::strtoul(optarg, nullptr, 10);
+                break;
+            case OPT_ROUNDS:
+                gRounds = (uint32_t) std::strtoul(optarg, nullptr, 10);
+                break;
+            default:
+                return -1;
+        }
+    }
+
+    return 0;
+}
+
+/// @brief [0, n)之间的随机数
+/// @param n 上界，需大于0
+/// @return uint32_t 随机数
+static uint32_t randBelow(uint32_t n)
+{
+    return std::uniform_int_distribution<uint32_t>(0, n - 1)(gRand);
+}
+
+/// @brief 记录不一致
+/// @param what 不一致的内容
+static void fail(const std::string & what)
+{
+    if (gFailures++ < 20) {
+        fprintf(stderr, "round %u, %s: %s\n", gRound, gOpName, what.c_str());
+    }
+}
+
+/// @brief 参照集合变换成toString的格式
+/// @param ref 参照集合
+/// @return std::string 字符串
+static std::string refString(const RefSet & ref)
+{
+    std::string str;
+    for (uint32_t n: ref.elems) {
+        str += std::to_string(n);
+        str += ' ';
+    }
+
+    return str;
+}
+
+/// @brief 检查BitSet的全部查询与参照一致
+/// @param set 位集合
+/// @param ref 参照集合
+/// @param name 集合名
+static void checkBitSet(const BitSet & set, const RefSet & ref, const std::string & name)
+{
+    if (set.size() != ref.size) {
+        fail(name + " size " + std::to_string(set.size()) + " != " + std::to_string(ref.size));
+        return;
+    }
+
+    // 超出范围的若干元素也要测试，应不在集合中
+    for (uint32_t n = 0; n < ref.size + 70; ++n) {
+        if (set.test(n) != (ref.elems.count(n) != 0)) {
+            fail(name + " test(" + std::to_string(n) + ")");
+            return;
+        }
+    }
+
+    if (set.count() != ref.elems.size()) {
+        fail(name + " count " + std::to_string(set.count()) + " != " + std::to_string(ref.elems.size()));
+    }
+
+    if (set.empty() != ref.elems.empty()) {
+        fail(name + " empty");
+    }
+
+    std::vector<uint32_t> expected(ref.elems.begin(), ref.elems.end());
+
+    std::vector<uint32_t> visited;
+    for (int32_t n = set.findFirst(); n != -1; n = set.findNext((uint32_t) n)) {
+        visited.push_back((uint32_t) n);
+        if (visited.size() > expected.size()) {
+            break;
+        }
+    }
+    if (visited != expected) {
+        fail(name + " findFirst/findNext");
+    }
+
+    visited.clear();
+    set.forEach([&visited](uint32_t n) { visited.push_back(n); });
+    if (visited != expected) {
+        fail(name + " forEach");
+    }
+
+    if (set.toString() != refString(ref)) {
+        fail(name + " toString");
+    }
+
+    // 最后一个字中超出范围的位必须为0，否则补集与比较会出错
+    auto & words = set.getWords();
+    if (words.size() != (ref.size + BitSet::WORD_BITS - 1) / BitSet::WORD_BITS) {
+        fail(name + " word count");
+    } else if ((ref.size % BitSet::WORD_BITS) && (words.back() >> (ref.size % BitSet::WORD_BITS))) {
+        fail(name + " unused bits not cleared");
+    }
+}
+
+/// @brief 检查SparseBitSet的全部查询与参照一致
+/// @param set 稀疏位集合
+/// @param ref 参照集合
+/// @param limit 测试test的范围
+/// @param name 集合名
+static void checkSparse(const SparseBitSet & set, const RefSet & ref, uint32_t limit, const std::string & name)
+{
+    for (uint32_t n = 0; n < limit; ++n) {
+        if (set.test(n) != (ref.elems.count(n) != 0)) {
+            fail(name + " test(" + std::to_string(n) + ")");
+            return;
+        }
+    }
+
+    if (set.count() != ref.elems.size()) {
+        fail(name + " count " + std::to_string(set.count()) + " != " + std::to_string(ref.elems.size()));
+    }
+
+    if (set.empty() != ref.elems.empty()) {
+        fail(name + " empty");
+    }
+
+    std::vector<uint32_t> expected(ref.elems.begin(), ref.elems.end());
+    std::vector<uint32_t> visited;
+    set.forEach([&visited](uint32_t n) { visited.push_back(n); });
+    if (visited != expected) {
+        fail(name + " forEach");
+    }
+
+    if (set.toString() != refString(ref)) {
+        fail(name + " toString");
+    }
+}
+
+/// @brief 检查返回的改变标志
+/// @param changed 运算返回的标志
+/// @param before 运算前的参照
+/// @param after 运算后的参照
+static void checkChanged(bool changed, const RefSet & before, const RefSet & after)
+{
+    if (changed != (before.elems != after.elems)) {
+        fail(std::string("changed flag ") + (changed ? "true" : "false"));
+    }
+}
+
+/// @brief 随机元素范围，包含0、字的边界附近以及跨越多个SIMD宽度的范围
+/// @return uint32_t 范围
+static uint32_t randomSize()
+{
+    static const uint32_t edges[] = {0, 1, 63, 64, 65, 127, 128, 129, 255, 256, 257, 511, 512, 513};
+
+    if (randBelow(4) == 0) {
+        return edges[randBelow(sizeof(edges) / sizeof(edges[0]))];
+    }
+
+    return randBelow(700);
+}
+
+/// @brief 随机填充集合，密度也是随机的，以产生全0、全1以及稀疏的字
+/// @param set 位集合
+/// @param ref 参照集合
+static void randomFill(BitSet & set, RefSet & ref)
+{
+    uint32_t density = randBelow(5);
+
+    for (uint32_t n = 0; n < ref.size; ++n) {
+        bool in = (density == 4) || ((density != 0) && (randBelow(4) < density));
+        if (in) {
+            set.set(n);
+            ref.elems.insert(n);
+        }
+    }
+}
+
+/// @brief 对BitSet做随机运算并与参照对照
+static void checkBitSets()
+{
+    const uint32_t poolSize = 4;
+
+    std::vector<BitSet> sets(poolSize);
+    std::vector<RefSet> refs(poolSize);
+
+    for (gRound = 0; gRound < gRounds; ++gRound) {
+
+        uint32_t a = randBelow(poolSize);
+        uint32_t b = randBelow(poolSize);
+
+        BitSet & x = sets[a];
+        RefSet & rx = refs[a];
+
+        // 另一个操作数先复制，a与b相同时也能检查与自身的运算
+        BitSet y = sets[b];
+        RefSet ry = refs[b];
+
+        RefSet before = rx;
+
+        switch (randBelow(16)) {
+            case 0: {
+                gOpName = "construct";
+                bool val = randBelow(2) != 0;
+                rx.size = randomSize();
+                rx.elems.clear();
+                for (uint32_t n = 0; val && (n < rx.size); ++n) {
+                    rx.elems.insert(n);
+                }
+                x = BitSet(rx.size, val);
+                break;
+            }
+            case 1: {
+                gOpName = "fill";
+                rx.size = randomSize();
+                rx.elems.clear();
+                x = BitSet(rx.size);
+                randomFill(x, rx);
+                break;
+            }
+            case 2:
+                gOpName = "set/reset";
+                for (uint32_t k = 0; (k < 8) && rx.size; ++k) {
+                    uint32_t n = randBelow(rx.size);
+                    if (randBelow(2)) {
+                        x.set(n);
+                        rx.elems.insert(n);
+                    } else {
+                        x.reset(n);
+                        rx.elems.erase(n);
+                    }
+                }
+                break;
+            case 3: {
+                gOpName = "setRange";
+                uint32_t from = randBelow(rx.size + 80);
+                uint32_t to = randBelow(rx.size + 80);
+                x.setRange(from, to);
+                for (uint32_t n = from; (n < to) && (n < rx.size); ++n) {
+                    rx.elems.insert(n);
+                }
+                break;
+            }
+            case 4:
+                gOpName = "setAll";
+                x.setAll();
+                for (uint32_t n = 0; n < rx.size; ++n) {
+                    rx.elems.insert(n);
+                }
+                break;
+            case 5:
+                gOpName = "clear";
+                x.clear();
+                rx.elems.clear();
+                break;
+            case 6: {
+                gOpName = "resize";
+                uint32_t size = randomSize();
+                bool val = randBelow(2) != 0;
+                x.resize(size, val);
+                rx.elems.erase(rx.elems.lower_bound(size), rx.elems.end());
+                for (uint32_t n = rx.size; val && (n < size); ++n) {
+                    rx.elems.insert(n);
+                }
+                rx.size = size;
+                break;
+            }
+            case 7: {
+                gOpName = "unionWith";
+                bool changed = x.unionWith(y);
+                rx.size = std::max(rx.size, ry.size);
+                rx.elems.insert(ry.elems.begin(), ry.elems.end());
+                checkChanged(changed, before, rx);
+                break;
+            }
+            case 8: {
+                gOpName = "intersectWith";
+                bool changed = x.intersectWith(y);
+                std::set<uint32_t> result;
+                std::set_intersection(rx.elems.begin(),
+                                      rx.elems.end(),
+                                      ry.elems.begin(),
+                                      ry.elems.end(),
+                                      std::inserter(result, result.end()));
+                rx.elems.swap(result);
+                checkChanged(changed, before, rx);
+                break;
+            }
+            case 9: {
+                gOpName = "subtract";
+                bool changed = x.subtract(y);
+                for (uint32_t n: ry.elems) {
+                    rx.elems.erase(n);
+                }
+                checkChanged(changed, before, rx);
+                break;
+            }
+            case 10: {
+                gOpName = "intersects";
+                bool common = std::any_of(rx.elems.begin(), rx.elems.end(), [&ry](uint32_t n) {
+                    return ry.elems.count(n) != 0;
+                });
+                if (x.intersects(y) != common) {
+                    fail("intersects");
+                }
+                break;
+            }
+            case 11: {
+                gOpName = "xor";
+                x ^= y;
+                rx.size = std::max(rx.size, ry.size);
+                for (uint32_t n: ry.elems) {
+                    if (!rx.elems.erase(n)) {
+                        rx.elems.insert(n);
+                    }
+                }
+                break;
+            }
+            case 12: {
+                gOpName = "complement";
+                x = ~x;
+                std::set<uint32_t> result;
+                for (uint32_t n = 0; n < rx.size; ++n) {
+                    if (!rx.elems.count(n)) {
+                        result.insert(n);
+                    }
+                }
+                rx.elems.swap(result);
+                break;
+            }
+            case 13:
+                gOpName = "equal";
+                if ((x == y) != (rx.elems == ry.elems) || (x != y) != (rx.elems != ry.elems)) {
+                    fail("operator==");
+                }
+                break;
+            case 14: {
+                gOpName = "binary operators";
+                BitSet u = x | y;
+                BitSet i = x & y;
+                BitSet d = x - y;
+                BitSet e = x ^ y;
+
+                // 按各自的含义由复合赋值运算的结果对照
+                BitSet u2 = x;
+                u2.unionWith(y);
+                BitSet i2 = x;
+                i2.intersectWith(y);
+                BitSet d2 = x;
+                d2.subtract(y);
+                BitSet e2 = x;
+                e2 ^= y;
+                if ((u != u2) || (i != i2) || (d != d2) || (e != e2)) {
+                    fail("binary operators differ from compound assignment");
+                }
+                break;
+            }
+            default:
+                gOpName = "fixpoint";
+
+                // 数据流迭代的用法：重复并入同一集合，第二次不应报告改变
+                x.unionWith(y);
+                if (x.unionWith(y)) {
+                    fail("second unionWith reported a change");
+                }
+                rx.size = std::max(rx.size, ry.size);
+                rx.elems.insert(ry.elems.begin(), ry.elems.end());
+                break;
+        }
+
+        checkBitSet(x, rx, "x");
+    }
+}
+
+/// @brief 对SparseBitSet做随机运算并与参照对照
+static void checkSparseBitSets()
+{
+    const uint32_t poolSize = 4;
+
+    // 元素集中在若干簇中，使得字有共享、相邻以及远离的情况
+    const uint32_t limit = 64 * 40;
+
+    std::vector<SparseBitSet> sets(poolSize);
+    std::vector<RefSet> refs(poolSize);
+
+    for (gRound = 0; gRound < gRounds; ++gRound) {
+
+        uint32_t a = randBelow(poolSize);
+        uint32_t b = randBelow(poolSize);
+
+        SparseBitSet & x = sets[a];
+        RefSet & rx = refs[a];
+
+        SparseBitSet y = sets[b];
+        RefSet ry = refs[b];
+
+        RefSet before = rx;
+
+        switch (randBelow(9)) {
+            case 0:
+            case 1:
+                gOpName = "sparse set/reset";
+                for (uint32_t k = 0; k < 16; ++k) {
+                    uint32_t n = randBelow(8) * 320 + randBelow(130);
+                    if (randBelow(3)) {
+                        x.set(n);
+                        rx.elems.insert(n);
+                    } else {
+                        x.reset(n);
+                        rx.elems.erase(n);
+                    }
+                }
+                break;
+            case 2:
+                gOpName = "sparse clear";
+                x.clear();
+                rx.elems.clear();
+                break;
+            case 3: {
+                gOpName = "sparse unionWith";
+                bool changed = x.unionWith(y);
+                rx.elems.insert(ry.elems.begin(), ry.elems.end());
+                checkChanged(changed, before, rx);
+                break;
+            }
+            case 4: {
+                gOpName = "sparse intersectWith";
+                bool changed = x.intersectWith(y);
+                std::set<uint32_t> result;
+                std::set_intersection(rx.elems.begin(),
+                                      rx.elems.end(),
+                                      ry.elems.begin(),
+                                      ry.elems.end(),
+                                      std::inserter(result, result.end()));
+                rx.elems.swap(result);
+                checkChanged(changed, before, rx);
+                break;
+            }
+            case 5: {
+                gOpName = "sparse subtract";
+                bool changed = x.subtract(y);
+                for (uint32_t n: ry.elems) {
+                    rx.elems.erase(n);
+                }
+                checkChanged(changed, before, rx);
+                break;
+            }
+            case 6: {
+                gOpName = "sparse intersects";
+                bool common = std::any_of(rx.elems.begin(), rx.elems.end(), [&ry](uint32_t n) {
+                    return ry.elems.count(n) != 0;
+                });
+                if (x.intersects(y) != common) {
+                    fail("intersects");
+                }
+                break;
+            }
+            case 7:
+                gOpName = "sparse equal";
+                if ((x == y) != (rx.elems == ry.elems) || (x != y) != (rx.elems != ry.elems)) {
+                    fail("operator==");
+                }
+                break;
+            default: {
+                gOpName = "sparse toBitSet";
+                RefSet dense;
+                dense.size = randBelow(limit);
+                for (uint32_t n: rx.elems) {
+                    if (n < dense.size) {
+                        dense.elems.insert(n);
+                    }
+                }
+                checkBitSet(x.toBitSet(dense.size), dense, "toBitSet");
+                break;
+            }
+        }
+
+        checkSparse(x, rx, limit, "x");
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    int result = ArgsAnalysis(argc, argv);
+    if (result != 0) {
+        showHelp(argv[0]);
+        return result < 0 ? 1 : 0;
+    }
+
+    // 与BitSet.cpp按相同的条件选择实现，各检查程序以不同的编译选项构建
+#if defined(BITSET_NO_SIMD)
+    const char * impl = "scalar";
+#elif defined(__AVX2__)
+    const char * impl = "avx2";
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    const char * impl = "sse2";
+#else
+    const char * impl = "scalar";
+#endif
+
+    gRand.seed(gSeed);
+
+    checkBitSets();
+    checkSparseBitSets();
+
+    if (gFailures) {
+        fprintf(stderr, "%s: %u mismatches with std::set (seed %u)\n", impl, gFailures, gSeed);
+        return 1;
+    }
+
+    printf("%s: %u random operations on BitSet and SparseBitSet match std::set (seed %u)\n", impl, gRounds * 2, gSeed);
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+///
+/// @file MiniCGenerator.cpp
+/// @brief 按规模参数产生合成的MiniC程序，用于编译器吞吐量的基准测试
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include "MiniCGenerator.h"
+
+MiniCGenerator::MiniCGenerator(const Shape & _shape) : shape(_shape), rng(_shape.seed)
+{}
+
+const std::vector<std::string> & MiniCGenerator::axisNames()
+{
+    static const std::vector<std::string> names = {
+        "functions",
+        "statements",
+        "expr-depth",
+        "nest-depth",
+        "array-rank",
+        "fan-out",
+    };
+
+    return names;
+}
+
+bool MiniCGenerator::setAxis(Shape & shape, const std::string & axis, int32_t value)
+{
+    if (axis == "functions") {
+        shape.functions = value;
+    } else if (axis == "statements") {
+        shape.statements = value;
+    } else if (axis == "expr-depth") {
+        shape.exprDepth = value;
+    } else if (axis == "nest-depth") {
+        shape.nestDepth = value;
+    } else if (axis == "array-rank") {
+        shape.arrayRank = value;
+    } else if (axis == "fan-out") {
+        shape.fanOut = value;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool MiniCGenerator::basicSupportsAxis(const std::string & axis)
+{
+    return axis != "array-rank";
+}
+
+int32_t MiniCGenerator::random(int32_t n)
+{
+    return (int32_t) (rng() % (uint32_t) n);
+}
+
+void MiniCGenerator::line(int32_t indent, const std::string & text)
+{
+    out.append((size_t) indent * 4, ' ');
+    out.append(text);
+    out.push_back('\n');
+}
+
+std::string MiniCGenerator::arrayElement()
+{
+    std::string element = "a";
+    for (int32_t k = 0; k < shape.arrayRank; ++k) {
+        element += "[" + std::to_string(random(2)) + "]";
+    }
+
+    return element;
+}
+
+std::string MiniCGenerator::leaf()
+{
+    static const char * basicLeaves[] = {"x", "y", "z"};
+    static const char * fullLeaves[] = {"x", "y", "z", "p", "q"};
+
+    int32_t pick = random(6);
+
+    if (pick == 5) {
+        if (!shape.basic && shape.arrayRank > 0) {
+            return arrayElement();
+        }
+        return std::to_string(random(10));
+    }
+
+    return shape.basic ? basicLeaves[pick % 3] : fullLeaves[pick];
+}
+
+std::string MiniCGenerator::expr(int32_t depth)
+{
+    if (depth <= 0) {
+        return leaf();
+    }
+
+    // 除法与求余可能除0，只用加减乘；向右嵌套使程序的大小与深度成正比
+    static const char * ops[] = {" + ", " - ", " * "};
+    const char * op = ops[random(shape.basic ? 2 : 3)];
+
+    return "(" + leaf() + op + expr(depth - 1) + ")";
+}
+
+void MiniCGenerator::genNest(int32_t level, int32_t indent)
+{
+    if (level >= shape.nestDepth) {
+        line(indent, "x = " + expr(shape.exprDepth) + ";");
+        return;
+    }
+
+    if (shape.basic) {
+        line(indent, "{");
+        genNest(level + 1, indent + 1);
+        line(indent, "}");
+        return;
+    }
+
+    std::string counter = "c" + std::to_string(level);
+
+    if (level % 2 == 0) {
+        // 循环两次，嵌套的循环总次数为2的层数次方
+        line(indent, "{");
+        line(indent + 1, "int " + counter + ";");
+        line(indent + 1, counter + " = 0;");
+        line(indent + 1, "while (" + counter + " < 2) {");
+        line(indent + 2, counter + " = " + counter + " + 1;");
+        genNest(level + 1, indent + 2);
+        line(indent + 1, "}");
+        line(indent, "}");
+    } else {
+        line(indent, "if (x > " + std::to_string(level) + ") {");
+        genNest(level + 1, indent + 1);
+        line(indent, "} else {");
+        line(indent + 1, "y = y - 1;");
+        line(indent, "}");
+    }
+}
+
+void MiniCGenerator::genStatement(int32_t k, int32_t indent)
+{
+    if (shape.basic) {
+        static const char * targets[] = {"x", "y", "z"};
+        line(indent, std::string(targets[k % 3]) + " = " + expr(shape.exprDepth) + ";");
+        return;
+    }
+
+    switch (k % 4) {
+        case 0:
+            line(indent, "x = " + expr(shape.exprDepth) + ";");
+            break;
+        case 1:
+            line(indent, "y = " + expr(shape.exprDepth) + ";");
+            break;
+        case 2:
+            if (shape.arrayRank > 0) {
+                line(indent, arrayElement() + " = " + expr(shape.exprDepth) + ";");
+            } else {
+                line(indent, "z = " + expr(shape.exprDepth) + ";");
+            }
+            break;
+        default:
+            line(indent, "if (x < y) z = " + expr(shape.exprDepth) + "; else x = " + leaf() + ";");
+            break;
+    }
+}
+
+void MiniCGenerator::genFunction(int32_t index)
+{
+    std::string name = "f" + std::to_string(index);
+
+    if (shape.basic) {
+        line(0, "int " + name + "() {");
+        line(1, "int x;");
+        line(1, "int y;");
+        line(1, "int z;");
+        line(1, "x = " + std::to_string(index) + ";");
+        line(1, "y = 1;");
+        line(1, "z = 2;");
+    } else {
+        line(0, "int " + name + "(int p, int q) {");
+        line(1, "int x, y, z;");
+
+        if (shape.arrayRank > 0) {
+            std::string decl = "int a";
+            for (int32_t k = 0; k < shape.arrayRank; ++k) {
+                decl += "[2]";
+            }
+            line(1, decl + ";");
+        }
+
+        line(1, "x = p;");
+        line(1, "y = q;");
+        line(1, "z = " + std::to_string(index) + ";");
+    }
+
+    genNest(0, 1);
+
+    for (int32_t k = 0; k < shape.statements; ++k) {
+        genStatement(k, 1);
+    }
+
+    if (index > 0) {
+        std::string callee = "f" + std::to_string(index - 1);
+        line(1, "x = x + " + callee + (shape.basic ? "();" : "(y, z);"));
+    }
+
+    line(1, "return x;");
+    line(0, "}");
+}
+
+void MiniCGenerator::genLeaf(int32_t index)
+{
+    std::string name = "h" + std::to_string(index);
+
+    if (shape.basic) {
+        line(0, "int " + name + "() {");
+        line(1, "return " + std::to_string(index) + ";");
+    } else {
+        line(0, "int " + name + "(int p) {");
+        line(1, "return p + " + std::to_string(index) + ";");
+    }
+
+    line(0, "}");
+}
+
+void MiniCGenerator::genMain()
+{
+    line(0, "int main() {");
+    line(1, "int s;");
+    line(1, "s = 0;");
+
+    if (shape.functions > 0) {
+        std::string callee = "f" + std::to_string(shape.functions - 1);
+        line(1, "s = s + " + callee + (shape.basic ? "();" : "(1, 2);"));
+    }
+
+    for (int32_t k = 0; k < shape.fanOut; ++k) {
+        std::string callee = "h" + std::to_string(k);
+        line(1, "s = s + " + callee + (shape.basic ? "();" : "(s);"));
+    }
+
+    line(1, "return s;");
+    line(0, "}");
+}
+
+std::string MiniCGenerator::generate()
+{
+    out.clear();
+
+    for (int32_t k = 0; k < shape.functions; ++k) {
+        genFunction(k);
+    }
+
+    for (int32_t k = 0; k < shape.fanOut; ++k) {
+        genLeaf(k);
+    }
+
+    genMain();
+
+    return out;
+}
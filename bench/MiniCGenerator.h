@@ -0,0 +1,146 @@
+///
+/// @file MiniCGenerator.h
+/// @brief 按规模参数产生合成的MiniC程序，用于编译器吞吐量的基准测试
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+///
+/// @brief 合成MiniC程序的产生器。程序的规模沿相互独立的几个轴变化：函数个数、每个函数的语句数、
+/// 表达式深度、语句块与循环的嵌套深度、数组的维数以及调用的扇出，改变一个轴时其它轴保持不变。
+/// 产生的程序能通过语义检查且能终止，同样的参数与种子产生同样的程序。
+/// 基本方言只用Flex+Bison前端支持的文法：无形参的函数、单变量的声明、加减运算、语句块与无参调用
+///
+class MiniCGenerator {
+
+public:
+    /// @brief 程序的规模参数
+    struct Shape {
+
+        /// @brief 函数个数，不含main与被扇出调用的叶子函数
+        int32_t functions = 4;
+
+        /// @brief 每个函数的语句数
+        int32_t statements = 8;
+
+        /// @brief 每个表达式的运算符嵌套深度
+        int32_t exprDepth = 3;
+
+        /// @brief 每个函数中语句块与循环的嵌套深度
+        int32_t nestDepth = 2;
+
+        /// @brief 每个函数中局部数组的维数，0表示没有数组，基本方言中忽略
+        int32_t arrayRank = 1;
+
+        /// @brief main调用的不同叶子函数的个数
+        int32_t fanOut = 2;
+
+        /// @brief 是否只用基本方言
+        bool basic = false;
+
+        /// @brief 随机数种子
+        uint32_t seed = 1;
+    };
+
+    /// @brief 构造函数
+    /// @param _shape 规模参数
+    explicit MiniCGenerator(const Shape & _shape);
+
+    ///
+    /// @brief 产生程序
+    /// @return std::string MiniC源程序
+    ///
+    std::string generate();
+
+    ///
+    /// @brief 所有规模轴的名字，与命令行选项同名
+    /// @return const std::vector<std::string>& 轴的名字
+    ///
+    static const std::vector<std::string> & axisNames();
+
+    ///
+    /// @brief 设置规模参数中指定轴的值
+    /// @param shape 规模参数
+    /// @param axis 轴的名字
+    /// @param value 值
+    /// @return true 成功
+    /// @return false 轴的名字不存在
+    ///
+    static bool setAxis(Shape & shape, const std::string & axis, int32_t value);
+
+    ///
+    /// @brief 基本方言能否改变指定的轴
+    /// @param axis 轴的名字
+    /// @return true 能
+    ///
+    static bool basicSupportsAxis(const std::string & axis);
+
+protected:
+    /// @brief 产生第index个函数，调用第index-1个函数形成调用链
+    /// @param index 函数编号
+    void genFunction(int32_t index);
+
+    /// @brief 产生被main扇出调用的第index个叶子函数
+    /// @param index 叶子函数编号
+    void genLeaf(int32_t index);
+
+    /// @brief 产生main函数
+    void genMain();
+
+    /// @brief 产生函数体中的第k条语句
+    /// @param k 语句编号
+    /// @param indent 缩进层数
+    void genStatement(int32_t k, int32_t indent);
+
+    /// @brief 产生从level层开始的嵌套语句块或循环
+    /// @param level 当前的嵌套层数
+    /// @param indent 缩进层数
+    void genNest(int32_t level, int32_t indent);
+
+    /// @brief 产生指定深度的表达式
+    /// @param depth 运算符嵌套深度
+    /// @return std::string 表达式
+    std::string expr(int32_t depth);
+
+    /// @brief 产生叶子操作数：局部变量或者小的常量
+    /// @return std::string 操作数
+    std::string leaf();
+
+    /// @brief 产生数组元素的访问，下标都是常量，保证不越界
+    /// @return std::string 数组元素
+    std::string arrayElement();
+
+    /// @brief 输出一行
+    /// @param indent 缩进层数
+    /// @param text 内容
+    void line(int32_t indent, const std::string & text);
+
+    /// @brief 取[0, n)之间的随机数
+    /// @param n 上界
+    /// @return int32_t 随机数
+    int32_t random(int32_t n);
+
+private:
+    /// @brief 规模参数
+    Shape shape;
+
+    /// @brief 随机数产生器
+    std::mt19937 rng;
+
+    /// @brief 产生的程序
+    std::string out;
+};
@@ -0,0 +1,580 @@
+///
+/// @file RuntimeBench.cpp
+/// @brief 生成代码运行性能的基准测试运行器minic-runbench
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <getopt.h>
+#include <sys/wait.h>
+
+namespace fs = std::filesystem;
+
+///
+/// @brief 动态指令数的来源
+///
+enum class RunMode {
+
+    /// @brief 有qemu插件与交叉编译器时用qemu，否则用IR解释器
+    AUTO,
+
+    /// @brief minic的IR解释器，统计的是DragonIR指令
+    INTERP,
+
+    /// @brief qemu用户模式加指令计数插件，统计的是ARM32指令
+    QEMU,
+};
+
+///
+/// @brief 一个核心程序在一个优化级别下的结果
+///
+struct LevelResult {
+
+    /// @brief 优化级别
+    int32_t level = 0;
+
+    /// @brief 状态：ok、mismatch、compile-error、build-error、run-error
+    std::string status;
+
+    /// @brief 汇编的指令条数
+    long codeSize = 0;
+
+    /// @brief 动态执行的指令数
+    long long dynInsts = 0;
+};
+
+/// @brief minic可执行程序
+static std::string gMinic;
+
+/// @brief 核心程序所在目录
+static std::string gKernelDir = "kernels";
+
+/// @brief 内置函数实现std.c与std.h所在的目录
+static std::string gRuntimeDir = "runtime";
+
+/// @brief 编译输出与运行结果所在的工作目录
+static std::string gWorkDir = "runbench-work";
+
+/// @brief 参与测量的优化级别
+static std::vector<int32_t> gLevels = {0, 1, 2, 3};
+
+/// @brief 只测量这些核心程序，为空时测量全部
+static std::vector<std::string> gOnly;
+
+/// @brief 动态指令数的来源
+static RunMode gMode = RunMode::AUTO;
+
+/// @brief 产生参考输出的主机C编译器，为空时依次尝试clang与cc
+static std::string gHostCC;
+
+/// @brief ARM32交叉编译器
+static std::string gCrossCC = "arm-linux-gnueabihf-gcc";
+
+/// @brief qemu用户模式程序
+static std::string gQemu = "qemu-arm";
+
+/// @brief qemu的指令计数插件，如contrib/plugins中的libinsn.so
+static std::string gPlugin;
+
+/// @brief 只有长选项的选项值
+enum RuntimeOption {
+    OPT_MINIC = 256,
+    OPT_KERNELS,
+    OPT_RUNTIME,
+    OPT_WORK_DIR,
+    OPT_OPT_LEVELS,
+    OPT_ONLY,
+    OPT_MODE,
+    OPT_HOST_CC,
+    OPT_CROSS_CC,
+    OPT_QEMU,
+    OPT_PLUGIN,
+};
+
+static struct option long_options[] = {
+    {"help", no_argument, 0, 'h'},
+    {"minic", required_argument, 0, OPT_MINIC},
+    {"kernels", required_argument, 0, OPT_KERNELS},
+    {"runtime", required_argument, 0, OPT_RUNTIME},
+    {"work-dir", required_argument, 0, OPT_WORK_DIR},
+    {"opt-levels", required_argument, 0, OPT_OPT_LEVELS},
+    {"only", required_argument, 0, OPT_ONLY},
+    {"mode", required_argument, 0, OPT_MODE},
+    {"host-cc", required_argument, 0, OPT_HOST_CC},
+    {"cross-cc", required_argument, 0, OPT_CROSS_CC},
+    {"qemu", required_argument, 0, OPT_QEMU},
+    {"plugin", required_argument, 0, OPT_PLUGIN},
+    {0, 0, 0, 0}
+};
+
+/// @brief 显示帮助
+/// @param exeName 程序名
+static void showHelp(const std::string & exeName)
+{
+    std::cout << exeName + " --minic=PATH [options]\n";
+    std::cout << "Compile each MiniC kernel at every optimization level, run it, and report dynamic instructions,\n";
+    std::cout << "code size and whether the output matches a host C compiler's build of the same program.\n";
+    std::cout << "Options:\n";
+    std::cout << "  -h, --help                 Show this help message\n";
+    std::cout << "      --minic=PATH           The compiler to measure\n";
+    std::cout << "      --kernels=DIR          Directory of kernel programs *.c (default kernels)\n";
+    std::cout << "      --runtime=DIR          Directory of std.h and std.c for the builtins (default runtime)\n";
+    std::cout << "      --work-dir=DIR         Directory for outputs (default runbench-work)\n";
+    std::cout << "      --opt-levels=LIST      Comma-separated optimization levels (default 0,1,2,3)\n";
+    std::cout << "      --only=LIST            Comma-separated kernel names to run (default all)\n";
+    std::cout << "      --mode=MODE            interp: count DragonIR instructions with minic --interp-profile;\n";
+    std::cout << "                             qemu: count ARM32 instructions with a qemu-user plugin;\n";
+    std::cout << "                             auto (default): qemu when --plugin is given, otherwise interp\n";
+    std::cout << "      --host-cc=CC           Host C compiler for the reference output (default clang, else cc)\n";
+    std::cout << "      --cross-cc=CC          ARM32 cross compiler (default arm-linux-gnueabihf-gcc)\n";
+    std::cout << "      --qemu=PATH            qemu user-mode emulator (default qemu-arm)\n";
+    std::cout << "      --plugin=FILE          qemu instruction-count plugin such as libinsn.so\n";
+}
+
+/// @brief 逗号分隔的列表
+/// @param text 文本
+/// @return std::vector<std::string> 各项
+static std::vector<std::string> splitList(const std::string & text)
+{
+    std::vector<std::string> items;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+
+    return items;
+}
+
+/// @brief 参数解析
+/// @param argc
+/// @param argv
+/// @return 0 成功，1 显示帮助，-1 出错
+static int ArgsAnalysis(int argc, char * argv[])
+{
+    int ch;
+    int option_index = 0;
+
+    while ((ch = getopt_long(argc, argv, "h", long_options, &option_index)) != -1) {
+        switch (ch) {
+            case 'h':
+                return 1;
+            case OPT_MINIC:
+                gMinic = optarg;
+                break;
+            case OPT_KERNELS:
+                gKernelDir = optarg;
+                break;
+            case OPT_RUNTIME:
+                gRuntimeDir = optarg;
+                break;
+            case OPT_WORK_DIR:
+                gWorkDir = optarg;
+                break;
+            case OPT_OPT_LEVELS:
+                gLevels.clear();
+                for (auto & level: splitList(optarg)) {
+                    gLevels.push_back(std::atoi(level.c_str()));
+                }
+                break;
+            case OPT_ONLY:
+                gOnly = splitList(optarg);
+                break;
+            case OPT_MODE:
+                if (std::string(optarg) == "auto") {
+                    gMode = RunMode::AUTO;
+                } else if (std::string(optarg) == "interp") {
+                    gMode = RunMode::INTERP;
+                } else if (std::string(optarg) == "qemu") {
+                    gMode = RunMode::QEMU;
+                } else {
+                    return -1;
+                }
+                break;
+            case OPT_HOST_CC:
+                gHostCC = optarg;
+                break;
+            case OPT_CROSS_CC:
+                gCrossCC = optarg;
+                break;
+            case OPT_QEMU:
+                gQemu = optarg;
+                break;
+            case OPT_PLUGIN:
+                gPlugin = optarg;
+                break;
+            default:
+                return -1;
+        }
+    }
+
+    if (gMinic.empty() || gLevels.empty()) {
+        return -1;
+    }
+
+    if (gMode == RunMode::QEMU && gPlugin.empty()) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/// @brief 命令行参数加上双引号
+/// @param arg 参数
+/// @return std::string 加引号后的参数
+static std::string quote(const std::string & arg)
+{
+    return "\"" + arg + "\"";
+}
+
+/// @brief 通过shell执行命令
+/// @param command 命令
+/// @return int 命令的退出码，不能执行或被信号终止时为-1
+static int run(const std::string & command)
+{
+    int status = std::system(command.c_str());
+    if (status == -1 || !WIFEXITED(status)) {
+        return -1;
+    }
+
+    return WEXITSTATUS(status);
+}
+
+/// @brief 读入整个文件
+/// @param file 文件名
+/// @return std::string 文件内容，不能打开时为空
+static std::string readFile(const std::string & file)
+{
+    std::ifstream in(file, std::ios::binary);
+    std::ostringstream ss;
+    ss << in.rdbuf();
+
+    return ss.str();
+}
+
+/// @brief 命令是否存在
+/// @param program 程序名
+/// @return true 存在
+static bool hasProgram(const std::string & program)
+{
+    return run("command -v " + quote(program) + " > /dev/null 2>&1") == 0;
+}
+
+/// @brief 汇编文件的指令条数：以制表符缩进且不是伪指令或注释的行
+/// @param asmFile 汇编文件
+/// @return long 指令条数
+static long countInstructions(const std::string & asmFile)
+{
+    std::ifstream in(asmFile);
+    std::string line;
+    long count = 0;
+
+    while (std::getline(in, line)) {
+        if (line.size() > 1 && line[0] == '\t' && line[1] != '.' && line[1] != '@') {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/// @brief 取文本中最后一个含有key的行在key之后的整数
+/// @param text 文本
+/// @param key 关键字
+/// @param value 整数
+/// @return true 找到
+static bool lastNumberAfter(const std::string & text, const std::string & key, long long & value)
+{
+    size_t pos = text.rfind(key);
+    if (pos == std::string::npos) {
+        return false;
+    }
+
+    char * end = nullptr;
+    const char * begin = text.c_str() + pos + key.size();
+    value = std::strtoll(begin, &end, 10);
+
+    return end != begin;
+}
+
+///
+/// @brief 交叉编译汇编文件并在qemu中运行，统计ARM32的动态指令数
+/// @param asmFile 汇编文件
+/// @param base 输出文件名的前缀
+/// @param exitCode 程序的退出码
+/// @param dynInsts 动态指令数
+/// @return std::string 状态，成功时为空
+///
+static std::string runQemu(const std::string & asmFile, const std::string & base, int & exitCode, long long & dynInsts)
+{
+    std::string runtime = gRuntimeDir + "/std.c";
+    std::string header = gRuntimeDir + "/std.h";
+
+    std::string exe = base + ".elf";
+    if (run(quote(gCrossCC) + " -static --include " + quote(header) + " -o " + quote(exe) + " " + quote(asmFile) + " " +
+            quote(runtime) + " 2> " + quote(base + ".build.log")) != 0) {
+        return "build-error";
+    }
+
+    std::string log = base + ".insn.log";
+    exitCode = run(quote(gQemu) + " -plugin " + quote(gPlugin) + " -d plugin -D " + quote(log) + " " + quote(exe) +
+                   " > " + quote(base + ".out"));
+    if (exitCode < 0) {
+        return "run-error";
+    }
+
+    // 插件的输出在不同的qemu版本中为"insns: N"或"total insns: N"
+    if (!lastNumberAfter(readFile(log), "insns:", dynInsts)) {
+        return "run-error";
+    }
+
+    return "";
+}
+
+///
+/// @brief 通过minic的IR解释器运行，统计DragonIR的动态指令数
+/// @param source 源程序
+/// @param level 优化级别
+/// @param base 输出文件名的前缀
+/// @param exitCode 程序的退出码
+/// @param dynInsts 动态指令数
+/// @return std::string 状态，成功时为空
+///
+static std::string
+runInterp(const std::string & source, int32_t level, const std::string & base, int & exitCode, long long & dynInsts)
+{
+    std::string profile = base + ".profile";
+
+    exitCode = run(quote(gMinic) + " -S -O" + std::to_string(level) + " --interp-profile " + quote(source) + " > " +
+                   quote(base + ".out") + " 2> " + quote(profile));
+    if (exitCode < 0) {
+        return "run-error";
+    }
+
+    // 解释出错时没有剖析结果
+    if (!lastNumberAfter(readFile(profile), "Total dynamic instructions:", dynInsts)) {
+        return "run-error";
+    }
+
+    return "";
+}
+
+/// @brief 主程序
+/// @param argc
+/// @param argv
+/// @return 0 所有结果都正确，1 有错误或者与参考输出不一致，-1 参数错误
+int main(int argc, char * argv[])
+{
+    int result = ArgsAnalysis(argc, argv);
+    if (result != 0) {
+        showHelp(argv[0]);
+        return result < 0 ? -1 : 0;
+    }
+
+    std::error_code ec;
+    fs::create_directories(gWorkDir, ec);
+    if (ec) {
+        fprintf(stderr, "work directory %s cannot be created\n", gWorkDir.c_str());
+        return -1;
+    }
+
+    // 核心程序，按名字排序使输出稳定
+    std::vector<fs::path> kernels;
+    for (auto & entry: fs::directory_iterator(gKernelDir, ec)) {
+        auto & path = entry.path();
+        if (path.extension() != ".c") {
+            continue;
+        }
+        if (!gOnly.empty() && std::find(gOnly.begin(), gOnly.end(), path.stem().string()) == gOnly.end()) {
+            continue;
+        }
+        kernels.push_back(path);
+    }
+    std::sort(kernels.begin(), kernels.end());
+
+    if (kernels.empty()) {
+        fprintf(stderr, "no kernels found in %s\n", gKernelDir.c_str());
+        return -1;
+    }
+
+    if (gMode == RunMode::AUTO) {
+        gMode = (!gPlugin.empty() && hasProgram(gQemu) && hasProgram(gCrossCC)) ? RunMode::QEMU : RunMode::INTERP;
+    }
+
+    if (gHostCC.empty()) {
+        gHostCC = hasProgram("clang") ? "clang" : "cc";
+    }
+
+    std::string header = gRuntimeDir + "/std.h";
+    std::string runtime = gRuntimeDir + "/std.c";
+
+    // qemu统计的指令含C库的启动与退出，用空程序的指令数扣除
+    long long startupInsts = 0;
+    if (gMode == RunMode::QEMU) {
+
+        std::string base = gWorkDir + "/startup";
+        {
+            std::ofstream out(base + ".c", std::ios::trunc);
+            out << "int main()\n{\n    return 0;\n}\n";
+        }
+
+        int exitCode = 0;
+        std::string status;
+        if (run(quote(gMinic) + " -S -O0 -o " + quote(base + ".s") + " " + quote(base + ".c")) != 0) {
+            status = "compile-error";
+        } else {
+            status = runQemu(base + ".s", base, exitCode, startupInsts);
+        }
+
+        if (!status.empty()) {
+            fprintf(stderr, "the startup program cannot run under %s: %s\n", gQemu.c_str(), status.c_str());
+            return -1;
+        }
+    }
+
+    printf("dynamic instructions: %s\n",
+           gMode == RunMode::QEMU ? "ARM32 under qemu-user, less the C library startup"
+                                  : "DragonIR under minic --interp-profile");
+    printf("reference: %s\n\n", gHostCC.c_str());
+
+    printf("%-12s %4s %-14s %10s %14s %8s %8s\n", "kernel", "-O", "status", "code", "dyn-insts", "code%", "dyn%");
+
+    // 每个优化级别相对于第一个级别的比值，用于计算几何平均
+    std::map<int32_t, std::vector<std::pair<double, double>>> ratios;
+    int32_t failures = 0;
+
+    for (auto & kernel: kernels) {
+
+        std::string name = kernel.stem().string();
+        std::string source = kernel.string();
+
+        // 主机编译器的结果作为参考输出
+        std::string refBase = gWorkDir + "/" + name + ".ref";
+        bool hasReference = false;
+        std::string refOutput;
+        int refExitCode = 0;
+
+        if (run(quote(gHostCC) + " -O2 -w --include " + quote(header) + " -o " + quote(refBase) + " " + quote(source) +
+                " " + quote(runtime) + " 2> " + quote(refBase + ".build.log")) == 0) {
+            refExitCode = run(quote(refBase) + " > " + quote(refBase + ".out"));
+            refOutput = readFile(refBase + ".out");
+            hasReference = refExitCode >= 0;
+        }
+
+        std::vector<LevelResult> results;
+
+        for (int32_t level: gLevels) {
+
+            LevelResult r;
+            r.level = level;
+
+            std::string base = gWorkDir + "/" + name + ".O" + std::to_string(level);
+            std::string asmFile = base + ".s";
+
+            int exitCode = 0;
+
+            if (run(quote(gMinic) + " -S -O" + std::to_string(level) + " -o " + quote(asmFile) + " " + quote(source) +
+                    " 2> " + quote(base + ".compile.log")) != 0) {
+                r.status = "compile-error";
+            } else {
+                r.codeSize = countInstructions(asmFile);
+
+                if (gMode == RunMode::QEMU) {
+                    r.status = runQemu(asmFile, base, exitCode, r.dynInsts);
+                    r.dynInsts -= startupInsts;
+                } else {
+                    r.status = runInterp(source, level, base, exitCode, r.dynInsts);
+                }
+            }
+
+            if (r.status.empty()) {
+                if (!hasReference) {
+                    r.status = "no-reference";
+                } else if (exitCode != refExitCode || readFile(base + ".out") != refOutput) {
+                    r.status = "mismatch";
+                } else {
+                    r.status = "ok";
+                }
+            }
+
+            if (r.status != "ok" && r.status != "no-reference") {
+                failures++;
+            }
+
+            results.push_back(r);
+        }
+
+        const LevelResult & first = results.front();
+
+        for (auto & r: results) {
+
+            bool measured = (r.status == "ok" || r.status == "no-reference");
+            bool comparable = measured && (first.status == r.status) && first.codeSize > 0 && first.dynInsts > 0;
+
+            printf("%-12s %4d %-14s", name.c_str(), r.level, r.status.c_str());
+            if (measured) {
+                printf(" %10ld %14lld", r.codeSize, r.dynInsts);
+            } else {
+                printf(" %10s %14s", "-", "-");
+            }
+
+            if (comparable) {
+                double codeRatio = (double) r.codeSize / first.codeSize;
+                double dynRatio = (double) r.dynInsts / first.dynInsts;
+                printf(" %7.1f%% %7.1f%%\n", codeRatio * 100, dynRatio * 100);
+                ratios[r.level].emplace_back(codeRatio, dynRatio);
+            } else {
+                printf(" %8s %8s\n", "-", "-");
+            }
+        }
+    }
+
+    // 各优化级别相对于第一个级别的几何平均，体现优化的收益
+    printf("\ngeometric mean relative to -O%d:\n", gLevels.front());
+    for (int32_t level: gLevels) {
+
+        auto & values = ratios[level];
+        if (values.empty()) {
+            continue;
+        }
+
+        double codeLog = 0, dynLog = 0;
+        for (auto & [code, dyn]: values) {
+            codeLog += std::log(code);
+            dynLog += std::log(dyn);
+        }
+
+        printf("  -O%d  code %6.1f%%  dyn-insts %6.1f%%  (%zu kernels)\n",
+               level,
+               std::exp(codeLog / values.size()) * 100,
+               std::exp(dynLog / values.size()) * 100,
+               values.size());
+    }
+
+    if (failures) {
+        printf("%d run(s) failed or differ from the reference\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
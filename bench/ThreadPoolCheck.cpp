@@ -0,0 +1,271 @@
+///
+/// @file ThreadPoolCheck.cpp
+/// @brief 线程池的检查minic-threadpool-check，以耗时不均的任务检查任务窃取以及每个任务恰好执行一次
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <getopt.h>
+
+#include "ThreadPool.h"
+
+/// @brief 线程数
+static int32_t gThreads = 4;
+
+/// @brief 每轮提交的任务数
+static int32_t gTasks = 64;
+
+/// @brief 轮数
+static int32_t gRounds = 20;
+
+/// @brief 耗时长的任务的执行时间，单位毫秒
+static int32_t gHeavyMs = 2;
+
+/// @brief 发现的错误个数
+static uint32_t gFailures = 0;
+
+enum {
+    OPT_THREADS = 256,
+    OPT_TASKS,
+    OPT_ROUNDS,
+    OPT_HEAVY_MS,
+};
+
+static struct option long_options[] = {
+    {"help", no_argument, 0, 'h'},
+    {"threads", required_argument, 0, OPT_THREADS},
+    {"tasks", required_argument, 0, OPT_TASKS},
+    {"rounds", required_argument, 0, OPT_ROUNDS},
+    {"heavy-ms", required_argument, 0, OPT_HEAVY_MS},
+    {0, 0, 0, 0}
+};
+
+/// @brief 显示帮助
+/// @param exeName 程序名
+static void showHelp(const std::string & exeName)
+{
+    std::cout << exeName + " [options]\n";
+    std::cout << "Run uneven task sets on ThreadPool and check that idle workers steal and every task runs once.\n";
+    std::cout << "Options:\n";
+    std::cout << "  -h, --help                 Show this help message\n";
+    std::cout << "      --threads=N            Worker threads, at least 2 (default 4)\n";
+    std::cout << "      --tasks=N              Tasks submitted per round (default 64)\n";
+    std::cout << "      --rounds=N             Rounds of each scenario (default 20)\n";
+    std::cout << "      --heavy-ms=N           Run time of a heavy task in milliseconds (default 2)\n";
+}
+
+/// @brief 参数解析
+/// @param argc 参数个数
+/// @param argv 参数
+/// @return 0：成功，1：显示帮助，-1：参数错误
+static int ArgsAnalysis(int argc, char * argv[])
+{
+    int ch;
+
+    while ((ch = getopt_long(argc, argv, "h", long_options, nullptr)) != -1) {
+        switch (ch) {
+            case 'h':
+                return 1;
+            case OPT_THREADS:
+                gThreads = std::atoi(optarg);
+                break;
+            case OPT_TASKS:
+                gTasks = std::atoi(optarg);
+                break;
+            case OPT_ROUNDS:
+                gRounds = std::atoi(optarg);
+                break;
+            case OPT_HEAVY_MS:
+                gHeavyMs = std::atoi(optarg);
+                break;
+            default:
+                return -1;
+        }
+    }
+
+    if ((gThreads < 2) || (gTasks < gThreads) || (gRounds < 1) || (gHeavyMs < 0)) {
+        fprintf(stderr, "--threads must be at least 2, --tasks at least --threads, --rounds positive\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+/// @brief 检查每个任务恰好执行了一次
+/// @param scenario 场景名，出错时显示
+/// @param round 轮次
+/// @param runs 各任务的执行次数
+static void checkRunOnce(const char * scenario, int32_t round, const std::vector<std::atomic<int32_t>> & runs)
+{
+    for (size_t k = 0; k < runs.size(); ++k) {
+        if (runs[k].load() != 1) {
+            fprintf(stderr, "%s round %d: task %zu ran %d times\n", scenario, round, k, runs[k].load());
+            gFailures++;
+        }
+    }
+}
+
+/// @brief 耗时长的任务，休眠使得单核的机器上其它工作线程也能运行
+static void heavyWork()
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(gHeavyMs));
+}
+
+///
+/// @brief 外部提交的任务轮流放入各队列，编号为线程数整数倍的任务耗时长，全部落在第一个队列中。
+/// 其它队列的任务很快执行完，空闲的工作线程必须从第一个队列窃取
+/// @param pool 线程池
+/// @return uint64_t 窃取到的任务数
+///
+static uint64_t checkUnevenSubmit(ThreadPool & pool)
+{
+    uint64_t before = pool.getStealCount();
+
+    for (int32_t round = 0; round < gRounds; ++round) {
+
+        std::vector<std::atomic<int32_t>> runs(gTasks);
+
+        for (int32_t k = 0; k < gTasks; ++k) {
+            bool heavy = (k % gThreads) == 0;
+            pool.submit([&runs, k, heavy]() {
+                if (heavy) {
+                    heavyWork();
+                }
+                runs[k]++;
+            });
+        }
+
+        pool.wait();
+
+        checkRunOnce("uneven-submit", round, runs);
+    }
+
+    return pool.getStealCount() - before;
+}
+
+///
+/// @brief 一个任务在工作线程中提交全部子任务，子任务都放入该线程的队列，其它工作线程只能通过窃取取得任务
+/// @param pool 线程池
+/// @return uint64_t 窃取到的任务数
+///
+static uint64_t checkNestedSubmit(ThreadPool & pool)
+{
+    uint64_t before = pool.getStealCount();
+
+    for (int32_t round = 0; round < gRounds; ++round) {
+
+        std::vector<std::atomic<int32_t>> runs(gTasks);
+
+        pool.submit([&pool, &runs]() {
+            for (int32_t k = 0; k < gTasks; ++k) {
+                pool.submit([&runs, k]() {
+                    heavyWork();
+                    runs[k]++;
+                });
+            }
+        });
+
+        pool.wait();
+
+        checkRunOnce("nested-submit", round, runs);
+    }
+
+    return pool.getStealCount() - before;
+}
+
+///
+/// @brief 单线程时不创建线程，任务在submit中按提交的次序直接执行
+///
+static void checkSingleThread()
+{
+    ThreadPool pool(1);
+
+    std::vector<int32_t> order;
+    for (int32_t k = 0; k < gTasks; ++k) {
+        pool.submit([&order, k]() { order.push_back(k); });
+
+        if ((int32_t) order.size() != k + 1) {
+            fprintf(stderr, "single-thread: task %d did not run inside submit\n", k);
+            gFailures++;
+            return;
+        }
+    }
+
+    pool.wait();
+
+    for (int32_t k = 0; k < gTasks; ++k) {
+        if (order[k] != k) {
+            fprintf(stderr, "single-thread: task %d ran at position %d\n", order[k], k);
+            gFailures++;
+            return;
+        }
+    }
+
+    if ((pool.size() != 1) || (pool.getStealCount() != 0)) {
+        fprintf(stderr, "single-thread: %d threads and %llu steals\n",
+                pool.size(), (unsigned long long) pool.getStealCount());
+        gFailures++;
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    int result = ArgsAnalysis(argc, argv);
+    if (result != 0) {
+        showHelp(argv[0]);
+        return result < 0 ? 1 : 0;
+    }
+
+    uint64_t unevenSteals;
+    uint64_t nestedSteals;
+
+    {
+        ThreadPool pool(gThreads);
+
+        // 同一个线程池依次运行两个场景，也检查了wait之后线程池可以继续使用
+        unevenSteals = checkUnevenSubmit(pool);
+        nestedSteals = checkNestedSubmit(pool);
+    }
+
+    checkSingleThread();
+
+    if (unevenSteals == 0) {
+        fprintf(stderr, "uneven-submit: idle workers never stole a task\n");
+        gFailures++;
+    }
+
+    if (nestedSteals == 0) {
+        fprintf(stderr, "nested-submit: no worker stole a task from the submitting worker\n");
+        gFailures++;
+    }
+
+    if (gFailures) {
+        fprintf(stderr, "%u thread pool check failures\n", gFailures);
+        return 1;
+    }
+
+    printf("%d threads, %d rounds of %d tasks: %llu steals with uneven submits, %llu with nested submits\n",
+           gThreads,
+           gRounds,
+           gTasks,
+           (unsigned long long) unevenSteals,
+           (unsigned long long) nestedSteals);
+
+    return 0;
+}
@@ -0,0 +1,46 @@
+// 动态规划：两个伪随机序列的最长公共子序列长度
+int x[200];
+int y[200];
+int dp[201][201];
+
+int max(int p, int q)
+{
+    if (p > q) {
+        return p;
+    }
+    return q;
+}
+
+int main()
+{
+    int n, i, j, seed;
+    n = 200;
+
+    seed = 7;
+    i = 0;
+    while (i < n) {
+        seed = (seed * 75 + 74) % 65537;
+        x[i] = seed % 8;
+        seed = (seed * 75 + 74) % 65537;
+        y[i] = seed % 8;
+        i = i + 1;
+    }
+
+    i = 1;
+    while (i <= n) {
+        j = 1;
+        while (j <= n) {
+            if (x[i - 1] == y[j - 1]) {
+                dp[i][j] = dp[i - 1][j - 1] + 1;
+            } else {
+                dp[i][j] = max(dp[i - 1][j], dp[i][j - 1]);
+            }
+            j = j + 1;
+        }
+        i = i + 1;
+    }
+
+    putint(dp[n][n]);
+    putch(10);
+    return dp[n][n] % 256;
+}
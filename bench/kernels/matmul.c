@@ -0,0 +1,62 @@
+// 矩阵乘法：C = A * B，输出C的校验和
+int a[40][40];
+int b[40][40];
+int c[40][40];
+
+void init(int n)
+{
+    int i, j;
+    i = 0;
+    while (i < n) {
+        j = 0;
+        while (j < n) {
+            a[i][j] = (i * 3 + j * 7) % 17 - 8;
+            b[i][j] = (i * 5 + j * 11) % 13 - 6;
+            j = j + 1;
+        }
+        i = i + 1;
+    }
+}
+
+void multiply(int n)
+{
+    int i, j, k, sum;
+    i = 0;
+    while (i < n) {
+        j = 0;
+        while (j < n) {
+            sum = 0;
+            k = 0;
+            while (k < n) {
+                sum = sum + a[i][k] * b[k][j];
+                k = k + 1;
+            }
+            c[i][j] = sum;
+            j = j + 1;
+        }
+        i = i + 1;
+    }
+}
+
+int main()
+{
+    int n, i, j, check;
+    n = 40;
+    init(n);
+    multiply(n);
+
+    check = 0;
+    i = 0;
+    while (i < n) {
+        j = 0;
+        while (j < n) {
+            check = (check * 31 + c[i][j]) % 1000003;
+            j = j + 1;
+        }
+        i = i + 1;
+    }
+
+    putint(check);
+    putch(10);
+    return check % 256;
+}
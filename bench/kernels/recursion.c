@@ -0,0 +1,29 @@
+// 递归：斐波那契数与汉诺塔的移动步数
+int fib(int n)
+{
+    if (n < 2) {
+        return n;
+    }
+    return fib(n - 1) + fib(n - 2);
+}
+
+int hanoi(int n, int from, int to, int via)
+{
+    if (n == 0) {
+        return 0;
+    }
+    return hanoi(n - 1, from, via, to) + 1 + hanoi(n - 1, via, to, from);
+}
+
+int main()
+{
+    int f, h;
+    f = fib(22);
+    h = hanoi(14, 1, 3, 2);
+
+    putint(f);
+    putch(32);
+    putint(h);
+    putch(10);
+    return (f + h) % 256;
+}
@@ -0,0 +1,33 @@
+// 埃拉托斯特尼筛法：统计小于n的素数个数
+int composite[30000];
+
+int main()
+{
+    int n, i, j, count;
+    n = 30000;
+
+    i = 2;
+    while (i * i < n) {
+        if (!composite[i]) {
+            j = i * i;
+            while (j < n) {
+                composite[j] = 1;
+                j = j + i;
+            }
+        }
+        i = i + 1;
+    }
+
+    count = 0;
+    i = 2;
+    while (i < n) {
+        if (!composite[i]) {
+            count = count + 1;
+        }
+        i = i + 1;
+    }
+
+    putint(count);
+    putch(10);
+    return count % 256;
+}
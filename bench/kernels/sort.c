@@ -0,0 +1,64 @@
+// 快速排序：对伪随机序列排序，检查有序后输出校验和
+int data[3000];
+
+void quicksort(int v[], int low, int high)
+{
+    int i, j, pivot, t;
+    if (low >= high) {
+        return;
+    }
+
+    pivot = v[(low + high) / 2];
+    i = low;
+    j = high;
+    while (i <= j) {
+        while (v[i] < pivot) {
+            i = i + 1;
+        }
+        while (v[j] > pivot) {
+            j = j - 1;
+        }
+        if (i <= j) {
+            t = v[i];
+            v[i] = v[j];
+            v[j] = t;
+            i = i + 1;
+            j = j - 1;
+        }
+    }
+
+    quicksort(v, low, j);
+    quicksort(v, i, high);
+}
+
+int main()
+{
+    int n, i, seed, check;
+    n = 3000;
+
+    seed = 12345;
+    i = 0;
+    while (i < n) {
+        seed = (seed * 1103 + 12345) % 65536;
+        data[i] = seed;
+        i = i + 1;
+    }
+
+    quicksort(data, 0, n - 1);
+
+    check = 0;
+    i = 1;
+    while (i < n) {
+        if (data[i - 1] > data[i]) {
+            putint(-1);
+            putch(10);
+            return 1;
+        }
+        check = (check * 7 + data[i]) % 1000003;
+        i = i + 1;
+    }
+
+    putint(check);
+    putch(10);
+    return check % 256;
+}
@@ -0,0 +1,64 @@
+///
+/// @file std.c
+/// @brief MiniC内置函数的实现，与IR解释器中内置函数的行为一致
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <stdio.h>
+
+#include "std.h"
+
+int getint(void)
+{
+    int value = 0;
+    if (scanf("%d", &value) != 1) {
+        return 0;
+    }
+    return value;
+}
+
+int getch(void)
+{
+    return getchar();
+}
+
+int getarray(int a[])
+{
+    int n = 0;
+    if (scanf("%d", &n) != 1) {
+        return 0;
+    }
+    for (int k = 0; k < n; ++k) {
+        if (scanf("%d", &a[k]) != 1) {
+            break;
+        }
+    }
+    return n;
+}
+
+void putint(int k)
+{
+    printf("%d", k);
+}
+
+void putch(int c)
+{
+    putchar(c);
+}
+
+void putarray(int n, int a[])
+{
+    printf("%d:", n);
+    for (int k = 0; k < n; ++k) {
+        printf(" %d", a[k]);
+    }
+    putchar('\n');
+}
@@ -0,0 +1,22 @@
+///
+/// @file std.h
+/// @brief MiniC内置函数的声明，主机与交叉编译基准测试程序时通过--include引入
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+int getint(void);
+int getch(void);
+int getarray(int a[]);
+void putint(int k);
+void putch(int c);
+void putarray(int n, int a[]);
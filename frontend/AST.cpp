@@ -20,18 +20,18 @@
 
 #include "AST.h"
 #include "AttrType.h"
+#include "CompileReport.h"
 #include "Types/IntegerType.h"
 #include "Types/VoidType.h"
 
-/* 整个AST的根节点 */
-ast_node * ast_root = nullptr;
-
 /// @brief 创建指定节点类型的节点
 /// @param _node_type 节点类型
 /// @param _line_no 行号
 ast_node::ast_node(ast_operator_type _node_type, Type * _type, int64_t _line_no)
     : node_type(_node_type), line_no(-1), type(_type)
-{}
+{
+    countObject(CountedObject::AST_NODE);
+}
 
 /// @brief 构造函数
 /// @param _type 节点值的类型
@@ -265,9 +265,6 @@ public:
 /// @brief AST资源清理
 void free_ast(ast_node * root);
 
-/// @brief抽象语法树的根节点指针
-extern ast_node * ast_root;
-
 /// @brief 创建AST的内部节点，请注意可追加孩子节点，请按次序依次加入，最多3个
 /// @param node_type 节点类型
 /// @param first_child 第一个孩子节点
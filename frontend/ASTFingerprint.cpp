@@ -0,0 +1,152 @@
+///
+/// @file ASTFingerprint.cpp
+/// @brief 按函数计算抽象语法树的指纹，用于函数级的增量编译
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "ASTFingerprint.h"
+
+ASTFingerprint::ASTFingerprint(ast_node * _root) : root(_root)
+{}
+
+void ASTFingerprint::hashTree(ast_node * node, Sha256 & hash)
+{
+    int32_t nodeType = (int32_t) node->node_type;
+    hash.update(&nodeType, sizeof(nodeType));
+    hash.update(&node->integer_val, sizeof(node->integer_val));
+
+    uint32_t floatBits;
+    memcpy(&floatBits, &node->float_val, sizeof(floatBits));
+    hash.update(&floatBits, sizeof(floatBits));
+
+    hash.updateField(node->name);
+    hash.updateField(node->type ? node->type->toString() : "");
+
+    uint64_t sons = node->sons.size();
+    hash.update(&sons, sizeof(sons));
+
+    for (auto son: node->sons) {
+        hashTree(son, hash);
+    }
+}
+
+std::string ASTFingerprint::treeDigest(ast_node * node)
+{
+    Sha256 hash;
+    hashTree(node, hash);
+
+    return hash.hexDigest();
+}
+
+void ASTFingerprint::collectNames(ast_node * node, std::unordered_set<std::string> & names)
+{
+    if (node->node_type == ast_operator_type::AST_OP_LEAF_VAR_ID) {
+        names.insert(node->name);
+    }
+
+    for (auto son: node->sons) {
+        collectNames(son, names);
+    }
+}
+
+bool ASTFingerprint::run(const std::string & salt, std::unordered_map<std::string, std::string> & fingerprints)
+{
+    // 全局变量名到所在声明语句的散列，一条声明语句可声明多个变量
+    std::unordered_map<std::string, std::string> globals;
+
+    // 所有全局变量声明的散列，按出现的次序
+    std::vector<std::string> allGlobals;
+
+    // 函数名到原型(返回类型、名字与形参)的散列
+    std::unordered_map<std::string, std::string> prototypes;
+
+    std::vector<ast_node *> funcDefs;
+
+    for (auto son: root->sons) {
+
+        if (son->node_type == ast_operator_type::AST_OP_FUNC_DEF) {
+
+            const std::string & name = son->sons[1]->name;
+            if (prototypes.count(name)) {
+                return false;
+            }
+
+            Sha256 hash;
+            for (size_t k = 0; k < 3 && k < son->sons.size(); ++k) {
+                hashTree(son->sons[k], hash);
+            }
+            prototypes[name] = hash.hexDigest();
+
+            funcDefs.push_back(son);
+
+        } else if (son->node_type == ast_operator_type::AST_OP_DECL_STMT ||
+                   son->node_type == ast_operator_type::AST_OP_VAR_DECL) {
+
+            std::string digest = treeDigest(son);
+            allGlobals.push_back(digest);
+
+            std::unordered_set<std::string> names;
+            collectNames(son, names);
+            for (auto & name: names) {
+                globals[name] += digest;
+            }
+        }
+    }
+
+    for (auto funcDef: funcDefs) {
+
+        const std::string & name = funcDef->sons[1]->name;
+
+        // 引用的标识符排序后加入，与集合的遍历次序无关
+        std::unordered_set<std::string> nameSet;
+        collectNames(funcDef, nameSet);
+
+        std::vector<std::string> names(nameSet.begin(), nameSet.end());
+        std::sort(names.begin(), names.end());
+
+        Sha256 hash;
+        hash.updateField(salt);
+        hashTree(funcDef, hash);
+
+        // 同名的局部变量也按全局变量处理，最多是多了不必要的重新编译
+        for (auto & ref: names) {
+
+            auto globalIter = globals.find(ref);
+            if (globalIter != globals.end()) {
+                hash.updateField("global");
+                hash.updateField(ref);
+                hash.updateField(globalIter->second);
+            }
+
+            auto protoIter = prototypes.find(ref);
+            if (protoIter != prototypes.end() && ref != name) {
+                hash.updateField("callee");
+                hash.updateField(ref);
+                hash.updateField(protoIter->second);
+            }
+        }
+
+        // main函数的入口处初始化全局变量
+        if (name == "main") {
+            for (auto & digest: allGlobals) {
+                hash.updateField(digest);
+            }
+        }
+
+        fingerprints[name] = hash.hexDigest();
+    }
+
+    return true;
+}
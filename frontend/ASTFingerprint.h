@@ -0,0 +1,70 @@
+///
+/// @file ASTFingerprint.h
+/// @brief 按函数计算抽象语法树的指纹，用于函数级的增量编译
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "AST.h"
+#include "Sha256.h"
+
+///
+/// @brief 函数定义的指纹：函数的抽象语法树子树，加上函数内引用的全局变量的声明与被调函数的原型。
+/// 指纹不变时函数产生的汇编不变。行号不参与计算，其它函数的修改引起的行号变化不影响指纹。
+/// main函数中要初始化全局变量，其指纹包含所有的全局变量声明
+///
+class ASTFingerprint {
+
+public:
+    /// @brief 构造函数
+    /// @param _root 编译单元的抽象语法树
+    explicit ASTFingerprint(ast_node * _root);
+
+    ///
+    /// @brief 计算各函数定义的指纹
+    /// @param salt 影响代码生成的选项等，加入每个函数的指纹
+    /// @param fingerprints 函数名到指纹(十六进制的SHA-256)的映射
+    /// @return true 成功
+    /// @return false 有重名的函数定义，不能按函数区分
+    ///
+    bool run(const std::string & salt, std::unordered_map<std::string, std::string> & fingerprints);
+
+protected:
+    ///
+    /// @brief 子树的内容加入散列：节点类型、名字、类型、数值与孩子，不含行号
+    /// @param node 子树的根
+    /// @param hash 散列
+    ///
+    static void hashTree(ast_node * node, Sha256 & hash);
+
+    ///
+    /// @brief 子树的散列值
+    /// @param node 子树的根
+    /// @return std::string 十六进制的散列值
+    ///
+    static std::string treeDigest(ast_node * node);
+
+    ///
+    /// @brief 收集子树中出现的标识符，含变量名与被调函数名
+    /// @param node 子树的根
+    /// @param names 标识符
+    ///
+    static void collectNames(ast_node * node, std::unordered_set<std::string> & names);
+
+private:
+    /// @brief 编译单元的抽象语法树
+    ast_node * root;
+};
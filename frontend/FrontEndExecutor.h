@@ -41,6 +41,15 @@ public:
     /// @return true: 成功 false: 失败
     virtual bool run() = 0;
 
+    ///
+    /// @brief 前端是否可重入，即多个源文件能否在不同线程中同时分析。使用全局变量的前端不可重入
+    /// @return true: 可重入 false: 不可重入
+    ///
+    virtual bool isReentrant() const
+    {
+        return false;
+    }
+
     ///
     /// @brief  返回抽象语法树的根
     /// @return ast_node*
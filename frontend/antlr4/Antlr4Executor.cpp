@@ -13,27 +13,39 @@
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
 /// </table>
 ///
+#include <algorithm>
 #include <iostream>
 
 #include "AST.h"
 #include "Antlr4Executor.h"
 #include "Antlr4CSTVisitor.h"
+#include "Antlr4MappedStream.h"
 #include "MiniCLexer.h"
 #include "Common.h"
+#include "MappedFile.h"
 
 /// @brief 前端词法与语法解析生成AST
 /// @return true: 成功 false：错误
 bool Antlr4Executor::run()
 {
-    std::ifstream ifs;
-    ifs.open(filename);
-    if (!ifs.is_open()) {
+    // 源文件映射到内存，直接从映射的内容建立输入流，不再经过ifstream读入
+    MappedFile source;
+    if (!source.open(filename)) {
         minic_log(LOG_ERROR, "文件(%s)不能打开，可能不存在", filename.c_str());
         return false;
     }
 
-    // antlr4的输入流类实例
-    antlr4::ANTLRInputStream input{ifs};
+    // antlr4的输入流类实例，直接引用映射的内容，不再像ANTLRInputStream那样解码出一份UTF-32的副本。
+    // 下标与ANTLRInputStream一样按码点计算，得到的记号、行列号以及文本完全相同
+    Antlr4MappedStream input{source.data(), source.size(), filename};
+    if (!input.isValid()) {
+
+        // 第一个不合法字节所在的行号，从1开始
+        auto line = (long long) std::count(source.data(), source.data() + input.getErrorOffset(), '\n') + 1;
+
+        minic_log(LOG_ERROR, "Line(%lld): 文件(%s)不是合法的UTF-8编码", line, filename.c_str());
+        return false;
+    }
 
     // 词法分析器实例
     MiniCLexer lexer{&input};
@@ -44,9 +56,32 @@ bool Antlr4Executor::run()
     // 利用antlr4进行分析，从compileUnit开始分析输入字符串
     MiniCParser parser{&tokenStream};
 
-    // 从具体语法树的根结点进行深度优先遍历，生成抽象语法树
-    auto cstRoot = parser.compileUnit();
-    if (!cstRoot) {
+    // 两阶段分析：先用SLL预测模式与遇错即停的错误策略分析，绝大多数正确的输入在这一阶段完成。
+    // 只有失败时才回退到完整的LL预测模式与默认错误策略重新分析，以得到准确的结果与错误报告。
+    // 预测用的DFA缓存是生成的分析器的静态数据，批量编译时各个文件共享，前面文件的预热后面直接可用
+    auto * interpreter = parser.getInterpreter<antlr4::atn::ParserATNSimulator>();
+    interpreter->setPredictionMode(antlr4::atn::PredictionMode::SLL);
+    parser.removeErrorListeners();
+    parser.setErrorHandler(std::make_shared<antlr4::BailErrorStrategy>());
+
+    // 分析得到具体语法树的根结点
+    MiniCParser::CompileUnitContext * cstRoot;
+    try {
+        cstRoot = parser.compileUnit();
+    } catch (antlr4::ParseCancellationException &) {
+
+        // 记号已缓存在记号流中，重置后从头再分析，不需要重新词法分析，词法错误也不会重复报告。
+        // 第一阶段没有错误监听器，因此每个语法错误只在第二阶段报告一次
+        parser.reset();
+        parser.addErrorListener(&antlr4::ConsoleErrorListener::INSTANCE);
+        parser.setErrorHandler(std::make_shared<antlr4::DefaultErrorStrategy>());
+        interpreter->setPredictionMode(antlr4::atn::PredictionMode::LL);
+
+        cstRoot = parser.compileUnit();
+    }
+
+    // 有错误时具体语法树是错误恢复后的结果，不再产生抽象语法树
+    if (!cstRoot || (lexer.getNumberOfSyntaxErrors() > 0) || (parser.getNumberOfSyntaxErrors() > 0)) {
         minic_log(LOG_ERROR, "Antlr4的词语与语法分析错误");
         return false;
     }
@@ -26,4 +26,12 @@ public:
     /// @brief 前端词法与语法解析生成AST
     /// @return true: 成功 false：错误
     bool run() override;
+
+    /// @brief ANTLR生成的分析器的共享数据以call_once初始化，DFA缓存由运行时加锁保护，
+    /// 各次分析的词法分析器、语法分析器与遍历器都是局部对象，因此可重入
+    /// @return true: 可重入
+    bool isReentrant() const override
+    {
+        return true;
+    }
 };
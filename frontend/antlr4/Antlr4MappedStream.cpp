@@ -0,0 +1,277 @@
+///
+/// @file Antlr4MappedStream.cpp
+/// @brief 直接在映射到内存的UTF-8源文件上工作的antlr4字符流
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "Antlr4MappedStream.h"
+
+///
+/// @brief 检查字节偏移处的UTF-8字节序列，规则与antlr4的Utf8::strictDecode相同，
+/// 拒绝超长编码、代理码点以及大于U+10FFFF的码点
+/// @param s 字节序列
+/// @param n 剩余的字节数，大于0
+/// @return size_t 字节序列的长度，不合法时为0
+///
+static size_t utf8SequenceLength(const unsigned char * s, size_t n)
+{
+    unsigned char lead = s[0];
+
+    if (lead < 0x80) {
+        return 1;
+    }
+
+    size_t len;
+    unsigned char low = 0x80;
+    unsigned char high = 0xBF;
+
+    if ((lead >= 0xC2) && (lead <= 0xDF)) {
+        len = 2;
+    } else if ((lead >= 0xE0) && (lead <= 0xEF)) {
+        len = 3;
+        if (lead == 0xE0) {
+            low = 0xA0;
+        } else if (lead == 0xED) {
+            high = 0x9F;
+        }
+    } else if ((lead >= 0xF0) && (lead <= 0xF4)) {
+        len = 4;
+        if (lead == 0xF0) {
+            low = 0x90;
+        } else if (lead == 0xF4) {
+            high = 0x8F;
+        }
+    } else {
+        return 0;
+    }
+
+    if (n < len) {
+        return 0;
+    }
+
+    // 第二个字节的范围与首字节有关，其余的后续字节都在0x80~0xBF之间
+    if ((s[1] < low) || (s[1] > high)) {
+        return 0;
+    }
+
+    for (size_t k = 2; k < len; ++k) {
+        if ((s[k] < 0x80) || (s[k] > 0xBF)) {
+            return 0;
+        }
+    }
+
+    return len;
+}
+
+///
+/// @brief 构造函数，检查UTF-8编码并建立下标索引，与ANTLRInputStream一样跳过开头的BOM
+/// @param _data 源文件内容，需在字符流使用期间有效
+/// @param _size 字节数
+/// @param _name 源文件名
+///
+Antlr4MappedStream::Antlr4MappedStream(const char * _data, size_t _size, std::string _name)
+    : data(_data), length(_size), name(std::move(_name))
+{
+    size_t bomSize = 0;
+    if ((length >= 3) && (std::memcmp(data, "\xef\xbb\xbf", 3) == 0)) {
+        bomSize = 3;
+        data += bomSize;
+        length -= bomSize;
+    }
+
+    extraBytes.push_back(0);
+
+    auto bytes = reinterpret_cast<const unsigned char *>(data);
+
+    size_t offset = 0;
+    while (offset < length) {
+
+        size_t len = utf8SequenceLength(bytes + offset, length - offset);
+        if (len == 0) {
+            // 不合法时与ANTLRInputStream抛出异常一样不提供任何字符，由调用者报告错误
+            valid = false;
+            errorOffset = bomSize + offset;
+            length = 0;
+            count = 0;
+            wideIndex.clear();
+            extraBytes.resize(1);
+            return;
+        }
+
+        if (len > 1) {
+            wideIndex.push_back(count);
+            extraBytes.push_back(extraBytes.back() + len - 1);
+        }
+
+        offset += len;
+        count++;
+    }
+
+    errorOffset = bomSize + length;
+}
+
+///
+/// @brief 码点下标对应的字节偏移
+/// @param index 码点下标，不大于码点个数
+/// @return size_t 字节偏移
+///
+size_t Antlr4MappedStream::byteOffset(size_t index) const
+{
+    // 下标小于index的非ASCII字符个数
+    auto wide = (size_t) (std::lower_bound(wideIndex.begin(), wideIndex.end(), index) - wideIndex.begin());
+
+    return index + extraBytes[wide];
+}
+
+///
+/// @brief 解码字节偏移处的码点，编码已在构造时检查过
+/// @param offset 字节偏移，小于字节数
+/// @return size_t 码点
+///
+size_t Antlr4MappedStream::decodeAt(size_t offset) const
+{
+    auto s = reinterpret_cast<const unsigned char *>(data) + offset;
+
+    if (s[0] < 0x80) {
+        return s[0];
+    }
+
+    if (s[0] < 0xE0) {
+        return ((size_t) (s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+    }
+
+    if (s[0] < 0xF0) {
+        return ((size_t) (s[0] & 0x0F) << 12) | ((size_t) (s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+    }
+
+    return ((size_t) (s[0] & 0x07) << 18) | ((size_t) (s[1] & 0x3F) << 12) | ((size_t) (s[2] & 0x3F) << 6) |
+           (s[3] & 0x3F);
+}
+
+/// @brief 前进一个字符，与ANTLRInputStream一样，在末尾时不能再前进
+void Antlr4MappedStream::consume()
+{
+    if (pos >= count) {
+        throw antlr4::IllegalStateException("cannot consume EOF");
+    }
+
+    unsigned char lead = static_cast<unsigned char>(data[bytePos]);
+    bytePos += (lead < 0x80) ? 1 : ((lead < 0xE0) ? 2 : ((lead < 0xF0) ? 3 : 4));
+    pos++;
+}
+
+/// @brief 向前(i>0)或向后(i<0)查看字符，越界时返回EOF
+/// @param i 偏移，1为当前字符
+/// @return size_t 字符的码点
+size_t Antlr4MappedStream::LA(ssize_t i)
+{
+    if (i == 0) {
+        // 未定义
+        return 0;
+    }
+
+    auto position = static_cast<ssize_t>(pos);
+    if (i < 0) {
+        // LA(-1)为前一个字符
+        i++;
+        if ((position + i - 1) < 0) {
+            return antlr4::IntStream::EOF;
+        }
+    }
+
+    if ((position + i - 1) >= static_cast<ssize_t>(count)) {
+        return antlr4::IntStream::EOF;
+    }
+
+    // 词法分析几乎只查看当前字符，直接在当前位置解码
+    if (i == 1) {
+        return decodeAt(bytePos);
+    }
+
+    return decodeAt(byteOffset(static_cast<size_t>(position + i - 1)));
+}
+
+/// @brief 内容都在内存中，不需要标记
+ssize_t Antlr4MappedStream::mark()
+{
+    return -1;
+}
+
+/// @brief 内容都在内存中，不需要标记
+void Antlr4MappedStream::release(ssize_t)
+{}
+
+size_t Antlr4MappedStream::index()
+{
+    return pos;
+}
+
+/// @brief 定位到指定的位置，超过末尾时定位到末尾
+/// @param index 码点下标
+void Antlr4MappedStream::seek(size_t index)
+{
+    pos = std::min(index, count);
+    bytePos = byteOffset(pos);
+}
+
+size_t Antlr4MappedStream::size()
+{
+    return count;
+}
+
+std::string Antlr4MappedStream::getSourceName() const
+{
+    if (name.empty()) {
+        return antlr4::IntStream::UNKNOWN_SOURCE_NAME;
+    }
+
+    return name;
+}
+
+/// @brief 获取区间内的文本，区间的两端都包含在内，下标为码点下标，
+/// 各种越界情况的结果与ANTLRInputStream相同
+/// @param interval 区间
+/// @return std::string 原始的UTF-8文本
+std::string Antlr4MappedStream::getText(const antlr4::misc::Interval & interval)
+{
+    if ((interval.a < 0) || (interval.b < 0)) {
+        return "";
+    }
+
+    auto start = static_cast<size_t>(interval.a);
+    auto stop = static_cast<size_t>(interval.b);
+
+    if (stop >= count) {
+        stop = count - 1;
+    }
+
+    if (start >= count) {
+        return "";
+    }
+
+    // ANTLRInputStream按stop - start + 1个字符截取，stop < start - 1时回绕成很大的数，取到末尾
+    if (stop + 1 < start) {
+        stop = count - 1;
+    }
+
+    size_t begin = byteOffset(start);
+
+    return std::string(data + begin, byteOffset(stop + 1) - begin);
+}
+
+std::string Antlr4MappedStream::toString() const
+{
+    return std::string(data, length);
+}
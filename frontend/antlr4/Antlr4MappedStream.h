@@ -0,0 +1,123 @@
+///
+/// @file Antlr4MappedStream.h
+/// @brief 直接在映射到内存的UTF-8源文件上工作的antlr4字符流
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "antlr4-runtime.h"
+
+///
+/// @brief 零拷贝的antlr4字符流。
+/// ANTLRInputStream把整个输入解码成UTF-32再保存一份，每个字符占4个字节。这里直接引用映射的源文件内容，
+/// 与ANTLRInputStream一样以码点为字符、以码点的序号为下标，遇到非ASCII字符时按需解码。
+/// 构造时检查UTF-8编码并只为非ASCII字符建立稀疏的下标索引：码点下标加上其前面非ASCII字符多占的字节数即为字节偏移，
+/// 纯ASCII的源文件没有额外的空间开销。顺序前进时通过当前位置的字节偏移直接解码，不需要查索引
+///
+class Antlr4MappedStream : public antlr4::CharStream {
+
+public:
+    ///
+    /// @brief 构造函数，检查UTF-8编码并建立下标索引，与ANTLRInputStream一样跳过开头的BOM
+    /// @param _data 源文件内容，需在字符流使用期间有效
+    /// @param _size 字节数
+    /// @param _name 源文件名
+    ///
+    Antlr4MappedStream(const char * _data, size_t _size, std::string _name);
+
+    ///
+    /// @brief 源文件是否为合法的UTF-8编码，不合法时字符流为空
+    /// @return true 合法
+    ///
+    [[nodiscard]] bool isValid() const
+    {
+        return valid;
+    }
+
+    ///
+    /// @brief 获取第一个不合法的UTF-8字节序列的字节偏移
+    /// @return size_t 相对于构造时传入的内容的字节偏移，合法时为传入的字节数
+    ///
+    [[nodiscard]] size_t getErrorOffset() const
+    {
+        return errorOffset;
+    }
+
+    void consume() override;
+
+    size_t LA(ssize_t i) override;
+
+    ssize_t mark() override;
+
+    void release(ssize_t marker) override;
+
+    size_t index() override;
+
+    void seek(size_t index) override;
+
+    size_t size() override;
+
+    std::string getSourceName() const override;
+
+    std::string getText(const antlr4::misc::Interval & interval) override;
+
+    std::string toString() const override;
+
+private:
+    ///
+    /// @brief 码点下标对应的字节偏移
+    /// @param index 码点下标，不大于码点个数
+    /// @return size_t 字节偏移
+    ///
+    size_t byteOffset(size_t index) const;
+
+    ///
+    /// @brief 解码字节偏移处的码点，编码已在构造时检查过
+    /// @param offset 字节偏移，小于字节数
+    /// @return size_t 码点
+    ///
+    size_t decodeAt(size_t offset) const;
+
+    /// @brief 源文件内容，不含BOM
+    const char * data;
+
+    /// @brief 字节数
+    size_t length;
+
+    /// @brief 码点个数
+    size_t count = 0;
+
+    /// @brief 当前位置的码点下标
+    size_t pos = 0;
+
+    /// @brief 当前位置的字节偏移
+    size_t bytePos = 0;
+
+    /// @brief 非ASCII字符的码点下标，从小到大
+    std::vector<size_t> wideIndex;
+
+    /// @brief wideIndex中前k个非ASCII字符比ASCII字符多占的字节数之和，第0个元素为0
+    std::vector<size_t> extraBytes;
+
+    /// @brief 是否为合法的UTF-8编码
+    bool valid = true;
+
+    /// @brief 第一个不合法的字节序列相对于传入内容的字节偏移
+    size_t errorOffset = 0;
+
+    /// @brief 源文件名
+    std::string name;
+};
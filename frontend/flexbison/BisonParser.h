@@ -17,19 +17,5 @@
 
 #include "AttrType.h"
 
-/// @brief yyparse的类型声明
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse(void * YYPARSE_PARAM);
-#else
-int yyparse();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse(void);
-#else
-int yyparse();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
+/// @brief 纯语法分析器，yyparse的原型(带扫描器以及语法树根节点参数)在bison生成的头文件中声明
 #include "MiniCBison.h"
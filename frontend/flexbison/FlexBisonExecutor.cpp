@@ -13,42 +13,67 @@
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
 /// </table>
 ///
+#include "Common.h"
 #include "FlexBisonExecutor.h"
 #include "BisonParser.h"
 #include "FlexLexer.h"
 
+/// @brief 析构函数，释放扫描器，源文件的映射由source析构时解除
+FlexBisonExecutor::~FlexBisonExecutor()
+{
+    if (scanner) {
+        yylex_destroy(scanner);
+        scanner = nullptr;
+    }
+}
+
 /// @brief 前端词法与语法解析生成AST
 /// @return true: 成功 false：错误
 bool FlexBisonExecutor::run()
 {
-    // 若指定有参数，则作为词法分析的输入文件
-    yyin = fopen(filename.c_str(), "r");
-    if (yyin == nullptr) {
-        printf("Can't open file %s\n", filename.c_str());
+    // 源文件映射到内存，末尾留出flex要求的两个结束符YY_END_OF_BUFFER_CHAR(即0)
+    if (!source.open(filename, 2)) {
+        minic_log(LOG_ERROR, "文件(%s)不能打开，可能不存在", filename.c_str());
+        return false;
+    }
+
+    // 创建可重入的扫描器，其状态与其它线程上的分析互不干扰
+    if (0 != yylex_init(&scanner)) {
+        minic_log(LOG_ERROR, "yylex_init failed");
+        return false;
+    }
+
+    // 直接在映射的内存上扫描，不再经过stdio读入与拷贝。
+    // yy_scan_buffer不设置行号，需要显式设置为第一行
+    if (nullptr == yy_scan_buffer(source.data(), source.size() + 2, scanner)) {
+        minic_log(LOG_ERROR, "yy_scan_buffer failed");
         return false;
     }
 
+    yyset_lineno(1, scanner);
+
     // 如果要查看LALR的移进与归约过程，请设置yydebug为1
 #ifdef BISON_DEBUG_ENABLE
     yydebug = 1;
 #endif
 
-    // 词法、语法分析生成抽象语法树AST
-    bool result = yyparse();
-    if (0 != result) {
-        printf("yyparse failed\n");
+    // 词法、语法分析生成抽象语法树AST，根节点通过参数返回
+    ast_node * root = nullptr;
+    int result = yyparse(scanner, &root);
 
-        // 关闭文件
-        fclose(yyin);
+    // 释放扫描器并解除源文件的映射
+    yylex_destroy(scanner);
+    scanner = nullptr;
 
+    source.close();
+
+    if (0 != result) {
+        minic_log(LOG_ERROR, "yyparse failed");
         return false;
     }
 
     // 设置抽象语法树的根节点
-    astRoot = ast_root;
-
-    // 关闭文件
-    fclose(yyin);
+    astRoot = root;
 
     return true;
-}
\ No newline at end of file
+}
@@ -14,15 +14,30 @@
 /// </table>
 ///
 #include "FrontEndExecutor.h"
+#include "MappedFile.h"
 
 class FlexBisonExecutor : public FrontEndExecutor {
 public:
     FlexBisonExecutor(std::string filename) : FrontEndExecutor(filename)
     {}
-    virtual ~FlexBisonExecutor()
-    {}
+    virtual ~FlexBisonExecutor();
 
     /// @brief 前端词法与语法解析生成AST
     /// @return true: 成功 false：错误
     bool run() override;
+
+    /// @brief 扫描器为可重入的flex扫描器，语法分析器为bison纯语法分析器，
+    /// 分析状态都在本对象所拥有的扫描器以及yyparse的局部变量中，因此可重入
+    /// @return true: 可重入
+    bool isReentrant() const override
+    {
+        return true;
+    }
+
+protected:
+    /// @brief 可重入flex扫描器的状态(yyscan_t)，由yylex_init创建，yylex_destroy释放
+    void * scanner = nullptr;
+
+    /// @brief 映射到内存的源文件，扫描器直接在其上扫描
+    MappedFile source;
 };
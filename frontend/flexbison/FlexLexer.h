@@ -10,4 +10,6 @@
  */
 #pragma once
 
+// 可重入扫描器的接口使用了bison生成的YYSTYPE
+#include "BisonParser.h"
 #include "MiniCFlex.h"
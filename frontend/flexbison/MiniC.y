@@ -2,9 +2,6 @@
 #include <cstdio>
 #include <cstring>
 
-// 词法分析头文件
-#include "FlexLexer.h"
-
 // bison生成的头文件
 #include "BisonParser.h"
 
@@ -13,11 +10,33 @@
 
 #include "IntegerType.h"
 
-// LR分析失败时所调用函数的原型声明
-void yyerror(char * msg);
+#include "Common.h"
 
 %}
 
+// 可重入的扫描器类型以及抽象语法树节点类型，yylex与yyparse的原型需要
+%code requires {
+typedef void * yyscan_t;
+class ast_node;
+}
+
+%code {
+// 词法分析头文件，需要在YYSTYPE定义之后包含
+#include "FlexLexer.h"
+
+// LR分析失败时所调用函数的原型声明
+void yyerror(yyscan_t scanner, ast_node ** root, const char * msg);
+}
+
+// 生成纯语法分析器，分析状态都在yyparse的局部变量中，从而支持多线程同时分析
+%define api.pure full
+
+// yylex的额外参数：扫描器
+%lex-param {yyscan_t scanner}
+
+// yyparse的额外参数：扫描器以及输出的抽象语法树根节点
+%parse-param {yyscan_t scanner} {ast_node ** root}
+
 // 联合体声明，用于后续终结符和非终结符号属性指定使用
 %union {
     class ast_node * node;
@@ -77,14 +96,14 @@ CompileUnit : FuncDef {
 		// 创建一个编译单元的节点AST_OP_COMPILE_UNIT
 		$$ = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT, $1);
 
-		// 设置到全局变量中
-		ast_root = $$;
+		// 通过yyparse的参数返回根节点
+		*root = $$;
 	}
 	| VarDecl {
 
 		// 创建一个编译单元的节点AST_OP_COMPILE_UNIT
 		$$ = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT, $1);
-		ast_root = $$;
+		*root = $$;
 	}
 	| CompileUnit FuncDef {
 
@@ -384,7 +403,9 @@ LVal : T_ID {
 %%
 
 // 语法识别错误要调用函数的定义
-void yyerror(char * msg)
+void yyerror(yyscan_t scanner, ast_node ** root, const char * msg)
 {
-    printf("Line %d: %s\n", yylineno, msg);
+    (void) root;
+
+    minic_log(LOG_ERROR, "Line %d: %s", yyget_lineno(scanner), msg);
 }
\ No newline at end of file
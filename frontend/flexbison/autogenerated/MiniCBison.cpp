@@ -55,7 +55,7 @@
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 2
 
 /* Push parsers.  */
 #define YYPUSH 0
@@ -72,9 +72,6 @@
 #include <cstdio>
 #include <cstring>
 
-// 词法分析头文件
-#include "FlexLexer.h"
-
 // bison生成的头文件
 #include "BisonParser.h"
 
@@ -83,11 +80,10 @@
 
 #include "IntegerType.h"
 
-// LR分析失败时所调用函数的原型声明
-void yyerror(char * msg);
+#include "Common.h"
 
 
-#line 91 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 87 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -154,6 +150,16 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
 
 
 
+/* Unqualified %code blocks.  */
+#line 23 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+
+// 词法分析头文件，需要在YYSTYPE定义之后包含
+#include "FlexLexer.h"
+
+// LR分析失败时所调用函数的原型声明
+void yyerror(yyscan_t scanner, ast_node ** root, const char * msg);
+
+#line 163 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
 
 #ifdef short
 # undef short
@@ -536,10 +542,10 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,    75,    75,    83,    89,    94,   101,   124,   130,   141,
-     146,   155,   159,   170,   176,   188,   202,   213,   222,   228,
-     234,   240,   246,   256,   266,   272,   278,   287,   290,   299,
-     305,   321,   340,   344,   350,   362,   366,   373
+       0,    94,    94,   102,   108,   113,   120,   143,   149,   160,
+     165,   174,   178,   189,   195,   207,   221,   232,   241,   247,
+     253,   259,   265,   275,   285,   291,   297,   306,   309,   318,
+     324,   340,   359,   363,   369,   381,   385,   392
 };
 #endif
 
@@ -704,7 +710,7 @@ enum { YYENOMEM = -2 };
       }                                                           \
     else                                                          \
       {                                                           \
-        yyerror (YY_("syntax error: cannot back up")); \
+        yyerror (scanner, root, YY_("syntax error: cannot back up")); \
         YYERROR;                                                  \
       }                                                           \
   while (0)
@@ -737,7 +743,7 @@ do {                                                                      \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Kind, Value); \
+                  Kind, Value, scanner, root); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -749,10 +755,12 @@ do {                                                                      \
 
 static void
 yy_symbol_value_print (FILE *yyo,
-                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, ast_node ** root)
 {
   FILE *yyoutput = yyo;
   YY_USE (yyoutput);
+  YY_USE (scanner);
+  YY_USE (root);
   if (!yyvaluep)
     return;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
@@ -767,12 +775,12 @@ yy_symbol_value_print (FILE *yyo,
 
 static void
 yy_symbol_print (FILE *yyo,
-                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, ast_node ** root)
 {
   YYFPRINTF (yyo, "%s %s (",
              yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner, root);
   YYFPRINTF (yyo, ")");
 }
 
@@ -806,7 +814,7 @@ do {                                                            \
 
 static void
 yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
-                 int yyrule)
+                 int yyrule, yyscan_t scanner, ast_node ** root)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -819,7 +827,7 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
                        YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
-                       &yyvsp[(yyi + 1) - (yynrhs)]);
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner, root);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -827,7 +835,7 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, Rule); \
+    yy_reduce_print (yyssp, yyvsp, Rule, scanner, root); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
@@ -868,9 +876,11 @@ int yydebug;
 
 static void
 yydestruct (const char *yymsg,
-            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, yyscan_t scanner, ast_node ** root)
 {
   YY_USE (yyvaluep);
+  YY_USE (scanner);
+  YY_USE (root);
   if (!yymsg)
     yymsg = "Deleting";
   YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
@@ -881,13 +891,6 @@ yydestruct (const char *yymsg,
 }
 
 
-/* Lookahead token kind.  */
-int yychar;
-
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
-/* Number of syntax errors so far.  */
-int yynerrs;
 
 
 
@@ -897,8 +900,21 @@ int yynerrs;
 `----------*/
 
 int
-yyparse (void)
+yyparse (yyscan_t scanner, ast_node ** root)
 {
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
     yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
     int yyerrstatus = 0;
@@ -1051,7 +1067,7 @@ yybackup:
   if (yychar == YYEMPTY)
     {
       YYDPRINTF ((stderr, "Reading a token\n"));
-      yychar = yylex ();
+      yychar = yylex (&yylval, scanner);
     }
 
   if (yychar <= YYEOF)
@@ -1139,50 +1155,50 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* CompileUnit: FuncDef  */
-#line 75 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 94 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                       {
 
 		// 创建一个编译单元的节点AST_OP_COMPILE_UNIT
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT, (yyvsp[0].node));
 
-		// 设置到全局变量中
-		ast_root = (yyval.node);
+		// 通过yyparse的参数返回根节点
+		*root = (yyval.node);
 	}
-#line 1152 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1168 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 3: /* CompileUnit: VarDecl  */
-#line 83 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 102 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                   {
 
 		// 创建一个编译单元的节点AST_OP_COMPILE_UNIT
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT, (yyvsp[0].node));
-		ast_root = (yyval.node);
+		*root = (yyval.node);
 	}
-#line 1163 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1179 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 4: /* CompileUnit: CompileUnit FuncDef  */
-#line 89 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 108 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 
 		// 把函数定义的节点作为编译单元的孩子
 		(yyval.node) = (yyvsp[-1].node)->insert_son_node((yyvsp[0].node));
 	}
-#line 1173 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1189 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 5: /* CompileUnit: CompileUnit VarDecl  */
-#line 94 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 113 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		// 把变量定义的节点作为编译单元的孩子
 		(yyval.node) = (yyvsp[-1].node)->insert_son_node((yyvsp[0].node));
 	}
-#line 1182 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1198 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 6: /* FuncDef: BasicType T_ID T_L_PAREN T_R_PAREN Block  */
-#line 101 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 120 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                     {
 
 		// 函数返回类型
@@ -1201,78 +1217,78 @@ yyreduce:
 		// create_func_def函数内会释放funcId中指向的标识符空间，切记，之后不要再释放，之前一定要是通过strdup函数或者malloc分配的空间
 		(yyval.node) = create_func_def(funcReturnType, funcId, blockNode, formalParamsNode);
 	}
-#line 1205 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1221 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 7: /* Block: T_L_BRACE T_R_BRACE  */
-#line 124 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 143 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                             {
 		// 语句块没有语句
 
 		// 为了方便创建一个空的Block节点
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_BLOCK);
 	}
-#line 1216 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1232 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 8: /* Block: T_L_BRACE BlockItemList T_R_BRACE  */
-#line 130 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 149 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                             {
 		// 语句块含有语句
 
 		// BlockItemList归约时内部创建Block节点，并把语句加入，这里不创建Block节点
 		(yyval.node) = (yyvsp[-1].node);
 	}
-#line 1227 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1243 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 9: /* BlockItemList: BlockItem  */
-#line 141 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 160 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                           {
 		// 第一个左侧的孩子节点归约成Block节点，后续语句可持续作为孩子追加到Block节点中
 		// 创建一个AST_OP_BLOCK类型的中间节点，孩子为Statement($1)
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_BLOCK, (yyvsp[0].node));
 	}
-#line 1237 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1253 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 10: /* BlockItemList: BlockItemList BlockItem  */
-#line 146 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 165 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                   {
 		// 把BlockItem归约的节点加入到BlockItemList的节点中
 		(yyval.node) = (yyvsp[-1].node)->insert_son_node((yyvsp[0].node));
 	}
-#line 1246 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1262 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 11: /* BlockItem: Statement  */
-#line 155 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 174 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                        {
 		// 语句节点传递给归约后的节点上，综合属性
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1255 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1271 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 12: /* BlockItem: VarDecl  */
-#line 159 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 178 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                   {
 		// 变量声明节点传递给归约后的节点上，综合属性
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1264 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1280 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 13: /* VarDecl: VarDeclExpr T_SEMICOLON  */
-#line 170 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 189 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                   {
 		(yyval.node) = (yyvsp[-1].node);
 	}
-#line 1272 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1288 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 14: /* VarDeclExpr: BasicType VarDef  */
-#line 176 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 195 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 
 		// 创建类型节点
@@ -1285,11 +1301,11 @@ yyreduce:
 		// 创建变量声明语句，并加入第一个变量
 		(yyval.node) = create_var_decl_stmt_node(decl_node);
 	}
-#line 1289 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1305 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 15: /* VarDeclExpr: VarDeclExpr T_COMMA VarDef  */
-#line 188 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 207 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                      {
 
 		// 创建类型节点，这里从VarDeclExpr获取类型，前面已经设置
@@ -1301,11 +1317,11 @@ yyreduce:
 		// 插入到变量声明语句
 		(yyval.node) = (yyvsp[-2].node)->insert_son_node(decl_node);
 	}
-#line 1305 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1321 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 16: /* VarDef: T_ID  */
-#line 202 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 221 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
               {
 		// 变量ID
 
@@ -1314,143 +1330,143 @@ yyreduce:
 		// 对于字符型字面量的字符串空间需要释放，因词法用到了strdup进行了字符串复制
 		free((yyvsp[0].var_id).id);
 	}
-#line 1318 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1334 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 17: /* BasicType: T_INT  */
-#line 213 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 232 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                  {
 		(yyval.type) = (yyvsp[0].type);
 	}
-#line 1326 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1342 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 18: /* Statement: T_RETURN Expr T_SEMICOLON  */
-#line 222 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 241 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                       {
 		// 返回语句
 
 		// 创建返回节点AST_OP_RETURN，其孩子为Expr，即$2
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_RETURN, (yyvsp[-1].node));
 	}
-#line 1337 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1353 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 19: /* Statement: LVal T_ASSIGN Expr T_SEMICOLON  */
-#line 228 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 247 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                          {
 		// 赋值语句
 
 		// 创建一个AST_OP_ASSIGN类型的中间节点，孩子为LVal($1)和Expr($3)
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_ASSIGN, (yyvsp[-3].node), (yyvsp[-1].node));
 	}
-#line 1348 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1364 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 20: /* Statement: Block  */
-#line 234 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 253 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		// 语句块
 
 		// 内部已创建block节点，直接传递给Statement
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1359 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1375 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 21: /* Statement: Expr T_SEMICOLON  */
-#line 240 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 259 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                            {
 		// 表达式语句
 
 		// 内部已创建表达式，直接传递给Statement
 		(yyval.node) = (yyvsp[-1].node);
 	}
-#line 1370 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1386 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 22: /* Statement: T_SEMICOLON  */
-#line 246 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 265 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                       {
 		// 空语句
 
 		// 直接返回空指针，需要再把语句加入到语句块时要注意判断，空语句不要加入
 		(yyval.node) = nullptr;
 	}
-#line 1381 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1397 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 23: /* Expr: AddExp  */
-#line 256 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 275 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
               {
 		// 直接传递给归约后的节点
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1390 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1406 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 24: /* AddExp: UnaryExp  */
-#line 266 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 285 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                   {
 		// 一目表达式
 
 		// 直接传递到归约后的节点
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1401 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1417 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 25: /* AddExp: UnaryExp AddOp UnaryExp  */
-#line 272 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 291 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                   {
 		// 两个一目表达式的加减运算
 
 		// 创建加减运算节点，其孩子为两个一目表达式节点
 		(yyval.node) = create_contain_node(ast_operator_type((yyvsp[-1].op_class)), (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1412 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1428 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 26: /* AddExp: AddExp AddOp UnaryExp  */
-#line 278 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 297 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                 {
 		// 左递归形式可通过加减连接多个一元表达式
 
 		// 创建加减运算节点，孩子为AddExp($1)和UnaryExp($3)
 		(yyval.node) = create_contain_node(ast_operator_type((yyvsp[-1].op_class)), (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1423 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1439 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 27: /* AddOp: T_ADD  */
-#line 287 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 306 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
              {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_ADD;
 	}
-#line 1431 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1447 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 28: /* AddOp: T_SUB  */
-#line 290 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 309 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_SUB;
 	}
-#line 1439 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1455 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 29: /* UnaryExp: PrimaryExp  */
-#line 299 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 318 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                       {
 		// 基本表达式
 
 		// 传递到归约后的UnaryExp上
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1450 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1466 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 30: /* UnaryExp: T_ID T_L_PAREN T_R_PAREN  */
-#line 305 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 324 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                    {
 		// 没有实参的函数调用
 
@@ -1467,11 +1483,11 @@ yyreduce:
 		(yyval.node) = create_func_call(name_node, paramListNode);
 
 	}
-#line 1471 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1487 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 31: /* UnaryExp: T_ID T_L_PAREN RealParamList T_R_PAREN  */
-#line 321 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 340 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                  {
 		// 含有实参的函数调用
 
@@ -1487,60 +1503,60 @@ yyreduce:
 		// 创建函数调用节点，其孩子为被调用函数名和实参，实参不为空
 		(yyval.node) = create_func_call(name_node, paramListNode);
 	}
-#line 1491 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1507 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 32: /* PrimaryExp: T_L_PAREN Expr T_R_PAREN  */
-#line 340 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 359 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                        {
 		// 带有括号的表达式
 		(yyval.node) = (yyvsp[-1].node);
 	}
-#line 1500 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1516 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 33: /* PrimaryExp: T_DIGIT  */
-#line 344 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 363 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                   {
         	// 无符号整型字面量
 
 		// 创建一个无符号整型的终结符节点
 		(yyval.node) = ast_node::New((yyvsp[0].integer_num));
 	}
-#line 1511 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1527 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 34: /* PrimaryExp: LVal  */
-#line 350 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 369 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		// 具有左值的表达式
 
 		// 直接传递到归约后的非终结符号PrimaryExp
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1522 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1538 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 35: /* RealParamList: Expr  */
-#line 362 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 381 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                      {
 		// 创建实参列表节点，并把当前的Expr节点加入
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_FUNC_REAL_PARAMS, (yyvsp[0].node));
 	}
-#line 1531 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1547 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 36: /* RealParamList: RealParamList T_COMMA Expr  */
-#line 366 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 385 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                      {
 		// 左递归增加实参表达式
 		(yyval.node) = (yyvsp[-2].node)->insert_son_node((yyvsp[0].node));
 	}
-#line 1540 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1556 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 37: /* LVal: T_ID  */
-#line 373 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 392 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
             {
 		// 变量名终结符
 
@@ -1550,11 +1566,11 @@ yyreduce:
 		// 对于字符型字面量的字符串空间需要释放，因词法用到了strdup进行了字符串复制
 		free((yyvsp[0].var_id).id);
 	}
-#line 1554 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1570 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
 
-#line 1558 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1574 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
 
       default: break;
     }
@@ -1601,7 +1617,7 @@ yyerrlab:
   if (!yyerrstatus)
     {
       ++yynerrs;
-      yyerror (YY_("syntax error"));
+      yyerror (scanner, root, YY_("syntax error"));
     }
 
   if (yyerrstatus == 3)
@@ -1618,7 +1634,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval);
+                      yytoken, &yylval, scanner, root);
           yychar = YYEMPTY;
         }
     }
@@ -1674,7 +1690,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner, root);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -1712,7 +1728,7 @@ yyabortlab:
 | yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
 `-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (scanner, root, YY_("memory exhausted"));
   yyresult = 2;
   goto yyreturnlab;
 
@@ -1727,7 +1743,7 @@ yyreturnlab:
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval);
+                  yytoken, &yylval, scanner, root);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -1736,7 +1752,7 @@ yyreturnlab:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner, root);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
@@ -1747,11 +1763,13 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 384 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 403 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
 
 
 // 语法识别错误要调用函数的定义
-void yyerror(char * msg)
+void yyerror(yyscan_t scanner, ast_node ** root, const char * msg)
 {
-    printf("Line %d: %s\n", yylineno, msg);
+    (void) root;
+
+    minic_log(LOG_ERROR, "Line %d: %s", yyget_lineno(scanner), msg);
 }
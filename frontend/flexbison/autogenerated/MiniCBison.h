@@ -44,6 +44,13 @@
 #if YYDEBUG
 extern int yydebug;
 #endif
+/* "%code requires" blocks.  */
+#line 18 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+
+typedef void * yyscan_t;
+class ast_node;
+
+#line 54 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.h"
 
 /* Token kinds.  */
 #ifndef YYTOKENTYPE
@@ -75,7 +82,7 @@ extern int yydebug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 22 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 41 "/home/code/src/exp04-minic-expr/frontend/flexbison/MiniC.y"
 
     class ast_node * node;
 
@@ -85,7 +92,7 @@ union YYSTYPE
     struct type_attr type;
     int op_class;
 
-#line 89 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.h"
+#line 96 "/home/code/src/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -94,10 +101,9 @@ typedef union YYSTYPE YYSTYPE;
 #endif
 
 
-extern YYSTYPE yylval;
 
 
-int yyparse (void);
+int yyparse (yyscan_t scanner, ast_node ** root);
 
 
 #endif /* !YY_YY_HOME_CODE_SRC_EXP04_MINIC_EXPR_FRONTEND_FLEXBISON_AUTOGENERATED_MINICBISON_H_INCLUDED  */
@@ -13,6 +13,7 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include "Common.h"
 #include "RecursiveDescentExecutor.h"
 #include "RecursiveDescentFlex.h"
 #include "RecursiveDescentParser.h"
@@ -21,28 +22,28 @@
 /// @return true: 成功 false：错误
 bool RecursiveDescentExecutor::run()
 {
-    // 若指定有参数，则作为词法分析的输入文件
-    rd_filein = fopen(filename.c_str(), "r");
-    if (rd_filein == nullptr) {
-        printf("Can't open file %s\n", filename.c_str());
+    // 词法分析的输入文件映射到内存，词法分析直接按指针扫描
+    if (!source.open(filename)) {
+        minic_log(LOG_ERROR, "文件(%s)不能打开，可能不存在", filename.c_str());
         return false;
     }
 
+    scanner.cur = source.data();
+    scanner.end = source.data() + source.size();
+
     // 如果要查看LALR的移进与归约过程，请设置yydebug为1
     // yydebug = 1;
 
     // 词法、语法分析生成抽象语法树AST
-    astRoot = rd_parse();
-    if (!astRoot) {
+    astRoot = rd_parse(scanner);
 
-        // 关闭文件
-        fclose(rd_filein);
+    // 解除源文件的映射
+    source.close();
+    scanner.cur = scanner.end = nullptr;
 
+    if (!astRoot) {
         return false;
     }
 
-    // 关闭文件
-    fclose(rd_filein);
-
     return true;
 }
\ No newline at end of file
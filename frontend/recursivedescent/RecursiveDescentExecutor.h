@@ -14,6 +14,8 @@
 /// </table>
 ///
 #include "FrontEndExecutor.h"
+#include "MappedFile.h"
+#include "RecursiveDescentFlex.h"
 
 /// @brief 归下降分析执行器类
 class RecursiveDescentExecutor : public FrontEndExecutor {
@@ -30,4 +32,18 @@ public:
     /// @brief 前端词法与语法解析生成AST
     /// @return true: 成功 false：错误
     bool run() override;
+
+    /// @brief 词法分析器的状态由本对象拥有，语法分析的状态在rd_parse的局部变量中，因此可重入
+    /// @return true: 可重入
+    bool isReentrant() const override
+    {
+        return true;
+    }
+
+protected:
+    /// @brief 映射到内存的源文件
+    MappedFile source;
+
+    /// @brief 词法分析器的状态
+    RDScanner scanner;
 };
@@ -14,186 +14,383 @@
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
 /// </table>
 ///
-#include <cctype>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
-#include <string>
 
-#include "RecursiveDescentParser.h"
 #include "Common.h"
+#include "RecursiveDescentFlex.h"
 
-/// @brief 词法分析的行号信息
-int64_t rd_line_no = 1;
+/// @brief 字符的类别，词法分析按类别查表转移，不再逐个比较字符
+enum CharClass : uint8_t {
+    CC_OTHER,   // 非法字符
+    CC_SPACE,   // 空格与TAB
+    CC_NEWLINE, // \n
+    CC_CR,      // \r
+    CC_DIGIT,   // 数字
+    CC_LETTER,  // 字母与下划线
+    CC_PUNCT,   // 运算符与界符
+    CC_SLASH,   // /，除号或者注释的开始
+};
+
+/// @brief 运算符与界符的识别表项。single为单个字符的Token，
+/// 若下一个字符为second则为两个字符的Token pair，如<与<=。没有对应Token的为T_ERR
+struct PunctEntry {
+    RDTokenType single = RDTokenType::T_ERR;
+    char second = '\0';
+    RDTokenType pair = RDTokenType::T_ERR;
+};
+
+/// @brief 按字符索引的各个表
+struct CharTables {
+    /// @brief 字符的类别
+    CharClass cls[256]{};
+
+    /// @brief 运算符与界符
+    PunctEntry punct[256]{};
+
+    /// @brief 作为数字的值，十六进制的a~f为10~15，不是数字的为0xFF
+    uint8_t digit[256]{};
+};
+
+/// @brief 编译时生成字符表
+/// @return CharTables 字符表
+static constexpr CharTables buildCharTables()
+{
+    CharTables t{};
+
+    for (int c = 0; c < 256; c++) {
+        t.digit[c] = 0xFF;
+    }
+
+    t.cls[(uint8_t) ' '] = CC_SPACE;
+    t.cls[(uint8_t) '\t'] = CC_SPACE;
+    t.cls[(uint8_t) '\n'] = CC_NEWLINE;
+    t.cls[(uint8_t) '\r'] = CC_CR;
+
+    for (int c = '0'; c <= '9'; c++) {
+        t.cls[c] = CC_DIGIT;
+        t.digit[c] = (uint8_t) (c - '0');
+    }
+
+    for (int c = 'a'; c <= 'z'; c++) {
+        t.cls[c] = CC_LETTER;
+        t.cls[c - 'a' + 'A'] = CC_LETTER;
+    }
+    t.cls[(uint8_t) '_'] = CC_LETTER;
+
+    for (int c = 0; c < 6; c++) {
+        t.digit['a' + c] = (uint8_t) (10 + c);
+        t.digit['A' + c] = (uint8_t) (10 + c);
+    }
 
-/// @brief 词法分析的token对应的字符识别
-std::string tokenValue;
+    struct {
+        char c;
+        RDTokenType single;
+        char second;
+        RDTokenType pair;
+    } const puncts[] = {
+        {'(', RDTokenType::T_L_PAREN, '\0', RDTokenType::T_ERR},
+        {')', RDTokenType::T_R_PAREN, '\0', RDTokenType::T_ERR},
+        {'{', RDTokenType::T_L_BRACE, '\0', RDTokenType::T_ERR},
+        {'}', RDTokenType::T_R_BRACE, '\0', RDTokenType::T_ERR},
+        {'[', RDTokenType::T_L_BRACKET, '\0', RDTokenType::T_ERR},
+        {']', RDTokenType::T_R_BRACKET, '\0', RDTokenType::T_ERR},
+        {';', RDTokenType::T_SEMICOLON, '\0', RDTokenType::T_ERR},
+        {',', RDTokenType::T_COMMA, '\0', RDTokenType::T_ERR},
+        {'+', RDTokenType::T_ADD, '\0', RDTokenType::T_ERR},
+        {'-', RDTokenType::T_SUB, '\0', RDTokenType::T_ERR},
+        {'*', RDTokenType::T_MUL, '\0', RDTokenType::T_ERR},
+        {'/', RDTokenType::T_DIV, '\0', RDTokenType::T_ERR},
+        {'%', RDTokenType::T_MOD, '\0', RDTokenType::T_ERR},
+        {'=', RDTokenType::T_ASSIGN, '=', RDTokenType::T_EQ},
+        {'<', RDTokenType::T_LT, '=', RDTokenType::T_LE},
+        {'>', RDTokenType::T_GT, '=', RDTokenType::T_GE},
+        {'!', RDTokenType::T_LOGIC_NOT, '=', RDTokenType::T_NE},
+        {'&', RDTokenType::T_ERR, '&', RDTokenType::T_LOGIC_AND},
+        {'|', RDTokenType::T_ERR, '|', RDTokenType::T_LOGIC_OR},
+    };
 
-/// @brief 输入源文件指针
-FILE * rd_filein;
+    for (auto & p: puncts) {
+        t.cls[(uint8_t) p.c] = CC_PUNCT;
+        t.punct[(uint8_t) p.c] = PunctEntry{p.single, p.second, p.pair};
+    }
+
+    t.cls[(uint8_t) '/'] = CC_SLASH;
+
+    return t;
+}
+
+/// @brief 字符表，编译时生成
+static constexpr CharTables charTables = buildCharTables();
 
 /// @brief 关键字与Token类别的数据结构
 struct KeywordToken {
-    std::string name;
-    enum RDTokenType type;
+    const char * name = nullptr;
+    size_t length = 0;
+    RDTokenType type = RDTokenType::T_ID;
 };
 
 /// @brief  关键字与Token对应表
-static KeywordToken allKeywords[] = {
-    {"int", RDTokenType::T_INT},
-    {"return", RDTokenType::T_RETURN},
+static constexpr KeywordToken allKeywords[] = {
+    {"int", 3, RDTokenType::T_INT},
+    {"void", 4, RDTokenType::T_VOID},
+    {"return", 6, RDTokenType::T_RETURN},
+    {"if", 2, RDTokenType::T_IF},
+    {"else", 4, RDTokenType::T_ELSE},
+    {"while", 5, RDTokenType::T_WHILE},
+    {"break", 5, RDTokenType::T_BREAK},
+    {"continue", 8, RDTokenType::T_CONTINUE},
 };
 
-/// @brief 在标识符中检查是否时关键字，若是关键字则返回对应关键字的Token，否则返回T_ID
-/// @param id 标识符
-/// @return Token
-static RDTokenType getKeywordToken(std::string id)
+/// @brief 关键字散列表的大小
+static constexpr size_t keywordSlots = 16;
+
+/// @brief 关键字的散列函数，由首尾两个字符计算，对上面的关键字是完美散列(没有冲突)
+/// @param first 首字符
+/// @param last 尾字符
+/// @return size_t 散列表的下标
+static constexpr size_t keywordHash(unsigned char first, unsigned char last)
+{
+    return (first + 5u * last) & (keywordSlots - 1);
+}
+
+/// @brief 关键字散列表
+struct KeywordTable {
+    KeywordToken slots[keywordSlots]{};
+};
+
+/// @brief 编译时生成关键字散列表
+/// @return KeywordTable 散列表
+static constexpr KeywordTable buildKeywordTable()
 {
-    //如果在allkeywords中找到，则说明为关键字
+    KeywordTable t{};
+
     for (auto & keyword: allKeywords) {
-        if (keyword.name == id) {
-            return keyword.type;
+        t.slots[keywordHash(keyword.name[0], keyword.name[keyword.length - 1])] = keyword;
+    }
+
+    return t;
+}
+
+/// @brief 检查关键字的散列值互不相同
+/// @return true 完美散列
+static constexpr bool keywordHashIsPerfect()
+{
+    constexpr size_t count = sizeof(allKeywords) / sizeof(allKeywords[0]);
+
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = 0; j < i; j++) {
+            if (keywordHash(allKeywords[i].name[0], allKeywords[i].name[allKeywords[i].length - 1]) ==
+                keywordHash(allKeywords[j].name[0], allKeywords[j].name[allKeywords[j].length - 1])) {
+                return false;
+            }
         }
     }
-    // 如果不再allkeywords中，说明是标识符
+
+    return true;
+}
+
+static_assert(keywordHashIsPerfect(), "关键字散列有冲突，请调整keywordHash");
+
+/// @brief 关键字散列表，编译时生成
+static constexpr KeywordTable keywordTable = buildKeywordTable();
+
+/// @brief 在标识符中检查是否时关键字，若是关键字则返回对应关键字的Token，否则返回T_ID
+/// @param id 标识符的起始位置
+/// @param length 标识符的长度
+/// @return Token
+static RDTokenType getKeywordToken(const char * id, size_t length)
+{
+    const KeywordToken & keyword = keywordTable.slots[keywordHash(id[0], id[length - 1])];
+
+    if ((keyword.length == length) && (memcmp(keyword.name, id, length) == 0)) {
+        return keyword.type;
+    }
+
+    // 不是关键字，说明是标识符
     return RDTokenType::T_ID;
 }
 
-/// @brief 词法文法，获取下一个Token
-/// @return  Token，值保存在rd_lval中
-int rd_flex()
+/// @brief 跳过空白符号与注释，并统计行号
+/// @param scanner 词法分析器
+/// @param p 开始位置
+/// @return const char* 下一个Token的开始位置，多行注释没有结束时为空指针
+static const char * skipBlank(RDScanner & scanner, const char * p)
 {
-    int c;              // 扫描的字符
-    int tokenKind = -1; // Token的值
-
-    // 忽略空白符号，主要有空格，TAB键和换行符
-    while ((c = fgetc(rd_filein)) == ' ' || c == '\t' || c == '\n' || c == '\r') {
-
-        // 支持Linux/Windows/Mac系统的行号分析
-        // Windows：\r\n
-        // Mac: \n
-        // Unix(Linux): \r
-        if (c == '\r') {
-            c = fgetc(rd_filein);
-            rd_line_no++;
-            if (c != '\n') {
-                // 不是\n，则回退
-                ungetc(c, rd_filein);
-            }
-        } else if (c == '\n') {
-            rd_line_no++;
+    const char * end = scanner.end;
+
+    while (p < end) {
+        switch (charTables.cls[(unsigned char) *p]) {
+            case CC_SPACE:
+                p++;
+                break;
+            case CC_NEWLINE:
+                // Unix(Linux): \n
+                p++;
+                scanner.lineNo++;
+                break;
+            case CC_CR:
+                // Windows：\r\n，Mac: \r
+                p++;
+                scanner.lineNo++;
+                if (p < end && *p == '\n') {
+                    p++;
+                }
+                break;
+            case CC_SLASH:
+                if (p + 1 < end && p[1] == '/') {
+                    // 单行注释，换行符留给下一轮统计行号
+                    p += 2;
+                    while (p < end && *p != '\n' && *p != '\r') {
+                        p++;
+                    }
+                } else if (p + 1 < end && p[1] == '*') {
+                    // 多行注释
+                    p += 2;
+                    for (;;) {
+                        if (p >= end) {
+                            return nullptr;
+                        }
+
+                        if (*p == '*' && p + 1 < end && p[1] == '/') {
+                            p += 2;
+                            break;
+                        }
+
+                        if (*p == '\n') {
+                            scanner.lineNo++;
+                        } else if (*p == '\r') {
+                            scanner.lineNo++;
+                            if (p + 1 < end && p[1] == '\n') {
+                                p++;
+                            }
+                        }
+                        p++;
+                    }
+                } else {
+                    // 除号
+                    return p;
+                }
+                break;
+            default:
+                return p;
         }
     }
 
+    return p;
+}
+
+/// @brief 词法文法，获取下一个Token
+/// @param scanner 词法分析器
+/// @return  Token，值保存在scanner.lval中
+int rd_flex(RDScanner & scanner)
+{
+    const char * end = scanner.end;
+    const char * p = skipBlank(scanner, scanner.cur);
+
+    if (!p) {
+        scanner.cur = end;
+        minic_log(LOG_ERROR, "Line(%lld): Unterminated comment", (long long) scanner.lineNo);
+        return RDTokenType::T_ERR;
+    }
+
     // 文件结束符
-    if (c == EOF) {
-        // 返回文件结束符
+    if (p == end) {
+        scanner.cur = end;
+        scanner.tokenText = end;
+        scanner.tokenLength = 0;
         return RDTokenType::T_EOF;
     }
 
-    // TODO 请自行实现删除源文件中的注释，含单行注释和多行注释等
+    const char * start = p;
+    unsigned char c = (unsigned char) *p;
+    int tokenKind = RDTokenType::T_ERR;
 
-    // 处理数字
-    if (isdigit(c)) {
+    switch (charTables.cls[c]) {
+        case CC_DIGIT: {
+            // 无符号整数，0x开头的为十六进制，其它0开头的为八进制
+            uint32_t val = 0;
 
-        // 识别无符号数，这里只处理正整数或者0
-        // FIXME 0开头的整数这里也识别成了10进制整数，在C语言中0开头的数字串是8进制数字
+            if (c == '0' && p + 2 < end && (p[1] == 'x' || p[1] == 'X') &&
+                charTables.digit[(unsigned char) p[2]] < 16) {
+                p += 2;
+                while (p < end && charTables.digit[(unsigned char) *p] < 16) {
+                    val = val * 16 + charTables.digit[(unsigned char) *p++];
+                }
+            } else {
+                uint32_t radix = (c == '0') ? 8 : 10;
 
-        rd_lval.integer_num.lineno = rd_line_no;
-        rd_lval.integer_num.val = c - '0';
+                // 0只有一位，其后的八进制数字另算
+                p++;
+                val = c - '0';
+                while (p < end && charTables.digit[(unsigned char) *p] < radix) {
+                    val = val * radix + charTables.digit[(unsigned char) *p++];
+                }
+            }
 
-        // 最长匹配，直到非数字结束
-        while (isdigit(c = fgetc(rd_filein))) {
-            rd_lval.integer_num.val = rd_lval.integer_num.val * 10 + c - '0';
+            scanner.lval.integer_num.val = val;
+            scanner.lval.integer_num.lineno = scanner.lineNo;
+            tokenKind = RDTokenType::T_DIGIT;
+            break;
         }
+        case CC_LETTER: {
+            // 识别标识符，包含关键字/保留字或自定义标识符，最长匹配
+            do {
+                p++;
+            } while (p < end && (charTables.cls[(unsigned char) *p] == CC_LETTER ||
+                                 charTables.cls[(unsigned char) *p] == CC_DIGIT));
 
-        // 存储数字的token值
-        tokenValue = std::to_string(rd_lval.integer_num.val);
-
-        // 多读的字符回退
-        ungetc(c, rd_filein);
-
-        tokenKind = RDTokenType::T_DIGIT;
-    } else if (c == '(') {
-        // 识别字符(
-        tokenKind = RDTokenType::T_L_PAREN;
-        // 存储字符(
-        tokenValue = "(";
-    } else if (c == ')') {
-        // 识别字符)
-        tokenKind = RDTokenType::T_R_PAREN;
-        // 存储字符)
-        tokenValue = ")";
-    } else if (c == '{') {
-        // 识别字符{
-        tokenKind = RDTokenType::T_L_BRACE;
-        // 存储字符{
-        tokenValue = "{";
-    } else if (c == '}') {
-        // 识别字符}
-        tokenKind = RDTokenType::T_R_BRACE;
-        // 存储字符}
-        tokenValue = "}";
-    } else if (c == ';') {
-        // 识别字符;
-        tokenKind = RDTokenType::T_SEMICOLON;
-        // 存储字符;
-        tokenValue = ";";
-    } else if (c == '+') {
-        // 识别字符+
-        tokenKind = RDTokenType::T_ADD;
-		// 存储字符+
-        tokenValue = "+";
-    } else if (c == '-') {
-        // 识别字符-
-        tokenKind = RDTokenType::T_SUB;
-		// 存储字符-
-        tokenValue = "-";
-    } else if (c == '=') {
-        // 识别字符=
-        tokenKind = RDTokenType::T_ASSIGN;
-    }  else if (c == ',') {
-        // 识别字符;
-        tokenKind = RDTokenType::T_COMMA;
-		// 存储字符,
-        tokenValue = ",";
-    } else if (isLetterUnderLine(c)) {
-        // 识别标识符，包含关键字/保留字或自定义标识符
-
-        // 最长匹配标识符
-        std::string name;
-
-        do {
-            // 记录字符
-            name.push_back(c);
-            c = fgetc(rd_filein);
-        } while (isLetterDigitalUnderLine(c));
-
-        // 存储标识符
-        tokenValue = name;
-
-        // 多读的字符恢复，下次可继续读到该字符
-        ungetc(c, rd_filein);
-
-        // 检查是否是关键字，若是则返回对应的Token，否则返回T_ID
-        tokenKind = getKeywordToken(name);
-        if (tokenKind == RDTokenType::T_ID) {
-            // 自定义标识符
-
-            // 设置ID的值
-            rd_lval.var_id.id = strdup(name.c_str());
-
-            // 设置行号
-            rd_lval.var_id.lineno = rd_line_no;
-        } else if (tokenKind == RDTokenType::T_INT) {
-            // int关键字
-
-            // 设置类型与行号
-            rd_lval.type.type = BasicType::TYPE_INT;
-            rd_lval.type.lineno = rd_line_no;
+            size_t length = (size_t) (p - start);
+
+            // 检查是否是关键字，若是则返回对应的Token，否则返回T_ID
+            tokenKind = getKeywordToken(start, length);
+            if (tokenKind == RDTokenType::T_ID) {
+                // 自定义标识符，名字由AST接管后释放
+                char * id = (char *) malloc(length + 1);
+                memcpy(id, start, length);
+                id[length] = '\0';
+
+                scanner.lval.var_id.id = id;
+                scanner.lval.var_id.lineno = scanner.lineNo;
+            } else if (tokenKind == RDTokenType::T_INT) {
+                scanner.lval.type.type = BasicType::TYPE_INT;
+                scanner.lval.type.lineno = scanner.lineNo;
+            } else if (tokenKind == RDTokenType::T_VOID) {
+                scanner.lval.type.type = BasicType::TYPE_VOID;
+                scanner.lval.type.lineno = scanner.lineNo;
+            }
+            break;
+        }
+        case CC_PUNCT:
+        case CC_SLASH: {
+            // 运算符与界符，先看能否与下一个字符组成两个字符的Token
+            const PunctEntry & entry = charTables.punct[c];
+            if (entry.second != '\0' && p + 1 < end && p[1] == entry.second) {
+                tokenKind = entry.pair;
+                p += 2;
+            } else {
+                tokenKind = entry.single;
+                p++;
+            }
+            break;
         }
-    } else {
-        printf("Line(%lld): Invalid char %s\n", (long long) rd_line_no, tokenValue.c_str());
-        tokenKind = RDTokenType::T_ERR;
+        default:
+            p++;
+            break;
+    }
+
+    scanner.cur = p;
+    scanner.tokenText = start;
+    scanner.tokenLength = (size_t) (p - start);
+
+    if (tokenKind == RDTokenType::T_ERR) {
+        minic_log(LOG_ERROR,
+                  "Line(%lld): Invalid char %.*s",
+                  (long long) scanner.lineNo,
+                  (int) scanner.tokenLength,
+                  scanner.tokenText);
     }
 
     // Token的类别
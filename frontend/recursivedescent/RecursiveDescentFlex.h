@@ -15,13 +15,36 @@
 ///
 #pragma once
 
-#include <stdio.h>
+#include <cstddef>
+#include <cstdint>
 
-// 行号信息
-extern int rd_line_no;
+#include "RecursiveDescentParser.h"
 
-// 输入文件指针
-extern FILE * rd_filein;
+///
+/// @brief 词法分析器的状态，由RecursiveDescentExecutor拥有，各次分析互不干扰，从而可重入
+///
+struct RDScanner {
+
+    /// @brief 当前扫描位置，源文件已映射到内存，直接按指针扫描
+    const char * cur = nullptr;
+
+    /// @brief 源文件内容的结束位置
+    const char * end = nullptr;
+
+    /// @brief 行号信息
+    int64_t lineNo = 1;
+
+    /// @brief 词法识别的记号在源文件中的原始文本，不复制，只在源文件映射期间有效
+    const char * tokenText = nullptr;
+
+    /// @brief 记号原始文本的字节数
+    size_t tokenLength = 0;
+
+    /// @brief 词法与语法分析数据交互的Token的值
+    RDSType lval;
+};
 
 /// 识别词法
-int rd_flex();
+/// @param scanner 词法分析器
+/// @return Token，值保存在scanner.lval中
+int rd_flex(RDScanner & scanner);
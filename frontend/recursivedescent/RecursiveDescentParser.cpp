@@ -15,44 +15,59 @@
 /// </table>
 ///
 #include <stdarg.h>
+#include <cstdlib>
+#include <vector>
 
 #include "AST.h"
 #include "AttrType.h"
+#include "Common.h"
 #include "RecursiveDescentFlex.h"
 #include "RecursiveDescentParser.h"
 
-// 定义全局变量给词法分析使用，用于填充值
-RDSType rd_lval;
+///
+/// @brief 递归下降语法分析的状态，作为rd_parse的局部变量，各次分析互不干扰，从而可重入
+///
+struct RDParser {
 
-// 词法识别的记号值，原始文本字符串
-extern std::string tokenValue;
+    /// @brief 词法分析器，Token的值与行号等从其中获取
+    RDScanner & scanner;
 
-// 语法分析过程中的错误数目
-static int errno_num = 0;
+    /// @brief 语法分析过程中的LookAhead，指向下一个Token
+    RDTokenType lookaheadTag = RDTokenType::T_EMPTY;
 
-// 语法分析过程中的LookAhead，指向下一个Token
-static RDTokenType lookaheadTag = RDTokenType::T_EMPTY;
+    /// @brief 语法分析过程中的错误数目
+    int errno_num = 0;
+};
 
-static ast_node * Block();
-static ast_node * expr();
+static ast_node * Block(RDParser & p);
+static ast_node * statement(RDParser & p);
+static ast_node * expr(RDParser & p);
+static ast_node * unaryExp(RDParser & p);
 
 ///
 /// @brief 继续检查LookAhead指向的记号是否是T，用于符号的FIRST集合或Follow集合判断
 ///
-#define _(T) || (lookaheadTag == T)
+#define _(T) || (p.lookaheadTag == T)
 
 ///
 /// @brief 第一个检查LookAhead指向的记号是否属于C，用于符号的FIRST集合或Follow集合判断
 /// 如判断是否是T_ID，或者T_INT，可结合F和_两个宏来实现，即F(T_ID) _(T_INT)
 ///
-#define F(C) (lookaheadTag == C)
+#define F(C) (p.lookaheadTag == C)
 
 ///
-/// @brief lookahead指向下一个Token
+/// @brief lookahead指向下一个Token。非法记号已由词法分析输出错误信息，这里计入错误数目后跳过
 ///
-static void advance()
+static void advance(RDParser & p)
 {
-    lookaheadTag = (RDTokenType) rd_flex();
+    for (;;) {
+        p.lookaheadTag = (RDTokenType) rd_flex(p.scanner);
+        if (p.lookaheadTag != RDTokenType::T_ERR) {
+            break;
+        }
+
+        p.errno_num++;
+    }
 }
 
 ///
@@ -60,7 +75,7 @@ static void advance()
 /// @param tag 是否匹配指定的Tag
 /// @return true：匹配，false：未匹配
 ///
-static bool match(RDTokenType tag)
+static bool match(RDParser & p, RDTokenType tag)
 {
     bool result = false;
 
@@ -69,7 +84,7 @@ static bool match(RDTokenType tag)
         result = true;
 
         // 匹配，则向前获取下一个Token
-        advance();
+        advance(p);
     }
 
     return result;
@@ -79,7 +94,7 @@ static bool match(RDTokenType tag)
 /// @brief 语法错误输出
 /// @param format 格式化字符串，和printf的格式化字符串一样
 ///
-static void semerror(const char * format, ...)
+static void semerror(RDParser & p, const char * format, ...)
 {
     char logStr[1024];
 
@@ -91,106 +106,118 @@ static void semerror(const char * format, ...)
 
     va_end(ap);
 
-    printf("Line(%d): %s\n", rd_line_no, logStr);
+    // 错误通过日志输出到标准错误或者日志文件，不与-o -输出到标准输出的内容混在一起
+    minic_log(LOG_ERROR, "Line(%lld): %s", (long long) p.scanner.lineNo, logStr);
 
-    errno_num++;
+    p.errno_num++;
 }
 
 ///
-/// @brief 实参列表语法分析，文法: realParamList: expr (T_COMMA expr)*;
-/// @return ast_node* 实参列表节点
+/// @brief 由词法识别的标识符创建标识符节点，并释放词法分配的标识符空间
+/// @param id 标识符
+/// @return ast_node* 标识符节点
 ///
-static void realParamList(ast_node * realParamsNode)
+static ast_node * idNode(var_id_attr & id)
 {
-    // 实参表达式expr识别
-    ast_node * param_node = expr();
-    if (!param_node) {
-
-        // 不是合法的实参
-        return;
-    }
-
-    // 实参作为孩子插入到父节点realParamsNode中
-    (void) realParamsNode->insert_son_node(param_node);
-
-    // 后续是一个闭包(T_COMMA expr)*，即循环，不断的识别逗号与实参
-    for (;;) {
+    ast_node * node = ast_node::New(id);
 
-        // 识别逗号
-        if (match(T_COMMA)) {
+    // 词法为标识符分配了空间，这里释放
+    free(id.id);
+    id.id = nullptr;
 
-            // 识别实参
-            param_node = expr();
+    return node;
+}
 
-            (void) realParamsNode->insert_son_node(param_node);
-        } else {
+///
+/// @brief 实参列表语法分析，文法: realParamList: expr (T_COMMA expr)*;
+/// @param realParamsNode 实参列表节点，实参作为其孩子
+///
+static void realParamList(RDParser & p, ast_node * realParamsNode)
+{
+    do {
+        // 实参表达式expr识别
+        ast_node * param_node = expr(p);
+        if (!param_node) {
+            semerror(p, "不是合法的实参");
+            return;
+        }
 
-            // 不是逗号，则说明没有实参，可终止循环
+        // 实参作为孩子插入到父节点realParamsNode中
+        (void) realParamsNode->insert_son_node(param_node);
 
-            break;
-        }
-    }
+        // 后续是一个闭包(T_COMMA expr)*，即循环，不断的识别逗号与实参
+    } while (match(p, T_COMMA));
 }
 
 ///
-/// @brief 识别ID尾部符号，可以是括号，代表函数调用；可以是中括号，代表数组（暂不支持）；可以是空串，代表简单变量
-/// 其文法为 idTail: T_L_PAREN realParamList? T_R_PAREN | ε
-/// @return ast_node*
+/// @brief 识别ID尾部符号，可以是括号，代表函数调用；可以是中括号，代表数组访问；可以是空串，代表简单变量
+/// 其文法为 idTail: T_L_PAREN realParamList? T_R_PAREN | (T_L_BRACKET expr T_R_BRACKET)*
+/// @param id 已识别的标识符
+/// @return ast_node* 函数调用、数组访问或者变量节点
 ///
-static ast_node * idTail(var_id_attr & id)
+static ast_node * idTail(RDParser & p, var_id_attr & id)
 {
     // 标识符节点
-    ast_node * node = ast_node::New(id);
-
-    // 对于字符型字面量的字符串空间需要释放，因词法用到了strdup进行了字符串空间的分配
-    free(id.id);
-    id.id = nullptr;
+    ast_node * node = idNode(id);
 
-    if (match(T_L_PAREN)) {
+    if (match(p, T_L_PAREN)) {
 
         // 函数调用，idTail: T_L_PAREN realParamList? T_R_PAREN
 
-        ast_node * realParamsNode = create_contain_node(ast_operator_type::AST_OP_FUNC_REAL_PARAMS);
+        ast_node * realParamsNode = nullptr;
 
-        if (match(T_R_PAREN)) {
+        if (!F(T_R_PAREN)) {
+
+            // 识别实参列表
+            realParamsNode = create_contain_node(ast_operator_type::AST_OP_FUNC_REAL_PARAMS);
+            realParamList(p, realParamsNode);
+        }
 
-            // 被调用函数没有实参，返回一个空的实参清单节点
-            return realParamsNode;
+        if (!match(p, T_R_PAREN)) {
+            semerror(p, "函数调用缺少右括号");
         }
 
-        // 识别实参列表
-        realParamList(realParamsNode);
+        // 创建函数调用节点，没有实参时内部创建空的实参列表节点
+        return create_func_call(node, realParamsNode);
+    }
+
+    // 左值，lVal: T_ID (T_L_BRACKET expr T_R_BRACKET)*
+    std::vector<ast_node *> indices;
+    while (match(p, T_L_BRACKET)) {
 
-        if (!match(T_R_PAREN)) {
-            semerror("函数调用缺少右括号");
+        ast_node * index = expr(p);
+        if (!index) {
+            semerror(p, "数组下标不是合法的表达式");
+            break;
         }
 
-        // 创建函数调用节点
-        node = create_func_call(node, realParamsNode);
-    } else {
-        // 变量ID，idTail -> ε
+        indices.push_back(index);
 
-        // 前面已经创建，可直接使用，无动作
+        if (!match(p, T_R_BRACKET)) {
+            semerror(p, "数组下标缺少右中括号");
+            break;
+        }
     }
 
-    return node;
+    if (indices.empty()) {
+        // 简单变量
+        return node;
+    }
+
+    // 数组访问
+    ast_node * array_access_node = create_array_access(node, indices);
+    array_access_node->access_depth = indices.size();
+
+    return array_access_node;
 }
 
 ///
-/// @brief 一元表达式文法识别，其文法为
-/// unaryExp: primaryExp | T_ID T_L_PAREN realParamList? T_R_PAREN
-/// primaryExp: T_DIGIT | T_L_PAREN expr T_R_PAREN | lVal
-/// lVal: T_ID
-/// 因primaryExp的FIRST集合包含T_ID，因此该文法产生式不是LL(1)的，需要进行改造
-/// 改造后的文法为：
-/// unaryExp: T_DIGIT | T_L_PAREN expr T_R_PAREN | T_ID idTail
-/// idTail: T_L_PAREN realParamList? T_R_PAREN | ε
-/// 其中idTail表示标识符ID后可以是括号，代表函数调用；
-/// 可以是中括号，代表数组（暂不支持）；
-/// 可以是空串，代表简单变量。
+/// @brief 基本表达式文法识别，其文法为
+/// primaryExp: T_DIGIT | T_L_PAREN expr T_R_PAREN | T_ID idTail
+/// 函数调用T_ID T_L_PAREN realParamList? T_R_PAREN与左值lVal都以T_ID开头，因此提取公共前缀改造为T_ID idTail
 /// @return ast_node*
 ///
-static ast_node * unaryExp()
+static ast_node * primaryExp(RDParser & p)
 {
     ast_node * node = nullptr;
 
@@ -198,323 +225,514 @@ static ast_node * unaryExp()
 
         // 无符号整数，primaryExp: T_DIGIT
 
-        node = ast_node::New(rd_lval.integer_num);
+        node = ast_node::New(p.scanner.lval.integer_num);
 
         // 跳过当前记号，指向下一个记号
-        advance();
+        advance(p);
 
-    } else if (match(T_L_PAREN)) {
+    } else if (match(p, T_L_PAREN)) {
 
         // 括号表达式，primaryExp: T_L_PAREN expr T_R_PAREN
 
         // 括号内表达式识别
-        node = expr();
+        node = expr(p);
 
-        if (!match(T_R_PAREN)) {
-            semerror("缺少右括号");
+        if (!match(p, T_R_PAREN)) {
+            semerror(p, "缺少右括号");
         }
     } else if (F(T_ID)) {
 
-        // ID开头的表达式，可以是函数调用，也可以是数组(目前不支持)，或者简单变量，primaryExp: T_ID idTail
+        // ID开头的表达式，可以是函数调用，也可以是数组访问，或者简单变量，primaryExp: T_ID idTail
 
-        var_id_attr & id = rd_lval.var_id;
+        // 这里必须复制，而不能引用，因为Token的值在下一个记号识别后要被覆盖
+        var_id_attr id = p.scanner.lval.var_id;
 
         // 跳过当前记号，指向下一个记号
-        advance();
+        advance(p);
 
         // 识别ID尾部符号
-        node = idTail(id);
+        node = idTail(p, id);
     }
 
     return node;
 }
 
 ///
-/// @brief 加减运算符, 其文法为addOp : T_ADD | T_SUB;
-/// @return ast_operator_type AST中节点的运算符
+/// @brief 一元表达式文法识别，其文法为
+/// unaryExp: T_SUB unaryExp | T_LOGIC_NOT unaryExp | primaryExp
+/// 对整数字面量求负时直接产生负的字面量
+/// @return ast_node*
 ///
-ast_operator_type addOp()
+static ast_node * unaryExp(RDParser & p)
 {
-    ast_operator_type type = ast_operator_type::AST_OP_MAX;
+    if (match(p, T_SUB)) {
 
-    if (F(T_ADD)) {
+        ast_node * node = unaryExp(p);
+        if (!node) {
+            semerror(p, "负号后缺少操作数");
+            return nullptr;
+        }
 
-        type = ast_operator_type::AST_OP_ADD;
+        // 常量直接求负
+        if (node->node_type == ast_operator_type::AST_OP_LEAF_LITERAL_UINT) {
+            node->integer_val = -((int32_t) node->integer_val);
+            return node;
+        }
 
-        // 跳过当前的记号，指向下一个记号
-        advance();
-    } else if (F(T_SUB)) {
+        return ast_node::New(ast_operator_type::AST_OP_NEG, node, nullptr, nullptr);
+    }
 
-        type = ast_operator_type::AST_OP_SUB;
+    if (match(p, T_LOGIC_NOT)) {
 
-        // 跳过当前的记号，指向下一个记号
-        advance();
+        ast_node * node = unaryExp(p);
+        if (!node) {
+            semerror(p, "逻辑非后缺少操作数");
+            return nullptr;
+        }
+
+        return ast_node::New(ast_operator_type::AST_OP_LOGIC_NOT, node, nullptr, nullptr);
     }
 
-    return type;
+    return primaryExp(p);
 }
 
 ///
-/// @brief 加减表达式，文法 addExp : unaryExp (addOp unaryExp)*
-/// 其中的*表示闭包，闭包的就是循环
+/// @brief 二元运算符的优先级，数值越大优先级越高，不是二元运算符时为0
+/// @param tag 记号
+/// @return int 优先级
+///
+static int binaryPrecedence(RDTokenType tag)
+{
+    switch (tag) {
+        case T_LOGIC_OR:
+            return 1;
+        case T_LOGIC_AND:
+            return 2;
+        case T_EQ:
+        case T_NE:
+            return 3;
+        case T_LT:
+        case T_GT:
+        case T_LE:
+        case T_GE:
+            return 4;
+        case T_ADD:
+        case T_SUB:
+            return 5;
+        case T_MUL:
+        case T_DIV:
+        case T_MOD:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
 ///
+/// @brief 二元运算符对应的AST节点运算符
+/// @param tag 记号
+/// @return ast_operator_type AST中节点的运算符
+///
+static ast_operator_type binaryOperator(RDTokenType tag)
+{
+    switch (tag) {
+        case T_LOGIC_OR:
+            return ast_operator_type::AST_OP_LOGIC_OR;
+        case T_LOGIC_AND:
+            return ast_operator_type::AST_OP_LOGIC_AND;
+        case T_EQ:
+            return ast_operator_type::AST_OP_EQ;
+        case T_NE:
+            return ast_operator_type::AST_OP_NE;
+        case T_LT:
+            return ast_operator_type::AST_OP_LT;
+        case T_GT:
+            return ast_operator_type::AST_OP_GT;
+        case T_LE:
+            return ast_operator_type::AST_OP_LE;
+        case T_GE:
+            return ast_operator_type::AST_OP_GE;
+        case T_ADD:
+            return ast_operator_type::AST_OP_ADD;
+        case T_SUB:
+            return ast_operator_type::AST_OP_SUB;
+        case T_MUL:
+            return ast_operator_type::AST_OP_MUL;
+        case T_DIV:
+            return ast_operator_type::AST_OP_DIV;
+        case T_MOD:
+            return ast_operator_type::AST_OP_MOD;
+        default:
+            return ast_operator_type::AST_OP_MAX;
+    }
+}
+
+///
+/// @brief 二元运算表达式，按优先级爬升法识别，文法为
+/// lorExp: landExp (T_LOGIC_OR landExp)*
+/// landExp: eqExp (T_LOGIC_AND eqExp)*
+/// eqExp: relExp ((T_EQ | T_NE) relExp)*
+/// relExp: addExp ((T_LT | T_GT | T_LE | T_GE) addExp)*
+/// addExp: mulDivExp ((T_ADD | T_SUB) mulDivExp)*
+/// mulDivExp: unaryExp ((T_MUL | T_DIV | T_MOD) unaryExp)*
+/// 各层都是左结合。不再每层一个函数逐层递归，只有遇到优先级更高的运算符时才递归，
+/// 一元表达式不论处于哪个优先级，都只经过一次调用
+/// @param minPrecedence 本次可以识别的运算符的最低优先级
 /// @return ast_node*
 ///
-static ast_node * addExp()
+static ast_node * binaryExp(RDParser & p, int minPrecedence)
 {
-    // 识别第一个unaryExp
-    ast_node * left_node = unaryExp();
+    ast_node * left_node = unaryExp(p);
     if (!left_node) {
-        // 非法的一元表达式
         return nullptr;
     }
 
-    // 识别闭包(addOp unaryExp)*，循环
-    // 循环退出条件，1) 不是二元加减运算符， 2) 语法错误
+    // 循环退出条件，1) 不是优先级足够的二元运算符， 2) 语法错误
     for (;;) {
 
-        // 获取加减运算符
-        ast_operator_type op = addOp();
-        if (ast_operator_type::AST_OP_MAX == op) {
-
-            // 不是加减运算符则正常结束
+        RDTokenType opTag = p.lookaheadTag;
+        int precedence = binaryPrecedence(opTag);
+        if (precedence < minPrecedence || precedence == 0) {
             break;
         }
 
-        // 获取右侧表达式
-        ast_node * right_node = unaryExp();
-        if (!right_node) {
+        // 跳过运算符
+        advance(p);
 
-            // 二元加减运算没有合法的右侧表达式
+        // 右侧只能包含优先级更高的运算符，从而同一优先级的运算符左结合
+        ast_node * right_node = binaryExp(p, precedence + 1);
+        if (!right_node) {
+            semerror(p, "二元运算符后缺少操作数");
             break;
         }
 
         // 创建二元运算符节点
-        left_node = create_contain_node(op, left_node, right_node);
+        left_node = create_contain_node(binaryOperator(opTag), left_node, right_node);
     }
 
     return left_node;
 }
 
-/// @brief 表达式文法 expr : addExp, 表达式目前只支持加法与减法运算
+/// @brief 表达式文法 expr : lorExp
 /// @return AST的节点
-static ast_node * expr()
+static ast_node * expr(RDParser & p)
 {
-    return addExp();
+    return binaryExp(p, 1);
 }
 
-/// @brief returnStatement -> T_RETURN expr T_SEMICOLON
-/// @return AST的节点
-static ast_node * returnStatement()
+///
+/// @brief 判断节点是否具有左值属性，即简单变量或者数组元素
+/// @param node 节点
+/// @return true 是左值
+///
+static bool isLVal(ast_node * node)
 {
+    return node->node_type == ast_operator_type::AST_OP_LEAF_VAR_ID ||
+           node->node_type == ast_operator_type::AST_OP_ARRAY_ACCESS;
+}
 
-    if (match(T_RETURN)) {
-
-        // return语句的First集合元素为T_RETURN
-        // 若匹配，则说明是return语句
+///
+/// @brief 赋值语句或表达式语句识别，文法：assignExprStmt : expr (T_ASSIGN expr)? T_SEMICOLON
+/// 赋值语句lVal T_ASSIGN expr与表达式语句的FIRST集合都有T_ID，不是LL(1)的，
+/// 因此先识别表达式，若其后为赋值运算符，则要求表达式具有左值属性
+/// @return ast_node*
+///
+static ast_node * assignExprStmt(RDParser & p)
+{
+    // 识别表达式，目前还不知道是否是表达式语句或赋值语句
+    ast_node * node = expr(p);
+    if (!node) {
+        semerror(p, "不是合法的表达式");
+        return nullptr;
+    }
 
-        ast_node * expr_node = expr();
+    if (match(p, T_ASSIGN)) {
 
-        if (!match(T_SEMICOLON)) {
+        // 赋值运算符，说明含有赋值运算，左侧必须是左值
+        if (!isLVal(node)) {
+            semerror(p, "赋值语句的左侧不是左值");
+        }
 
-            // 返回语句后没有分号
-            semerror("返回语句后没有分号");
+        // 赋值运算符右侧表达式分析识别
+        ast_node * right_node = expr(p);
+        if (!right_node) {
+            semerror(p, "赋值语句的右侧不是合法的表达式");
+            return node;
         }
 
-        return create_contain_node(ast_operator_type::AST_OP_RETURN, expr_node);
+        node = ast_node::New(ast_operator_type::AST_OP_ASSIGN, node, right_node, nullptr);
     }
 
-    return nullptr;
+    if (!match(p, T_SEMICOLON)) {
+        semerror(p, "语句后缺少分号");
+    }
+
+    return node;
 }
 
-/// 识别表达式尾部符号，文法： assignExprStmtTail : T_ASSIGN expr | ε
-static ast_node * assignExprStmtTail(ast_node * left_node)
+///
+/// @brief 条件的识别，文法：T_L_PAREN expr T_R_PAREN，用于if与while语句
+/// @return ast_node* 条件表达式
+///
+static ast_node * condition(RDParser & p)
 {
-    if (match(T_ASSIGN)) {
-
-        // 赋值运算符，说明含有赋值运算
-
-        // 必须要求左侧节点必须存在
-        if (!left_node) {
-
-            // 没有左侧节点，则语法错误
-            semerror("赋值语句的左侧表达式不能为空");
-
-            return nullptr;
-        }
+    if (!match(p, T_L_PAREN)) {
+        semerror(p, "条件缺少左括号");
+    }
 
-        // 赋值运算符右侧表达式分析识别
-        ast_node * right_node = expr();
+    ast_node * cond = expr(p);
+    if (!cond) {
+        semerror(p, "条件不是合法的表达式");
+        cond = ast_node::New(digit_int_attr{1, -1});
+    }
 
-        return create_contain_node(ast_operator_type::AST_OP_ASSIGN, left_node, right_node);
-    } else if (F(T_SEMICOLON)) {
-        // 看是否满足assignExprStmtTail的Follow集合。在Follow集合中则正常结束，否则出错
-        // 空语句
+    if (!match(p, T_R_PAREN)) {
+        semerror(p, "条件缺少右括号");
     }
 
-    return left_node;
+    return cond;
 }
 
 ///
-/// @brief 赋值语句或表达式语句识别，文法：assignExprStmt : expr assignExprStmtTail
-/// @return ast_node*
+/// @brief 分支或循环体语句的识别，没有合法的语句时报错，并以空语句块代替
+/// @return ast_node* 语句节点
 ///
-static ast_node * assignExprStmt()
+static ast_node * bodyStatement(RDParser & p)
 {
-    // 识别表达式，目前还不知道是否是表达式语句或赋值语句
-    ast_node * expr_node = expr();
+    ast_node * node = statement(p);
+    if (!node) {
+        semerror(p, "缺少语句");
+        node = create_contain_node(ast_operator_type::AST_OP_BLOCK);
+    }
 
-    return assignExprStmtTail(expr_node);
+    return node;
 }
 
 ///
 /// @brief 语句的识别，其文法为：
-/// statement:T_RETURN expr T_SEMICOLON | lVal T_ASSIGN expr T_SEMICOLON | block | expr? T_SEMICOLON
-/// 需要注意的是赋值语句与表达式语句的FIRST集合有交集，都有T_ID
-/// 必须进行语法改造使得满足LL(1)文法的要求，改造后的文法：
-/// statement: returnStatement | block | T_SEMICOLON | assignExprStmt T_SEMICOLON
-/// returnStatement : T_RETURN expr T_SEMICOLON
-/// assignExprStmt : expr assignExprStmtTail
-/// assignExprStmtTail : T_ASSIGN expr | ε
-/// assignexprstat表示支持赋值的表达式
-/// assignExprStmtTail这里只支持一次赋值，C语言中可以支持连续赋值
-/// 如需要支持连续赋值，则assignExprStmtTail的文法可改造为assignExprStmtTail : T_ASSIGN expr assignExprStmtTail | ε
-/// 注意若有T_ASSIGN，则左侧的expr必须具有左值属性，否则语义错误
-///
-/// @return AST的节点
-///
-static ast_node * statement()
+/// statement: T_RETURN expr? T_SEMICOLON
+///     | lVal T_ASSIGN expr T_SEMICOLON
+///     | block
+///     | T_IF T_L_PAREN expr T_R_PAREN statement (T_ELSE statement)?
+///     | T_WHILE T_L_PAREN expr T_R_PAREN statement
+///     | T_BREAK T_SEMICOLON
+///     | T_CONTINUE T_SEMICOLON
+///     | expr? T_SEMICOLON
+/// 除赋值语句与表达式语句外，各分支的FIRST集合不交。这两者改造为assignExprStmt识别。
+/// else与最近的if匹配
+///
+/// @return AST的节点，不是语句时为空指针
+///
+static ast_node * statement(RDParser & p)
 {
-    ast_node * node = nullptr;
-    if (F(T_RETURN)) {
+    if (match(p, T_RETURN)) {
+
+        // 返回语句，return;或者return expr;
+        ast_node * expr_node = nullptr;
+        if (!F(T_SEMICOLON)) {
+            expr_node = expr(p);
+            if (!expr_node) {
+                semerror(p, "返回值不是合法的表达式");
+            }
+        }
 
-        // Return语句，识别产生式statement: returnStatement
-        node = returnStatement();
-    } else if (F(T_L_BRACE)) {
+        if (!match(p, T_SEMICOLON)) {
+            semerror(p, "返回语句后没有分号");
+        }
+
+        return create_contain_node(ast_operator_type::AST_OP_RETURN, expr_node);
+    }
+
+    if (F(T_L_BRACE)) {
 
         // 语句块，识别产生式statement: block
-        node = Block();
-    } else if (F(T_SEMICOLON)) {
+        return Block(p);
+    }
 
-        // 空语句，识别产生式statement: T_SEMICOLON
-        advance();
-    } else if (F(T_ID) _(T_L_PAREN) _(T_DIGIT)) {
+    if (match(p, T_IF)) {
 
-        // 赋值语句，statement -> assignExprStmt T_SEMICOLON
+        ast_node * cond = condition(p);
+        ast_node * then_node = bodyStatement(p);
 
-        // assignExprStmt的FIRST集合为{T_ID, T_L_PAREN, T_DIGIT}
+        if (match(p, T_ELSE)) {
+            ast_node * else_node = bodyStatement(p);
+            return ast_node::New(ast_operator_type::AST_OP_IF_ELSE, cond, then_node, else_node, nullptr);
+        }
 
-        // 赋值语句以T_ID开头，并且左值要具有左值属性
-        // 表达式语句可以以T_ID开头，也可以左小括号T_L_PAREN，甚至一元运算符等开头
-        // 目前文法下表达式语句在不支持一元运算符的情况下只能以T_ID或T_L_PAREN开头
-        node = assignExprStmt();
+        return ast_node::New(ast_operator_type::AST_OP_IF, cond, then_node, nullptr);
+    }
+
+    if (match(p, T_WHILE)) {
+
+        ast_node * cond = condition(p);
+        ast_node * body_node = bodyStatement(p);
+
+        return ast_node::New(ast_operator_type::AST_OP_WHILE, cond, body_node, nullptr);
+    }
+
+    if (match(p, T_BREAK)) {
 
-        if (!match(T_SEMICOLON)) {
-            semerror("语句后缺少分号");
+        if (!match(p, T_SEMICOLON)) {
+            semerror(p, "break语句后没有分号");
         }
+
+        return ast_node::New(ast_operator_type::AST_OP_BREAK, nullptr);
     }
 
-    return node;
+    if (match(p, T_CONTINUE)) {
+
+        if (!match(p, T_SEMICOLON)) {
+            semerror(p, "continue语句后没有分号");
+        }
+
+        return ast_node::New(ast_operator_type::AST_OP_CONTINUE, nullptr);
+    }
+
+    if (F(T_SEMICOLON)) {
+
+        // 空语句，行号为分号所在的行
+        ast_node * node = create_contain_node(ast_operator_type::AST_OP_EMPTY_STMT);
+        node->line_no = p.scanner.lineNo;
+
+        advance(p);
+
+        return node;
+    }
+
+    if (F(T_ID) _(T_L_PAREN) _(T_DIGIT) _(T_SUB) _(T_LOGIC_NOT)) {
+
+        // 赋值语句或表达式语句，FIRST集合为表达式的FIRST集合
+        return assignExprStmt(p);
+    }
+
+    return nullptr;
 }
 
 ///
-/// @brief 变量定义列表语法识别 其文法：varDeclList : T_COMMA T_ID varDeclList | T_SEMICOLON
-/// @param vardeclstmt_node 变量声明语句节点，所有的变量节点应该加到该节点中
+/// @brief 变量名之后部分的识别，文法：varDefTail: (T_L_BRACKET expr T_R_BRACKET)* (T_ASSIGN expr)?
+/// @param type 变量的类型
+/// @param id 已识别的变量名
+/// @return ast_node* 变量定义节点，孩子为类型、变量名或数组定义，以及可能的初始化表达式
 ///
-static void varDeclList(ast_node * vardeclstmt_node)
+static ast_node * varDefTail(RDParser & p, type_attr & type, var_id_attr & id)
 {
-    if (match(T_COMMA)) {
-
-        // 匹配成功，定义列表中有逗号
+    ast_node * id_node = idNode(id);
 
-        // 检查是否是标识符
-        if (F(T_ID)) {
+    // 数组的各个维度
+    std::vector<ast_node *> dimensions;
+    while (match(p, T_L_BRACKET)) {
 
-            // 定义列表中定义的变量
+        ast_node * dim = expr(p);
+        if (!dim) {
+            semerror(p, "数组维度不是合法的表达式");
+            break;
+        }
 
-            // 新建变量声明节点并加入变量声明语句中
-            (void) add_var_decl_node(vardeclstmt_node, rd_lval.var_id);
+        dimensions.push_back(dim);
 
-            // 填过当前的Token，指向下一个Token
-            advance();
+        if (!match(p, T_R_BRACKET)) {
+            semerror(p, "数组维度缺少右中括号");
+            break;
+        }
+    }
 
-            // 递归调用，不断追加变量定义
-            varDeclList(vardeclstmt_node);
-        } else {
-            semerror("逗号后必须是标识符");
+    // 初始化表达式
+    ast_node * init_node = nullptr;
+    if (match(p, T_ASSIGN)) {
+        init_node = expr(p);
+        if (!init_node) {
+            semerror(p, "变量的初始值不是合法的表达式");
         }
-    } else if (match(T_SEMICOLON)) {
-        // 匹配成功，则说明只有前面的一个变量或者变量定义，正常结束
-    } else {
-        semerror("非法记号: %d", (int) lookaheadTag);
+    }
 
-        // 忽略该记号，继续检查
-        advance();
+    ast_node * type_node = create_type_node(type);
 
-        // 继续检查后续的变量
-        varDeclList(vardeclstmt_node);
+    if (!dimensions.empty()) {
+        // 数组定义
+        ast_node * array_node = create_array_def(id_node, dimensions, init_node);
+        return create_contain_node(ast_operator_type::AST_OP_VAR_DECL, type_node, array_node);
     }
+
+    return create_contain_node(ast_operator_type::AST_OP_VAR_DECL, type_node, id_node, init_node);
 }
 
 ///
-/// @brief 局部变量的识别，其文法为：
-/// varDecl : T_INT T_ID varDeclList
-///
-/// @return ast_node* 局部变量声明节点
+/// @brief 变量定义的识别，其文法为：varDef: T_ID varDefTail
+/// @param type 变量的类型
+/// @return ast_node* 变量定义节点
 ///
-static ast_node * varDecl()
+static ast_node * varDef(RDParser & p, type_attr & type)
 {
-    if (F(T_INT)) {
-
-        // 这里必须复制，而不能引用，因为rd_lval为全局，下一个记号识别后要被覆盖
-        type_attr type = rd_lval.type;
+    if (!F(T_ID)) {
+        semerror(p, "类型后要求的记号为标识符");
+        return nullptr;
+    }
 
-        // 跳过int类型的记号，指向下一个Token
-        advance();
+    // 这里必须复制，而不能引用，因为Token的值在下一个记号识别后要被覆盖
+    var_id_attr id = p.scanner.lval.var_id;
 
-        // 检测是否是标识符
-        if (F(T_ID)) {
+    advance(p);
 
-            // 创建变量声明语句，并加入第一个变量
-            ast_node * stmt_node = create_var_decl_stmt_node(type, rd_lval.var_id);
+    return varDefTail(p, type, id);
+}
 
-            // 跳过标识符记号，指向下一个Token
-            advance();
+///
+/// @brief 变量定义列表语法识别，其文法：varDefList : varDef (T_COMMA varDef)* T_SEMICOLON
+/// @param type 变量的类型
+/// @param first_node 已识别的第一个变量定义，为空时从第一个varDef开始识别
+/// @return ast_node* 变量声明语句节点
+///
+static ast_node * varDefList(RDParser & p, type_attr & type, ast_node * first_node = nullptr)
+{
+    ast_node * stmt_node = create_contain_node(ast_operator_type::AST_OP_DECL_STMT, first_node);
 
-            varDeclList(stmt_node);
+    if (!first_node || match(p, T_COMMA)) {
+        do {
+            ast_node * def_node = varDef(p, type);
+            if (!def_node) {
+                break;
+            }
 
-            return stmt_node;
+            (void) stmt_node->insert_son_node(def_node);
+        } while (match(p, T_COMMA));
+    }
 
-        } else {
-            semerror("类型后要求的记号为标识符");
-            // 这里忽略继续检查下一个记号，为便于一次可检查出多个错误
-            // 当然可以直接退出循环，一旦有错就不再检查语法错误。
-        }
+    if (!match(p, T_SEMICOLON)) {
+        semerror(p, "变量定义后缺少分号");
     }
 
-    return nullptr;
+    return stmt_node;
+}
+
+///
+/// @brief 局部变量的识别，其文法为：
+/// varDecl : T_INT varDefList
+///
+/// @return ast_node* 局部变量声明节点
+///
+static ast_node * varDecl(RDParser & p)
+{
+    // 这里必须复制，而不能引用，因为Token的值在下一个记号识别后要被覆盖
+    type_attr type = p.scanner.lval.type;
+
+    // 跳过int类型的记号，指向下一个Token
+    advance(p);
+
+    return varDefList(p, type);
 }
 
 ///
 /// @brief 块中的项目识别，其文法为：
 /// blockItem: statement | varDecl
-/// varDecl : T_INT T_ID varDeclList
-/// statement:T_RETURN expr T_SEMICOLON | lVal T_ASSIGN expr T_SEMICOLON | block | expr? T_SEMICOLON
-/// varDecl的FIRST集合为{T_INT}，
-/// statement的FIRST集合为{T_RETURN，T_ID，T_L_PAREN，T_SEMICOLON}
-/// FIRST集合不交，可正常识别
-/// 最终的文法为：
-/// blockItem: statement | varDecl
-/// varDecl : T_INT T_ID varDeclList
-/// statement:T_RETURN expr T_SEMICOLON | lVal T_ASSIGN expr T_SEMICOLON | block | expr? T_SEMICOLON
+/// varDecl的FIRST集合为{T_INT}，与statement的FIRST集合不交，可正常识别
 /// @return 返回AST的节点
 ///
-static ast_node * BlockItem()
+static ast_node * BlockItem(RDParser & p)
 {
     if (F(T_INT)) {
-        return varDecl();
+        return varDecl(p);
     } else {
-        return statement();
+        return statement(p);
     }
 }
 
@@ -522,22 +740,23 @@ static ast_node * BlockItem()
 /// @brief 块内语句列表识别，文法为BlockItemList : BlockItem+
 /// @return AST的节点
 ///
-static void BlockItemList(ast_node * blockNode)
+static void BlockItemList(RDParser & p, ast_node * blockNode)
 {
     for (;;) {
 
-        // 如果是右大括号，则结束循环，提升效率
-        if (F(T_R_BRACE)) {
+        // 如果是右大括号或者文件结束，则结束循环
+        if (F(T_R_BRACE) _(T_EOF)) {
             break;
         }
 
         // 遍历BlockItem
-        ast_node * itemNode = BlockItem();
+        ast_node * itemNode = BlockItem(p);
         if (itemNode) {
             blockNode->insert_son_node(itemNode);
         } else {
-            // 没有，则结束
-            break;
+            // 不是语句的记号，报错后忽略该记号，为便于一次可检查出多个错误
+            semerror(p, "非法记号: %.*s", (int) p.scanner.tokenLength, p.scanner.tokenText);
+            advance(p);
         }
     }
 }
@@ -546,24 +765,24 @@ static void BlockItemList(ast_node * blockNode)
 /// @brief 语句块识别，文法：Block -> T_L_BRACE BlockItemList? T_R_BRACE
 /// @return AST的节点
 ///
-static ast_node * Block()
+static ast_node * Block(RDParser & p)
 {
-    if (match(T_L_BRACE)) {
+    if (match(p, T_L_BRACE)) {
 
         // 创建语句块节点
         ast_node * blockNode = create_contain_node(ast_operator_type::AST_OP_BLOCK);
 
         // 空的语句块
-        if (match(T_R_BRACE)) {
+        if (match(p, T_R_BRACE)) {
             return blockNode;
         }
 
         // 块内语句列表识别
-        BlockItemList(blockNode);
+        BlockItemList(p, blockNode);
 
         // 没有匹配左大括号，则语法错误
-        if (!match(T_R_BRACE)) {
-            semerror("缺少右大括号");
+        if (!match(p, T_R_BRACE)) {
+            semerror(p, "缺少右大括号");
         }
 
         // 正常
@@ -575,125 +794,226 @@ static ast_node * Block()
 }
 
 ///
-/// @brief 文法分析：idtail : varDeclList | T_L_PAREN T_R_PAREN block
-/// @param type 类型 变量类型或函数返回值类型
-/// @param id 标识符 变量名或者函数名
+/// @brief 形参的识别，文法：param: T_INT T_ID (T_L_BRACKET T_R_BRACKET)? (T_L_BRACKET T_DIGIT T_R_BRACKET)*
+/// 数组形参的第一维总是0，表示指针，其后为指定的各维
+/// @return ast_node* 形参节点
 ///
-static ast_node * idtail(type_attr & type, var_id_attr & id)
+static ast_node * param(RDParser & p)
 {
-    if (match(T_L_PAREN)) {
-        // 函数定义
+    if (!F(T_INT)) {
+        semerror(p, "形参的类型必须为int");
+        return nullptr;
+    }
 
-        // 目前函数定义没有形参，因此必须是右小括号
-        if (match(T_R_PAREN)) {
+    type_attr type = p.scanner.lval.type;
+    advance(p);
 
-            // 识别block
-            ast_node * blockNode = Block();
+    if (!F(T_ID)) {
+        semerror(p, "形参的类型后要求的记号为标识符");
+        return nullptr;
+    }
 
-            // 形参结点没有，设置为空指针
-            ast_node * formalParamsNode = nullptr;
+    var_id_attr id = p.scanner.lval.var_id;
+    int64_t lineno = id.lineno;
+    advance(p);
 
-            // 创建函数定义的节点，孩子有类型，函数名，语句块和形参(实际上无)
-            // create_func_def函数内会释放id中指向的标识符空间，切记，之后不要再释放，之前一定要是通过strdup函数或者malloc分配的空间
-            return create_func_def(type, id, blockNode, formalParamsNode);
-        } else {
-            semerror("函数定义缺少右小括号");
+    ast_node * type_node = create_type_node(type);
+    ast_node * name_node = idNode(id);
+
+    // 方括号的个数与指定的维度
+    int arrayDimCount = 0;
+    std::vector<uint32_t> digits;
+    while (match(p, T_L_BRACKET)) {
+
+        arrayDimCount++;
+
+        if (F(T_DIGIT)) {
+            digits.push_back(p.scanner.lval.integer_num.val);
+            advance(p);
+        } else if (arrayDimCount > 1 || !F(T_R_BRACKET)) {
+            // 只有第一维可以省略
+            semerror(p, "数组形参只有第一维可以省略");
         }
 
-        return nullptr;
+        if (!match(p, T_R_BRACKET)) {
+            semerror(p, "数组形参缺少右中括号");
+            break;
+        }
     }
 
-    // 这里只能是变量定义
+    if (arrayDimCount == 0) {
+        // 普通参数
+        ast_node * param_node = new ast_node(ast_operator_type::AST_OP_FUNC_FORMAL_PARAM);
+        param_node->insert_son_node(type_node);
+        param_node->insert_son_node(name_node);
+        return param_node;
+    }
 
-    // 根据第一个变量声明创建变量声明语句节点并加入其中
-    ast_node * stmt_node = create_var_decl_stmt_node(type, id);
+    // 数组参数
+    ast_node * param_node = new ast_node(ast_operator_type::AST_OP_FUNC_FORMAL_PARAM_ARRAY);
+    param_node->insert_son_node(type_node);
+    param_node->insert_son_node(name_node);
 
-    varDeclList(stmt_node);
+    // 第一维总是0(表示指针)
+    param_node->insert_son_node(ast_node::New(digit_int_attr{0, lineno}));
 
-    return stmt_node;
+    if (digits.empty()) {
+        for (int i = 1; i < arrayDimCount; i++) {
+            param_node->insert_son_node(ast_node::New(digit_int_attr{0, lineno}));
+        }
+    } else {
+        for (uint32_t dimValue: digits) {
+            param_node->insert_son_node(ast_node::New(digit_int_attr{dimValue, lineno}));
+        }
+    }
+
+    return param_node;
+}
+
+///
+/// @brief 形参列表的识别，文法：paramList: param (T_COMMA param)*
+/// @return ast_node* 形参列表节点
+///
+static ast_node * paramList(RDParser & p)
+{
+    ast_node * params_node = new ast_node(ast_operator_type::AST_OP_FUNC_FORMAL_PARAMS);
+
+    if (F(T_R_PAREN)) {
+        // 没有形参
+        return params_node;
+    }
+
+    do {
+        ast_node * param_node = param(p);
+        if (!param_node) {
+            break;
+        }
+
+        (void) params_node->insert_son_node(param_node);
+    } while (match(p, T_COMMA));
+
+    return params_node;
+}
+
+///
+/// @brief 文法分析：idtail : T_L_PAREN paramList? T_R_PAREN block | varDefList
+/// @param type 类型 变量类型或函数返回值类型
+/// @param id 标识符 变量名或者函数名
+///
+static ast_node * idtail(RDParser & p, type_attr & type, var_id_attr & id)
+{
+    if (match(p, T_L_PAREN)) {
+        // 函数定义
+
+        ast_node * formalParamsNode = paramList(p);
+
+        if (!match(p, T_R_PAREN)) {
+            semerror(p, "函数定义缺少右小括号");
+        }
+
+        // 识别block
+        ast_node * blockNode = Block(p);
+        if (!blockNode) {
+            semerror(p, "函数定义缺少函数体");
+        }
+
+        // 创建函数定义的节点，孩子有类型，函数名，形参和语句块
+        // create_func_def函数内会释放id中指向的标识符空间，切记，之后不要再释放，之前一定要是通过strdup函数或者malloc分配的空间
+        return create_func_def(type, id, blockNode, formalParamsNode);
+    }
+
+    // 这里只能是变量定义，第一个变量名已经识别
+    if (type.type != BasicType::TYPE_INT) {
+        semerror(p, "变量的类型必须为int");
+    }
+
+    return varDefList(p, type, varDefTail(p, type, id));
 }
 
 // 编译单元识别，也就是文法的开始符号
 // 其文法（antlr4中定义的）：
 // compileUnit: (funcDef | varDecl)* EOF
-// funcDef: T_INT T_ID T_L_PAREN T_R_PAREN block
+// funcDef: (T_INT | T_VOID) T_ID T_L_PAREN paramList? T_R_PAREN block
 // varDecl: basicType varDef (T_COMMA varDef)* T_SEMICOLON
-// 因funcDef的First集合为T_INT，varDecl的First集合也为T_INT，不可区分，不是LL(1)文法，
-// 再看第二个记号，第二个都是标识符，也不可区分
-// 再检查第三个记号，funcDef为左小括号，变量声明可以为逗号，可以为等号，可以为分号，可以区分
-// 因此可改造为 compileUnit : { T_INT T_ID idtail }，其中大括号代表闭包，类似上面的*
-// idtail : varDeclList | T_L_PAREN T_R_PAREN block
-// varDeclList可以定义多个变量，每次都增加一个逗号和标识符，直到最后一个记号为分号，即
-// varDeclList : T_COMMA T_ID <varDeclList> | T_SEMICOLON
-// 因此需要对文法进行改造，以便能够适合LL(1)文法的识别
-// 因此改造后的文法为：
-// 文法：compileUnit -> { T_INT T_ID idtail } EOF
-// idtail : varDeclList | T_L_PAREN T_R_PAREN block
-// varDeclList : T_COMMA T_ID varDeclList | T_SEMICOLON
+// 因funcDef与varDecl的前两个记号都是类型与标识符，不可区分，不是LL(1)文法，
+// 再检查第三个记号，funcDef为左小括号，变量声明可以为左中括号、逗号、等号或分号，可以区分
+// 因此可改造为 compileUnit : { (T_INT | T_VOID) T_ID idtail }，其中大括号代表闭包，类似上面的*
+// idtail : T_L_PAREN paramList? T_R_PAREN block | varDefTail (T_COMMA varDef)* T_SEMICOLON
 // 闭包代表一个循环，可以0以上的循环，最后一个为EOF
-static ast_node * compileUnit()
+// 与antlr4产生的AST一致，全局变量声明语句排在前面，函数定义排在后面
+static ast_node * compileUnit(RDParser & p)
 {
     // 创建AST的根节点，编译单元运算符
     ast_node * cu_node = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT);
 
+    // 函数定义，在全局变量之后加入
+    std::vector<ast_node *> funcNodes;
+
     for (;;) {
 
-        // match匹配并LookAhead往前挪动
-        if (F(T_INT)) {
+        if (F(T_INT) _(T_VOID)) {
 
-            type_attr type = rd_lval.type;
+            type_attr type = p.scanner.lval.type;
 
             // 跳过当前的记号，指向下一个记号
-            advance();
+            advance(p);
 
             // 检测是否是标识符
             if (F(T_ID)) {
 
                 // 获取标识符的值和定位信息
-                var_id_attr id = rd_lval.var_id;
+                var_id_attr id = p.scanner.lval.var_id;
 
                 // 跳过当前的记号，指向下一个记号
-                advance();
-
-                // 函数定义的开头为int
-                ast_node * node = idtail(type, id);
-
-                // 加入到父节点中，node为空时insert_son_node内部进行了忽略
-                (void) cu_node->insert_son_node(node);
+                advance(p);
+
+                ast_node * node = idtail(p, type, id);
+                if (node && node->node_type == ast_operator_type::AST_OP_FUNC_DEF) {
+                    funcNodes.push_back(node);
+                } else {
+                    // 加入到父节点中，node为空时insert_son_node内部进行了忽略
+                    (void) cu_node->insert_son_node(node);
+                }
             } else {
-                semerror("类型后要求的记号为标识符");
+                semerror(p, "类型后要求的记号为标识符");
                 // 这里忽略继续检查下一个记号，为便于一次可检查出多个错误
-                // 当然可以直接退出循环，一旦有错就不再检查语法错误。
             }
 
         } else if (F(T_EOF)) {
             // 文件解析完毕
             break;
         } else {
-            // 这里发现错误
-            break;
+            // 不是函数定义或变量声明的开始，报错后忽略该记号，为便于一次可检查出多个错误
+            semerror(p, "非法记号: %.*s", (int) p.scanner.tokenLength, p.scanner.tokenText);
+            advance(p);
         }
     }
 
+    for (ast_node * funcNode: funcNodes) {
+        (void) cu_node->insert_son_node(funcNode);
+    }
+
     return cu_node;
 }
 
 ///
 /// @brief 采用递归下降分析法实现词法与语法分析生成抽象语法树
+/// @param scanner 词法分析器，需事先设置好输入文件
 /// @return ast_node* 空指针失败，否则成功
 ///
-ast_node * rd_parse()
+ast_node * rd_parse(RDScanner & scanner)
 {
-    // 没有错误信息
-    errno_num = 0;
+    // 语法分析的状态，没有错误信息
+    RDParser p{scanner};
 
     // lookahead指向第一个Token
-    advance();
+    advance(p);
 
-    ast_node * astRoot = compileUnit();
+    ast_node * astRoot = compileUnit(p);
 
-    // 如果有错误信息，则返回-1，否则返回0
-    if (errno_num != 0) {
+    // 如果有错误信息，则释放已产生的AST，返回空指针
+    if (p.errno_num != 0) {
+        free_ast(astRoot);
         return nullptr;
     }
 
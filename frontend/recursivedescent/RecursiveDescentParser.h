@@ -40,6 +40,28 @@ enum RDTokenType {
 	T_ASSIGN,
 	T_ADD,
     T_SUB,
+
+    T_VOID,
+    T_IF,
+    T_ELSE,
+    T_WHILE,
+    T_BREAK,
+    T_CONTINUE,
+
+    T_L_BRACKET,
+    T_R_BRACKET,
+    T_MUL,
+    T_DIV,
+    T_MOD,
+    T_LT,
+    T_GT,
+    T_LE,
+    T_GE,
+    T_EQ,
+    T_NE,
+    T_LOGIC_AND,
+    T_LOGIC_OR,
+    T_LOGIC_NOT,
 };
 
 /// @brief 词法与语法分析数据交互的Token的值类型
@@ -51,11 +73,11 @@ union RDSType {
     type_attr type;             // 类型
 };
 
-/// @brief 词法与语法分析数据交互的Token的值
-extern RDSType rd_lval;
+struct RDScanner;
 
 ///
 /// @brief 采用递归下降分析法实现词法与语法分析生成抽象语法树
+/// @param scanner 词法分析器，需事先设置好输入文件
 /// @return ast_node* 空指针失败，否则成功
 ///
-ast_node * rd_parse();
+ast_node * rd_parse(RDScanner & scanner);
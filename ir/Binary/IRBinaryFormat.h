@@ -0,0 +1,281 @@
+///
+/// @file IRBinaryFormat.h
+/// @brief 线性IR二进制模块文件的格式定义
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+/// 文件由文件头与若干节组成，每节都是定长记录的数组，8字节对齐，
+/// 记录之间通过下标互相引用，可以mmap映射后直接按结构体访问。
+/// 字符串表是以'\0'结尾的字符串拼接而成，字符串以其在表中的字节偏移引用，偏移0为空串。
+/// 文件按本机字节序存放，通过byteOrder字段识别。
+///
+#pragma once
+
+#include <cstdint>
+
+/// @brief 文件魔数DIRB
+#define IR_BINARY_MAGIC 0x42524944u
+
+/// @brief 格式版本，记录布局或者IRInstOperator的取值变化时需要增加
+#define IR_BINARY_VERSION 1u
+
+/// @brief 字节序标记
+#define IR_BINARY_BYTE_ORDER 0x01020304u
+
+///
+/// @brief 节的描述，offset为相对文件头的字节偏移，count为记录个数，字符串表为字节数
+///
+struct IRBinSection {
+    uint32_t offset;
+    uint32_t count;
+};
+
+///
+/// @brief 文件头
+///
+struct IRBinHeader {
+
+    /// @brief 魔数
+    uint32_t magic;
+
+    /// @brief 格式版本
+    uint32_t version;
+
+    /// @brief 字节序标记
+    uint32_t byteOrder;
+
+    /// @brief 文件的总字节数
+    uint32_t fileSize;
+
+    /// @brief 字符串表
+    IRBinSection strings;
+
+    /// @brief 类型表，IRBinType
+    IRBinSection types;
+
+    /// @brief 数组维度表，uint32_t
+    IRBinSection dims;
+
+    /// @brief 全局变量表，IRBinGlobal
+    IRBinSection globals;
+
+    /// @brief 函数表，IRBinFunction
+    IRBinSection functions;
+
+    /// @brief 形参表，IRBinParam，每个函数占连续的一段
+    IRBinSection params;
+
+    /// @brief 局部变量表，IRBinLocal，每个函数占连续的一段
+    IRBinSection locals;
+
+    /// @brief 指令表，IRBinInst，每个函数占连续的一段
+    IRBinSection insts;
+
+    /// @brief 操作数表，IRBinValueRef，每条指令占连续的一段
+    IRBinSection operands;
+};
+
+///
+/// @brief 类型的种类
+///
+enum IRBinTypeKind : uint32_t {
+    IR_BIN_TYPE_VOID,
+    IR_BIN_TYPE_INT,
+    IR_BIN_TYPE_POINTER,
+    IR_BIN_TYPE_ARRAY,
+};
+
+///
+/// @brief 类型记录
+///
+struct IRBinType {
+
+    /// @brief 种类，IRBinTypeKind
+    uint32_t kind;
+
+    /// @brief 整数为位宽，指针为所指类型的下标，数组为元素类型的下标，均小于本类型的下标
+    uint32_t elem;
+
+    /// @brief 数组维度在维度表中的起始下标
+    uint32_t dimBegin;
+
+    /// @brief 数组维度个数
+    uint32_t dimCount;
+};
+
+///
+/// @brief 全局变量记录
+///
+struct IRBinGlobal {
+
+    /// @brief 变量名
+    uint32_t name;
+
+    /// @brief 类型下标
+    uint32_t type;
+};
+
+/// @brief 函数记录标志：内置函数
+#define IR_BIN_FUNC_BUILTIN 0x1u
+
+/// @brief 函数记录标志：函数内存在函数调用
+#define IR_BIN_FUNC_EXIST_CALL 0x2u
+
+///
+/// @brief 函数记录
+///
+struct IRBinFunction {
+
+    /// @brief 函数名
+    uint32_t name;
+
+    /// @brief 返回值类型下标
+    uint32_t returnType;
+
+    /// @brief 标志，IR_BIN_FUNC_XXX
+    uint32_t flags;
+
+    /// @brief 函数调用实参个数的最大值
+    int32_t maxArgCnt;
+
+    /// @brief 形参的起始下标
+    uint32_t paramBegin;
+
+    /// @brief 形参个数
+    uint32_t paramCount;
+
+    /// @brief 局部变量的起始下标
+    uint32_t localBegin;
+
+    /// @brief 局部变量个数
+    uint32_t localCount;
+
+    /// @brief 指令的起始下标
+    uint32_t instBegin;
+
+    /// @brief 指令条数
+    uint32_t instCount;
+
+    /// @brief 出口Label指令在函数内的下标，-1表示没有
+    int32_t exitLabel;
+
+    /// @brief 返回值变量在函数内的局部变量下标，-1表示没有
+    int32_t returnValue;
+};
+
+///
+/// @brief 形参记录
+///
+struct IRBinParam {
+
+    /// @brief 形参名
+    uint32_t name;
+
+    /// @brief 类型下标
+    uint32_t type;
+};
+
+///
+/// @brief 局部变量记录
+///
+struct IRBinLocal {
+
+    /// @brief 源程序中的变量名，临时产生的变量为空串
+    uint32_t name;
+
+    /// @brief 类型下标
+    uint32_t type;
+
+    /// @brief 作用域层级
+    int32_t scopeLevel;
+
+    /// @brief 保留，对齐用
+    uint32_t reserved;
+};
+
+/// @brief 指令记录标志：条件跳转
+#define IR_BIN_INST_CONDITIONAL 0x1u
+
+/// @brief 指令记录标志：通过指针写
+#define IR_BIN_INST_POINTER_STORE 0x2u
+
+/// @brief 指令记录标志：通过指针读
+#define IR_BIN_INST_POINTER_LOAD 0x4u
+
+/// @brief 指令记录标志：数组转指针
+#define IR_BIN_INST_ARRAY_TO_POINTER 0x8u
+
+///
+/// @brief 指令记录
+///
+struct IRBinInst {
+
+    /// @brief 操作符，IRInstOperator的取值
+    uint16_t op;
+
+    /// @brief 标志，IR_BIN_INST_XXX
+    uint16_t flags;
+
+    /// @brief 结果类型下标
+    uint32_t type;
+
+    /// @brief 操作数的起始下标
+    uint32_t operandBegin;
+
+    /// @brief 操作数个数
+    uint32_t operandCount;
+
+    /// @brief 跳转指令为目标Label指令在函数内的下标，函数调用为被调用函数的下标
+    int32_t target;
+
+    /// @brief 条件跳转的假分支Label指令在函数内的下标
+    int32_t falseTarget;
+};
+
+///
+/// @brief 操作数引用的种类
+///
+enum IRBinValueKind : uint32_t {
+
+    /// @brief 整数常量，index为常量值
+    IR_BIN_VALUE_CONST,
+
+    /// @brief 全局变量下标
+    IR_BIN_VALUE_GLOBAL,
+
+    /// @brief 所在函数的形参下标
+    IR_BIN_VALUE_PARAM,
+
+    /// @brief 所在函数的局部变量下标
+    IR_BIN_VALUE_LOCAL,
+
+    /// @brief 所在函数的指令下标，只能引用前面的指令
+    IR_BIN_VALUE_INST,
+};
+
+///
+/// @brief 操作数引用记录
+///
+struct IRBinValueRef {
+
+    /// @brief 种类，IRBinValueKind
+    uint32_t kind;
+
+    /// @brief 下标或者常量值
+    int32_t index;
+};
+
+static_assert(sizeof(IRBinHeader) == 88, "IRBinHeader的布局不能改变");
+static_assert(sizeof(IRBinType) == 16, "IRBinType的布局不能改变");
+static_assert(sizeof(IRBinFunction) == 48, "IRBinFunction的布局不能改变");
+static_assert(sizeof(IRBinLocal) == 16, "IRBinLocal的布局不能改变");
+static_assert(sizeof(IRBinInst) == 24, "IRBinInst的布局不能改变");
+static_assert(sizeof(IRBinValueRef) == 8, "IRBinValueRef的布局不能改变");
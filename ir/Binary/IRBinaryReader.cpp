@@ -0,0 +1,608 @@
+///
+/// @file IRBinaryReader.cpp
+/// @brief 读入二进制模块文件，重建Module的线性IR
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+
+#include <cstring>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Function.h"
+#include "IntegerType.h"
+#include "VoidType.h"
+#include "PointerType.h"
+#include "FormalParam.h"
+#include "LocalVariable.h"
+#include "ConstInt.h"
+#include "ArgInstruction.h"
+#include "BinaryInstruction.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+#include "MoveInstruction.h"
+#include "IRBinaryReader.h"
+
+///
+/// @brief 检查[begin, begin + count)是否在[0, total)内
+/// @param begin 起始下标
+/// @param count 个数
+/// @param total 总数
+/// @return true 在范围内
+///
+static bool inRange(uint32_t begin, uint32_t count, uint32_t total)
+{
+    return (uint64_t) begin + count <= total;
+}
+
+///
+/// @brief 检查值能否作为指令的数据操作数：整数、指针或者按地址使用的数组
+/// @param val 值
+/// @return true 可以
+///
+static bool isDataValue(Value * val)
+{
+    Type * type = val->getType();
+    return type->isIntegerType() || type->isPointerType() || type->isArrayType();
+}
+
+///
+/// @brief 检查值是否为整数类型
+/// @param val 值
+/// @return true 是
+///
+static bool isIntegerValue(Value * val)
+{
+    return val->getType()->isIntegerType();
+}
+
+///
+/// @brief 构造函数
+/// @param _module 要填充的模块，内部只含有内置函数
+///
+IRBinaryReader::IRBinaryReader(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 映射文件并重建模块
+/// @param filename 文件名
+/// @return true 成功
+/// @return false 失败，错误信息通过getLastError获取
+///
+bool IRBinaryReader::read(const std::string & filename)
+{
+#ifdef _WIN32
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    if (!in) {
+        lastError = "文件(" + filename + ")打开失败";
+        return false;
+    }
+
+    auto fileSize = (size_t) in.tellg();
+    in.seekg(0);
+
+    // 用uint64_t的数组保证8字节对齐
+    std::vector<uint64_t> content((fileSize + 7) / 8);
+    in.read(reinterpret_cast<char *>(content.data()), (std::streamsize) fileSize);
+
+    return load(reinterpret_cast<const char *>(content.data()), fileSize);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        lastError = "文件(" + filename + ")打开失败";
+        return false;
+    }
+
+    struct stat st {};
+    if ((fstat(fd, &st) != 0) || (st.st_size < (off_t) sizeof(IRBinHeader))) {
+        close(fd);
+        lastError = "文件(" + filename + ")不是有效的IR二进制模块";
+        return false;
+    }
+
+    auto fileSize = (size_t) st.st_size;
+    void * addr = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (addr == MAP_FAILED) {
+        lastError = "文件(" + filename + ")映射失败";
+        return false;
+    }
+
+    // 名字等都拷贝到了IR对象中，重建后即可解除映射
+    bool result = load(static_cast<const char *>(addr), fileSize);
+
+    munmap(addr, fileSize);
+
+    return result;
+#endif
+}
+
+///
+/// @brief 取得节的记录数组，检查越界与对齐
+/// @param section 节描述
+/// @param name 节名，用于错误信息
+/// @param records 记录数组
+/// @return true 成功
+///
+template <typename T>
+bool IRBinaryReader::getSection(const IRBinSection & section, const char * name, const T *& records)
+{
+    if (((uint64_t) section.offset + (uint64_t) section.count * sizeof(T) > size) || (section.offset % alignof(T))) {
+        lastError = std::string(name) + "节越界";
+        return false;
+    }
+
+    records = reinterpret_cast<const T *>(base + section.offset);
+
+    return true;
+}
+
+///
+/// @brief 取得字符串表中的字符串
+/// @param offset 偏移
+/// @param str 字符串
+/// @return true 成功
+///
+bool IRBinaryReader::getString(uint32_t offset, const char *& str)
+{
+    if (offset >= header->strings.count) {
+        lastError = "字符串偏移越界";
+        return false;
+    }
+
+    str = strings + offset;
+
+    return true;
+}
+
+///
+/// @brief 取得类型
+/// @param index 类型下标
+/// @param type 类型
+/// @return true 成功
+///
+bool IRBinaryReader::getType(uint32_t index, Type *& type)
+{
+    if (index >= types.size()) {
+        lastError = "类型下标越界";
+        return false;
+    }
+
+    type = types[index];
+
+    return true;
+}
+
+///
+/// @brief 创建类型表中的所有类型
+/// @return true 成功
+///
+bool IRBinaryReader::loadTypes()
+{
+    for (uint32_t k = 0; k < header->types.count; ++k) {
+
+        const IRBinType & record = typeRecords[k];
+        Type * type = nullptr;
+
+        switch (record.kind) {
+            case IR_BIN_TYPE_VOID:
+                type = VoidType::getType();
+                break;
+            case IR_BIN_TYPE_INT:
+                if (record.elem == 1) {
+                    type = IntegerType::getTypeBool();
+                } else if (record.elem == 32) {
+                    type = IntegerType::getTypeInt();
+                }
+                break;
+            case IR_BIN_TYPE_POINTER:
+                // 所依赖的类型下标总是小于本类型的下标
+                if (record.elem < k) {
+                    type = const_cast<Type *>(static_cast<const Type *>(PointerType::get(types[record.elem])));
+                }
+                break;
+            case IR_BIN_TYPE_ARRAY:
+                if ((record.elem < k) && inRange(record.dimBegin, record.dimCount, header->dims.count)) {
+                    std::vector<int> dims(dimRecords + record.dimBegin, dimRecords + record.dimBegin + record.dimCount);
+                    type = ArrayType::get(types[record.elem], dims);
+                }
+                break;
+            default:
+                break;
+        }
+
+        if (!type) {
+            lastError = "第" + std::to_string(k) + "个类型不合法";
+            return false;
+        }
+
+        types.push_back(type);
+    }
+
+    return true;
+}
+
+///
+/// @brief 从内存重建模块，内存需8字节对齐
+/// @param data 文件内容
+/// @param _size 字节数
+/// @return true 成功
+/// @return false 失败，错误信息通过getLastError获取
+///
+bool IRBinaryReader::load(const char * data, size_t _size)
+{
+    base = data;
+    size = _size;
+    header = reinterpret_cast<const IRBinHeader *>(data);
+
+    if ((size < sizeof(IRBinHeader)) || (header->magic != IR_BINARY_MAGIC)) {
+        lastError = "不是有效的IR二进制模块";
+        return false;
+    }
+
+    if ((header->version != IR_BINARY_VERSION) || (header->byteOrder != IR_BINARY_BYTE_ORDER)) {
+        lastError = "IR二进制模块的版本或者字节序不匹配";
+        return false;
+    }
+
+    if (header->fileSize != size) {
+        lastError = "IR二进制模块的大小不正确";
+        return false;
+    }
+
+    if (!getSection(header->strings, "字符串表", strings) || !getSection(header->types, "类型表", typeRecords) ||
+        !getSection(header->dims, "维度表", dimRecords) || !getSection(header->globals, "全局变量表", globalRecords) ||
+        !getSection(header->functions, "函数表", functionRecords) ||
+        !getSection(header->params, "形参表", paramRecords) || !getSection(header->locals, "局部变量表", localRecords) ||
+        !getSection(header->insts, "指令表", instRecords) ||
+        !getSection(header->operands, "操作数表", operandRecords)) {
+        return false;
+    }
+
+    // 字符串表必须以'\0'结束，保证任何偏移处的字符串都不会越界
+    if ((header->strings.count == 0) || (strings[header->strings.count - 1] != '\0')) {
+        lastError = "字符串表不合法";
+        return false;
+    }
+
+    if (!loadTypes()) {
+        return false;
+    }
+
+    for (uint32_t k = 0; k < header->globals.count; ++k) {
+
+        const char * name;
+        Type * type;
+        if (!getString(globalRecords[k].name, name) || !getType(globalRecords[k].type, type)) {
+            return false;
+        }
+
+        // 当前函数为空时创建的是全局变量
+        Value * var = module->newVarValue(type, name);
+        if (!var) {
+            lastError = std::string("全局变量") + name + "重复定义";
+            return false;
+        }
+
+        globals.push_back(var);
+    }
+
+    // 先创建所有函数，函数调用可以引用后面的函数
+    for (uint32_t k = 0; k < header->functions.count; ++k) {
+
+        const IRBinFunction & record = functionRecords[k];
+
+        const char * name;
+        Type * returnType;
+        if (!getString(record.name, name) || !getType(record.returnType, returnType)) {
+            return false;
+        }
+
+        if (!inRange(record.paramBegin, record.paramCount, header->params.count)) {
+            lastError = "形参下标越界";
+            return false;
+        }
+
+        Function * func = module->findFunction(name);
+        bool builtin = (record.flags & IR_BIN_FUNC_BUILTIN) != 0;
+
+        // 内置函数由Module创建，直接使用
+        if (!func || !builtin) {
+
+            if (func) {
+                lastError = std::string("函数") + name + "重复定义";
+                return false;
+            }
+
+            std::vector<FormalParam *> params;
+            for (uint32_t i = 0; i < record.paramCount; ++i) {
+
+                const IRBinParam & paramRecord = paramRecords[record.paramBegin + i];
+
+                const char * paramName;
+                Type * paramType;
+                if (!getString(paramRecord.name, paramName) || !getType(paramRecord.type, paramType)) {
+                    for (auto param: params) {
+                        delete param;
+                    }
+                    return false;
+                }
+
+                params.push_back(new FormalParam{paramType, paramName});
+            }
+
+            func = module->newFunction(name, returnType, params, builtin);
+        }
+
+        func->setExistFuncCall((record.flags & IR_BIN_FUNC_EXIST_CALL) != 0);
+        func->setMaxFuncCallArgCnt(record.maxArgCnt);
+
+        functions.push_back(func);
+    }
+
+    for (uint32_t k = 0; k < header->functions.count; ++k) {
+        if (!functions[k]->isBuiltin() && !loadFunctionBody(functions[k], functionRecords[k])) {
+            lastError = "函数" + functions[k]->getName() + ": " + lastError;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 把操作数引用解码为Value
+/// @param ref 引用
+/// @param func 所在函数
+/// @param localVars 所在函数的局部变量
+/// @param code 所在函数已经创建的指令
+/// @return Value* 失败返回空指针
+///
+Value * IRBinaryReader::decodeValue(const IRBinValueRef & ref,
+                                    Function * func,
+                                    const std::vector<LocalVariable *> & localVars,
+                                    const std::vector<Instruction *> & code)
+{
+    Value * val = nullptr;
+
+    switch (ref.kind) {
+        case IR_BIN_VALUE_CONST:
+            val = module->newConstInt(ref.index);
+            break;
+        case IR_BIN_VALUE_GLOBAL:
+            if ((ref.index >= 0) && ((size_t) ref.index < globals.size())) {
+                val = globals[ref.index];
+            }
+            break;
+        case IR_BIN_VALUE_PARAM:
+            if ((ref.index >= 0) && ((size_t) ref.index < func->getParams().size())) {
+                val = func->getParams()[ref.index];
+            }
+            break;
+        case IR_BIN_VALUE_LOCAL:
+            if ((ref.index >= 0) && ((size_t) ref.index < localVars.size())) {
+                val = localVars[ref.index];
+            }
+            break;
+        case IR_BIN_VALUE_INST:
+            // 只能引用前面已经创建的、有结果值的指令，Label、跳转等指令不能作为操作数
+            if ((ref.index >= 0) && ((size_t) ref.index < code.size()) && code[ref.index]->hasResultValue()) {
+                val = code[ref.index];
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (!val) {
+        lastError = "操作数引用不合法";
+    }
+
+    return val;
+}
+
+///
+/// @brief 创建函数的局部变量与指令
+/// @param func 函数
+/// @param record 函数记录
+/// @return true 成功
+///
+bool IRBinaryReader::loadFunctionBody(Function * func, const IRBinFunction & record)
+{
+    if (!inRange(record.localBegin, record.localCount, header->locals.count) ||
+        !inRange(record.instBegin, record.instCount, header->insts.count)) {
+        lastError = "局部变量或者指令下标越界";
+        return false;
+    }
+
+    std::vector<LocalVariable *> localVars;
+    for (uint32_t k = 0; k < record.localCount; ++k) {
+
+        const IRBinLocal & localRecord = localRecords[record.localBegin + k];
+
+        const char * name;
+        Type * type;
+        if (!getString(localRecord.name, name) || !getType(localRecord.type, type)) {
+            return false;
+        }
+
+        localVars.push_back(func->newLocalVarValue(type, name, localRecord.scopeLevel));
+    }
+
+    const IRBinInst * records = instRecords + record.instBegin;
+
+    // 先创建所有的Label指令，跳转指令可以引用后面的Label
+    std::vector<LabelInstruction *> labels(record.instCount, nullptr);
+    for (uint32_t k = 0; k < record.instCount; ++k) {
+        if (records[k].op == (uint16_t) IRInstOperator::IRINST_OP_LABEL) {
+            labels[k] = new LabelInstruction(func);
+        }
+    }
+
+    auto getLabel = [&](int32_t index) -> LabelInstruction * {
+        return ((index >= 0) && ((uint32_t) index < record.instCount)) ? labels[index] : nullptr;
+    };
+
+    std::vector<Instruction *> code;
+    std::vector<Value *> srcVals;
+
+    for (uint32_t k = 0; k < record.instCount; ++k) {
+
+        const IRBinInst & instRecord = records[k];
+        auto op = (IRInstOperator) instRecord.op;
+
+        Type * type;
+        if (!getType(instRecord.type, type)) {
+            return false;
+        }
+
+        if (!inRange(instRecord.operandBegin, instRecord.operandCount, header->operands.count)) {
+            lastError = "操作数下标越界";
+            return false;
+        }
+
+        srcVals.clear();
+        for (uint32_t i = 0; i < instRecord.operandCount; ++i) {
+            Value * val = decodeValue(operandRecords[instRecord.operandBegin + i], func, localVars, code);
+            if (!val) {
+                return false;
+            }
+            if (!isDataValue(val)) {
+                lastError = "第" + std::to_string(k) + "条指令的操作数类型不合法";
+                return false;
+            }
+            srcVals.push_back(val);
+        }
+
+        Instruction * inst = nullptr;
+        size_t num = srcVals.size();
+
+        switch (op) {
+            case IRInstOperator::IRINST_OP_ENTRY:
+                if (num == 0) {
+                    inst = new EntryInstruction(func);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_LABEL:
+                if (num == 0) {
+                    inst = labels[k];
+                }
+                break;
+            case IRInstOperator::IRINST_OP_EXIT:
+                if ((num == 0) || ((num == 1) && isIntegerValue(srcVals[0]))) {
+                    inst = new ExitInstruction(func, num ? srcVals[0] : nullptr);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_GOTO: {
+                LabelInstruction * target = getLabel(instRecord.target);
+                if (instRecord.flags & IR_BIN_INST_CONDITIONAL) {
+                    LabelInstruction * falseTarget = getLabel(instRecord.falseTarget);
+                    if (target && falseTarget && (num == 1) && isIntegerValue(srcVals[0])) {
+                        inst = new GotoInstruction(func, srcVals[0], target, falseTarget);
+                    }
+                } else if (target && (num == 0)) {
+                    inst = new GotoInstruction(func, target);
+                }
+                break;
+            }
+            case IRInstOperator::IRINST_OP_ASSIGN: {
+                bool isStore = (instRecord.flags & IR_BIN_INST_POINTER_STORE) != 0;
+                bool isLoad = (instRecord.flags & IR_BIN_INST_POINTER_LOAD) != 0;
+                bool isArrayToPointer = (instRecord.flags & IR_BIN_INST_ARRAY_TO_POINTER) != 0;
+
+                // 常量不能被赋值，指针读写的地址必须是指针，数组转指针的源必须是数组
+                if ((num == 2) && !dynamic_cast<ConstInt *>(srcVals[0]) &&
+                    (!isStore || srcVals[0]->getType()->isPointerType()) &&
+                    (!isLoad || srcVals[1]->getType()->isPointerType()) &&
+                    (!isArrayToPointer || srcVals[1]->getType()->isArrayType())) {
+                    auto moveInst = new MoveInstruction(func, srcVals[0], srcVals[1]);
+                    moveInst->setIsPointerStore(isStore);
+                    moveInst->setIsPointerLoad(isLoad);
+                    moveInst->setIsArrayToPointer(isArrayToPointer);
+                    inst = moveInst;
+                }
+                break;
+            }
+            case IRInstOperator::IRINST_OP_NEG_I:
+                if ((num == 1) && isIntegerValue(srcVals[0]) && type->isIntegerType()) {
+                    inst = new BinaryInstruction(func, op, srcVals[0], nullptr, type);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_ADD_I:
+            case IRInstOperator::IRINST_OP_SUB_I:
+                // 数组元素的地址计算中，加减运算的操作数与结果可以是指针或者数组
+                if ((num == 2) && (type->isIntegerType() || type->isPointerType())) {
+                    inst = new BinaryInstruction(func, op, srcVals[0], srcVals[1], type);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_MUL_I:
+            case IRInstOperator::IRINST_OP_DIV_I:
+            case IRInstOperator::IRINST_OP_MOD_I:
+            case IRInstOperator::IRINST_OP_LT_I:
+            case IRInstOperator::IRINST_OP_GT_I:
+            case IRInstOperator::IRINST_OP_LE_I:
+            case IRInstOperator::IRINST_OP_GE_I:
+            case IRInstOperator::IRINST_OP_EQ_I:
+            case IRInstOperator::IRINST_OP_NE_I:
+                if ((num == 2) && isIntegerValue(srcVals[0]) && isIntegerValue(srcVals[1]) && type->isIntegerType()) {
+                    inst = new BinaryInstruction(func, op, srcVals[0], srcVals[1], type);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_FUNC_CALL:
+                if ((instRecord.target >= 0) && ((size_t) instRecord.target < functions.size()) &&
+                    (type == functions[instRecord.target]->getReturnType())) {
+                    inst = new FuncCallInstruction(func, functions[instRecord.target], srcVals, type);
+                }
+                break;
+            case IRInstOperator::IRINST_OP_ARG:
+                if (num == 1) {
+                    inst = new ArgInstruction(func, srcVals[0]);
+                }
+                break;
+            default:
+                break;
+        }
+
+        if (!inst) {
+            // 还没有加入到函数中的Label需要释放
+            for (uint32_t i = k; i < record.instCount; ++i) {
+                delete labels[i];
+            }
+
+            lastError = "第" + std::to_string(k) + "条指令不合法";
+            return false;
+        }
+
+        func->getInterCode().addInst(inst);
+        code.push_back(inst);
+    }
+
+    if ((record.exitLabel >= 0) && ((uint32_t) record.exitLabel < record.instCount)) {
+        func->setExitLabel(code[record.exitLabel]);
+    }
+
+    if ((record.returnValue >= 0) && ((uint32_t) record.returnValue < record.localCount)) {
+        func->setReturnValue(localVars[record.returnValue]);
+    }
+
+    return true;
+}
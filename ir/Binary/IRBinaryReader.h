@@ -0,0 +1,164 @@
+///
+/// @file IRBinaryReader.h
+/// @brief 读入二进制模块文件，重建Module的线性IR
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "IRBinaryFormat.h"
+#include "Module.h"
+
+///
+/// @brief 线性IR二进制模块文件的读入器，文件通过mmap映射，记录直接按结构体访问
+///
+class IRBinaryReader {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要填充的模块，内部只含有内置函数
+    ///
+    explicit IRBinaryReader(Module * _module);
+
+    ///
+    /// @brief 映射文件并重建模块
+    /// @param filename 文件名
+    /// @return true 成功
+    /// @return false 失败，错误信息通过getLastError获取
+    ///
+    bool read(const std::string & filename);
+
+    ///
+    /// @brief 从内存重建模块，内存需8字节对齐
+    /// @param data 文件内容
+    /// @param _size 字节数
+    /// @return true 成功
+    /// @return false 失败，错误信息通过getLastError获取
+    ///
+    bool load(const char * data, size_t _size);
+
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    ///
+    /// @brief 取得节的记录数组，检查越界与对齐
+    /// @param section 节描述
+    /// @param name 节名，用于错误信息
+    /// @param records 记录数组
+    /// @return true 成功
+    ///
+    template <typename T>
+    bool getSection(const IRBinSection & section, const char * name, const T *& records);
+
+    ///
+    /// @brief 取得字符串表中的字符串
+    /// @param offset 偏移
+    /// @param str 字符串
+    /// @return true 成功
+    ///
+    bool getString(uint32_t offset, const char *& str);
+
+    ///
+    /// @brief 取得类型
+    /// @param index 类型下标
+    /// @param type 类型
+    /// @return true 成功
+    ///
+    bool getType(uint32_t index, Type *& type);
+
+    ///
+    /// @brief 创建类型表中的所有类型
+    /// @return true 成功
+    ///
+    bool loadTypes();
+
+    ///
+    /// @brief 创建函数的局部变量与指令
+    /// @param func 函数
+    /// @param record 函数记录
+    /// @return true 成功
+    ///
+    bool loadFunctionBody(Function * func, const IRBinFunction & record);
+
+    ///
+    /// @brief 把操作数引用解码为Value
+    /// @param ref 引用
+    /// @param func 所在函数
+    /// @param localVars 所在函数的局部变量
+    /// @param code 所在函数已经创建的指令
+    /// @return Value* 失败返回空指针
+    ///
+    Value * decodeValue(const IRBinValueRef & ref,
+                        Function * func,
+                        const std::vector<LocalVariable *> & localVars,
+                        const std::vector<Instruction *> & code);
+
+    ///
+    /// @brief 要填充的模块
+    ///
+    Module * module;
+
+    /// @brief 文件头
+    const IRBinHeader * header = nullptr;
+
+    /// @brief 文件内容
+    const char * base = nullptr;
+
+    /// @brief 文件字节数
+    size_t size = 0;
+
+    /// @brief 字符串表
+    const char * strings = nullptr;
+
+    /// @brief 类型表
+    const IRBinType * typeRecords = nullptr;
+
+    /// @brief 数组维度表
+    const uint32_t * dimRecords = nullptr;
+
+    /// @brief 全局变量表
+    const IRBinGlobal * globalRecords = nullptr;
+
+    /// @brief 函数表
+    const IRBinFunction * functionRecords = nullptr;
+
+    /// @brief 形参表
+    const IRBinParam * paramRecords = nullptr;
+
+    /// @brief 局部变量表
+    const IRBinLocal * localRecords = nullptr;
+
+    /// @brief 指令表
+    const IRBinInst * instRecords = nullptr;
+
+    /// @brief 操作数表
+    const IRBinValueRef * operandRecords = nullptr;
+
+    /// @brief 创建好的类型，与类型表一一对应
+    std::vector<Type *> types;
+
+    /// @brief 全局变量，与全局变量表一一对应
+    std::vector<Value *> globals;
+
+    /// @brief 函数，与函数表一一对应
+    std::vector<Function *> functions;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
@@ -0,0 +1,383 @@
+///
+/// @file IRBinaryWriter.cpp
+/// @brief 把Module的线性IR写成二进制模块文件
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+
+#include <cstdio>
+#include <cstring>
+
+#include "Function.h"
+#include "IntegerType.h"
+#include "PointerType.h"
+#include "ConstInt.h"
+#include "GlobalVariable.h"
+#include "FormalParam.h"
+#include "LocalVariable.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "MoveInstruction.h"
+#include "IRBinaryWriter.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+///
+/// @brief 把一节追加到缓冲区，8字节对齐
+/// @param buffer 缓冲区
+/// @param section 节描述
+/// @param data 数据
+/// @param size 字节数
+/// @param count 记录个数
+///
+static void appendSection(std::vector<char> & buffer,
+                          IRBinSection & section,
+                          const void * data,
+                          size_t size,
+                          size_t count)
+{
+    buffer.resize((buffer.size() + 7) & ~(size_t) 7, 0);
+
+    section.offset = (uint32_t) buffer.size();
+    section.count = (uint32_t) count;
+
+    if (size > 0) {
+        const char * bytes = static_cast<const char *>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+}
+
+///
+/// @brief 追加vector形式的节
+/// @param buffer 缓冲区
+/// @param section 节描述
+/// @param records 记录
+///
+template <typename T>
+static void appendSection(std::vector<char> & buffer, IRBinSection & section, const std::vector<T> & records)
+{
+    appendSection(buffer, section, records.data(), records.size() * sizeof(T), records.size());
+}
+
+///
+/// @brief 构造函数
+/// @param _module 要输出的模块
+///
+IRBinaryWriter::IRBinaryWriter(Module * _module) : module(_module)
+{
+    // 偏移0固定为空串
+    strings.push_back('\0');
+    stringIndex[""] = 0;
+}
+
+///
+/// @brief 获取字符串在字符串表中的偏移，不存在时追加
+/// @param str 字符串
+/// @return uint32_t 偏移
+///
+uint32_t IRBinaryWriter::internString(const std::string & str)
+{
+    auto pIter = stringIndex.find(str);
+    if (pIter != stringIndex.end()) {
+        return pIter->second;
+    }
+
+    auto offset = (uint32_t) strings.size();
+    strings.append(str.c_str(), str.size() + 1);
+    stringIndex[str] = offset;
+
+    return offset;
+}
+
+///
+/// @brief 获取类型在类型表中的下标，不存在时追加
+/// @param type 类型
+/// @param index 下标
+/// @return true 成功
+/// @return false 不支持的类型
+///
+bool IRBinaryWriter::internType(Type * type, uint32_t & index)
+{
+    auto pIter = typeIndex.find(type);
+    if (pIter != typeIndex.end()) {
+        index = pIter->second;
+        return true;
+    }
+
+    // 所依赖的类型先入表，保证读入时可按顺序创建
+    IRBinType record{};
+
+    if (type->isVoidType()) {
+        record.kind = IR_BIN_TYPE_VOID;
+    } else if (type->isIntegerType()) {
+        record.kind = IR_BIN_TYPE_INT;
+        record.elem = (uint32_t) static_cast<IntegerType *>(type)->getBitWidth();
+    } else if (type->isPointerType()) {
+        record.kind = IR_BIN_TYPE_POINTER;
+        auto pointee = const_cast<Type *>(static_cast<PointerType *>(type)->getPointeeType());
+        if (!internType(pointee, record.elem)) {
+            return false;
+        }
+    } else if (type->isArrayType()) {
+        auto arrayType = static_cast<ArrayType *>(type);
+        record.kind = IR_BIN_TYPE_ARRAY;
+        if (!internType(arrayType->getElementType(), record.elem)) {
+            return false;
+        }
+        record.dimBegin = (uint32_t) dims.size();
+        record.dimCount = (uint32_t) arrayType->getDimensions().size();
+        for (int dim: arrayType->getDimensions()) {
+            dims.push_back((uint32_t) dim);
+        }
+    } else {
+        lastError = "不支持的类型: " + type->toString();
+        return false;
+    }
+
+    index = (uint32_t) types.size();
+    types.push_back(record);
+    typeIndex[type] = index;
+
+    return true;
+}
+
+///
+/// @brief 把操作数编码为引用
+/// @param val 操作数
+/// @param ref 引用
+/// @return true 成功
+/// @return false 操作数不属于当前函数或者全局变量
+///
+bool IRBinaryWriter::encodeValue(Value * val, IRBinValueRef & ref)
+{
+    if (Instanceof(constVal, ConstInt *, val)) {
+        ref.kind = IR_BIN_VALUE_CONST;
+        ref.index = constVal->getVal();
+        return true;
+    }
+
+    auto pIter = localRefs.find(val);
+    if (pIter != localRefs.end()) {
+        ref = pIter->second;
+        return true;
+    }
+
+    auto gIter = globalIndex.find(val);
+    if (gIter != globalIndex.end()) {
+        ref.kind = IR_BIN_VALUE_GLOBAL;
+        ref.index = gIter->second;
+        return true;
+    }
+
+    lastError = "无法编码的操作数: " + val->getIRName();
+
+    return false;
+}
+
+///
+/// @brief 把函数的形参、局部变量与指令加入到各表中
+/// @param func 函数
+/// @return true 成功
+///
+bool IRBinaryWriter::addFunction(Function * func)
+{
+    IRBinFunction record{};
+    record.name = internString(func->getName());
+    record.flags = (func->isBuiltin() ? IR_BIN_FUNC_BUILTIN : 0) | (func->getExistFuncCall() ? IR_BIN_FUNC_EXIST_CALL : 0);
+    record.maxArgCnt = func->getMaxFuncCallArgCnt();
+    record.exitLabel = -1;
+    record.returnValue = -1;
+
+    if (!internType(func->getReturnType(), record.returnType)) {
+        return false;
+    }
+
+    localRefs.clear();
+
+    record.paramBegin = (uint32_t) params.size();
+    record.paramCount = (uint32_t) func->getParams().size();
+    for (size_t k = 0; k < func->getParams().size(); ++k) {
+        FormalParam * param = func->getParams()[k];
+
+        IRBinParam paramRecord{};
+        paramRecord.name = internString(param->getName());
+        if (!internType(param->getType(), paramRecord.type)) {
+            return false;
+        }
+
+        params.push_back(paramRecord);
+        localRefs[param] = IRBinValueRef{IR_BIN_VALUE_PARAM, (int32_t) k};
+    }
+
+    record.localBegin = (uint32_t) locals.size();
+    record.localCount = (uint32_t) func->getVarValues().size();
+    for (size_t k = 0; k < func->getVarValues().size(); ++k) {
+        LocalVariable * var = func->getVarValues()[k];
+
+        IRBinLocal localRecord{};
+        localRecord.name = internString(var->getName());
+        localRecord.scopeLevel = var->getScopeLevel();
+        if (!internType(var->getType(), localRecord.type)) {
+            return false;
+        }
+
+        locals.push_back(localRecord);
+        localRefs[var] = IRBinValueRef{IR_BIN_VALUE_LOCAL, (int32_t) k};
+
+        if (var == func->getReturnValue()) {
+            record.returnValue = (int32_t) k;
+        }
+    }
+
+    auto & code = func->getInterCode().getInsts();
+
+    // 跳转指令可以引用后面的Label，先给所有指令编号
+    for (size_t k = 0; k < code.size(); ++k) {
+        localRefs[code[k]] = IRBinValueRef{IR_BIN_VALUE_INST, (int32_t) k};
+
+        if (code[k] == func->getExitLabel()) {
+            record.exitLabel = (int32_t) k;
+        }
+    }
+
+    record.instBegin = (uint32_t) insts.size();
+    record.instCount = (uint32_t) code.size();
+    for (size_t k = 0; k < code.size(); ++k) {
+        Instruction * inst = code[k];
+
+        IRBinInst instRecord{};
+        instRecord.op = (uint16_t) inst->getOp();
+        instRecord.target = -1;
+        instRecord.falseTarget = -1;
+        if (!internType(inst->getType(), instRecord.type)) {
+            return false;
+        }
+
+        instRecord.operandBegin = (uint32_t) operands.size();
+        instRecord.operandCount = (uint32_t) inst->getOperandsNum();
+        for (auto use: inst->getOperands()) {
+            IRBinValueRef ref{};
+            if (!encodeValue(use->getUsee(), ref)) {
+                lastError = "函数" + func->getName() + "第" + std::to_string(k) + "条指令: " + lastError;
+                return false;
+            }
+
+            if ((ref.kind == IR_BIN_VALUE_INST) && (ref.index >= (int32_t) k)) {
+                lastError = "函数" + func->getName() + "第" + std::to_string(k) + "条指令使用了后面指令的结果";
+                return false;
+            }
+
+            operands.push_back(ref);
+        }
+
+        if (Instanceof(gotoInst, GotoInstruction *, inst)) {
+            instRecord.target = localRefs[gotoInst->getTarget()].index;
+            if (inst->getOperandsNum() == 1) {
+                instRecord.flags |= IR_BIN_INST_CONDITIONAL;
+                instRecord.falseTarget = localRefs[gotoInst->getFalseTarget()].index;
+            }
+        } else if (Instanceof(callInst, FuncCallInstruction *, inst)) {
+            instRecord.target = functionIndex[callInst->calledFunction];
+        } else if (Instanceof(moveInst, MoveInstruction *, inst)) {
+            instRecord.flags |= moveInst->getIsPointerStore() ? IR_BIN_INST_POINTER_STORE : 0;
+            instRecord.flags |= moveInst->getIsPointerLoad() ? IR_BIN_INST_POINTER_LOAD : 0;
+            instRecord.flags |= moveInst->getIsArrayToPointer() ? IR_BIN_INST_ARRAY_TO_POINTER : 0;
+        }
+
+        insts.push_back(instRecord);
+    }
+
+    functions.push_back(record);
+
+    return true;
+}
+
+///
+/// @brief 把模块序列化到内存
+/// @param buffer 序列化的结果
+/// @return true 成功
+/// @return false 存在不支持的类型或者操作数，错误信息通过getLastError获取
+///
+bool IRBinaryWriter::serialize(std::vector<char> & buffer)
+{
+    for (auto var: module->getGlobalVariables()) {
+        IRBinGlobal record{};
+        record.name = internString(var->getName());
+        if (!internType(var->getType(), record.type)) {
+            return false;
+        }
+
+        globalIndex[var] = (int32_t) globals.size();
+        globals.push_back(record);
+    }
+
+    // 函数调用可以引用后面定义的函数，先编号
+    for (auto func: module->getFunctionList()) {
+        functionIndex[func] = (int32_t) functionIndex.size();
+    }
+
+    for (auto func: module->getFunctionList()) {
+        if (!addFunction(func)) {
+            return false;
+        }
+    }
+
+    IRBinHeader header{};
+    header.magic = IR_BINARY_MAGIC;
+    header.version = IR_BINARY_VERSION;
+    header.byteOrder = IR_BINARY_BYTE_ORDER;
+
+    buffer.assign(sizeof(IRBinHeader), 0);
+
+    appendSection(buffer, header.strings, strings.data(), strings.size(), strings.size());
+    appendSection(buffer, header.types, types);
+    appendSection(buffer, header.dims, dims);
+    appendSection(buffer, header.globals, globals);
+    appendSection(buffer, header.functions, functions);
+    appendSection(buffer, header.params, params);
+    appendSection(buffer, header.locals, locals);
+    appendSection(buffer, header.insts, insts);
+    appendSection(buffer, header.operands, operands);
+
+    header.fileSize = (uint32_t) buffer.size();
+    std::memcpy(buffer.data(), &header, sizeof(IRBinHeader));
+
+    return true;
+}
+
+///
+/// @brief 把模块写到文件
+/// @param filename 文件名
+/// @return true 成功
+/// @return false 失败，错误信息通过getLastError获取
+///
+bool IRBinaryWriter::write(const std::string & filename)
+{
+    std::vector<char> buffer;
+    if (!serialize(buffer)) {
+        return false;
+    }
+
+    FILE * fp = fopen(filename.c_str(), "wb");
+    if (nullptr == fp) {
+        lastError = "文件(" + filename + ")打开失败";
+        return false;
+    }
+
+    bool result = fwrite(buffer.data(), 1, buffer.size(), fp) == buffer.size();
+    result = (fclose(fp) == 0) && result;
+
+    if (!result) {
+        lastError = "文件(" + filename + ")写入失败";
+    }
+
+    return result;
+}
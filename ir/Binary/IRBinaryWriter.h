@@ -0,0 +1,139 @@
+///
+/// @file IRBinaryWriter.h
+/// @brief 把Module的线性IR写成二进制模块文件
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "IRBinaryFormat.h"
+#include "Module.h"
+
+///
+/// @brief 线性IR二进制模块文件的写入器，格式见IRBinaryFormat.h
+///
+class IRBinaryWriter {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要输出的模块
+    ///
+    explicit IRBinaryWriter(Module * _module);
+
+    ///
+    /// @brief 把模块序列化到内存
+    /// @param buffer 序列化的结果
+    /// @return true 成功
+    /// @return false 存在不支持的类型或者操作数，错误信息通过getLastError获取
+    ///
+    bool serialize(std::vector<char> & buffer);
+
+    ///
+    /// @brief 把模块写到文件
+    /// @param filename 文件名
+    /// @return true 成功
+    /// @return false 失败，错误信息通过getLastError获取
+    ///
+    bool write(const std::string & filename);
+
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    ///
+    /// @brief 获取字符串在字符串表中的偏移，不存在时追加
+    /// @param str 字符串
+    /// @return uint32_t 偏移
+    ///
+    uint32_t internString(const std::string & str);
+
+    ///
+    /// @brief 获取类型在类型表中的下标，不存在时追加
+    /// @param type 类型
+    /// @param index 下标
+    /// @return true 成功
+    /// @return false 不支持的类型
+    ///
+    bool internType(Type * type, uint32_t & index);
+
+    ///
+    /// @brief 把函数的形参、局部变量与指令加入到各表中
+    /// @param func 函数
+    /// @return true 成功
+    ///
+    bool addFunction(Function * func);
+
+    ///
+    /// @brief 把操作数编码为引用
+    /// @param val 操作数
+    /// @param ref 引用
+    /// @return true 成功
+    /// @return false 操作数不属于当前函数或者全局变量
+    ///
+    bool encodeValue(Value * val, IRBinValueRef & ref);
+
+    ///
+    /// @brief 要输出的模块
+    ///
+    Module * module;
+
+    /// @brief 字符串表
+    std::string strings;
+
+    /// @brief 字符串到偏移的映射
+    std::unordered_map<std::string, uint32_t> stringIndex;
+
+    /// @brief 类型表
+    std::vector<IRBinType> types;
+
+    /// @brief 类型到下标的映射，类型都是唯一创建的，按指针查找
+    std::unordered_map<const Type *, uint32_t> typeIndex;
+
+    /// @brief 数组维度表
+    std::vector<uint32_t> dims;
+
+    /// @brief 全局变量表
+    std::vector<IRBinGlobal> globals;
+
+    /// @brief 函数表
+    std::vector<IRBinFunction> functions;
+
+    /// @brief 形参表
+    std::vector<IRBinParam> params;
+
+    /// @brief 局部变量表
+    std::vector<IRBinLocal> locals;
+
+    /// @brief 指令表
+    std::vector<IRBinInst> insts;
+
+    /// @brief 操作数表
+    std::vector<IRBinValueRef> operands;
+
+    /// @brief 全局变量到下标的映射
+    std::unordered_map<Value *, int32_t> globalIndex;
+
+    /// @brief 函数到下标的映射
+    std::unordered_map<Function *, int32_t> functionIndex;
+
+    /// @brief 当前函数内的形参、局部变量、指令到引用的映射
+    std::unordered_map<Value *, IRBinValueRef> localRefs;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
@@ -19,6 +19,7 @@
 
 #include "IRConstant.h"
 #include "Function.h"
+#include "OutputBuffer.h"
 #include "Types/PointerType.h" // 包含 ArrayType 定义-lxg
 
 /// @brief 指定函数名字、函数类型的构造函数
@@ -72,8 +73,18 @@ bool Function::isBuiltin()
 }
 
 /// @brief 函数指令信息输出
-/// @param str 函数指令
+/// @param str 函数指令，原有内容被替换
 void Function::toString(std::string & str)
+{
+    str.clear();
+
+    OutputBuffer out(str);
+    toString(out);
+}
+
+/// @brief 函数指令信息逐条输出到输出缓冲区
+/// @param out 输出缓冲区
+void Function::toString(OutputBuffer & out)
 {
     if (builtIn) {
         // 内置函数则什么都不输出
@@ -81,7 +92,7 @@ void Function::toString(std::string & str)
     }
 
     // 输出函数头
-    str = "define " + getReturnType()->toString() + " " + getIRName() + "(";
+    out.put("define ").put(getReturnType()->toString()).put(' ').put(getIRName()).put('(');
 
     bool firstParam = false;
     for (auto & param: params) {
@@ -89,17 +100,15 @@ void Function::toString(std::string & str)
         if (!firstParam) {
             firstParam = true;
         } else {
-            str += ", ";
+            out.put(", ");
         }
 
-        std::string param_str = param->getType()->toString() + param->getIRName();
-
-        str += param_str;
+        out.put(param->getType()->toString()).put(param->getIRName());
     }
 
-    str += ")\n";
+    out.put(")\n");
 
-    str += "{\n";
+    out.put("{\n");
 
     // 输出局部变量的名字与IR名字
     for (auto & var: this->varsVector) {
@@ -110,28 +119,28 @@ void Function::toString(std::string & str)
             const std::vector<int> & dimensions = arrayType->getDimensions();
 
             // 输出基本类型和变量名：declare i32 %l1
-            str += "\tdeclare " + elemType->toString() + " " + var->getIRName();
+            out.put("\tdeclare ").put(elemType->toString()).put(' ').put(var->getIRName());
 
             // 添加数组维度信息：[10][10]
             for (int dim: dimensions) {
-                str += "[" + std::to_string(dim) + "]";
+                out.put('[').putInt(dim).put(']');
             }
 
             // 添加注释：;数组a
-            std::string realName = var->getName();
+            const std::string & realName = var->getName();
             if (!realName.empty()) {
-                str += " ;数组" + realName;
+                out.put(" ;数组").put(realName);
             }
         } else {
             // 非数组类型使用原有格式
-            str += "\tdeclare " + var->getType()->toString() + " " + var->getIRName();
+            out.put("\tdeclare ").put(var->getType()->toString()).put(' ').put(var->getIRName());
 
-            std::string realName = var->getName();
+            const std::string & realName = var->getName();
             if (!realName.empty()) {
-                str += " ; " + std::to_string(var->getScopeLevel()) + ":" + realName;
+                out.put(" ; ").putInt(var->getScopeLevel()).put(':').put(realName);
             }
         }
-        str += "\n";
+        out.put('\n');
     }
 
     // 输出临时变量的declare形式
@@ -141,29 +150,30 @@ void Function::toString(std::string & str)
         if (inst->hasResultValue()) {
 
             // 局部变量和临时变量需要输出declare语句
-            str += "\tdeclare " + inst->getType()->toString() + " " + inst->getIRName() + "\n";
+            out.put("\tdeclare ").put(inst->getType()->toString()).put(' ').put(inst->getIRName()).put('\n');
         }
     }
 
-    // 遍历所有的线性IR指令，文本输出
+    // 遍历所有的线性IR指令，文本输出，各指令共用一个字符串
+    std::string instStr;
     for (auto & inst: code.getInsts()) {
 
-        std::string instStr;
+        instStr.clear();
         inst->toString(instStr);
 
         if (!instStr.empty()) {
 
             // Label指令不加Tab键
-            if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
-                str += instStr + "\n";
-            } else {
-                str += "\t" + instStr + "\n";
+            if (inst->getOp() != IRInstOperator::IRINST_OP_LABEL) {
+                out.put('\t');
             }
+
+            out.put(instStr).put('\n');
         }
     }
 
     // 输出函数尾部
-    str += "}\n";
+    out.put("}\n");
 }
 
 /// @brief 设置函数出口指令
@@ -281,6 +291,24 @@ MemVariable * Function::newMemVariable(Type * type)
     return memValue;
 }
 
+/// @brief 获取函数内指定编号的寄存器型Value，不存在时新建
+/// \param type 寄存器类型
+/// \param name 寄存器名字
+/// \param regNo 寄存器编号
+/// \return 寄存器型Value
+RegVariable * Function::getRegVariable(Type * type, const std::string & name, int32_t regNo)
+{
+    if (regNo >= (int32_t) regVector.size()) {
+        regVector.resize(regNo + 1, nullptr);
+    }
+
+    if (regVector[regNo] == nullptr) {
+        regVector[regNo] = new RegVariable(type, name, regNo);
+    }
+
+    return regVector[regNo];
+}
+
 /// @brief 清理函数内申请的资源
 void Function::Delete()
 {
@@ -293,6 +321,18 @@ void Function::Delete()
     }
 
     varsVector.clear();
+
+    for (auto & var: memVector) {
+        delete var;
+    }
+
+    memVector.clear();
+
+    for (auto & var: regVector) {
+        delete var;
+    }
+
+    regVector.clear();
 }
 
 ///
@@ -23,10 +23,12 @@
 #include "FormalParam.h"
 #include "LocalVariable.h"
 #include "MemVariable.h"
+#include "RegVariable.h"
 #include "IRCode.h"
 
 // 在这里添加前向声明-lxg
 class BinaryInstruction;
+class OutputBuffer;
 class MoveInstruction;
 
 ///
@@ -63,10 +65,28 @@ public:
     /// @return true: 内置函数，false：用户自定义
     bool isBuiltin();
 
+    /// @brief 判断该函数是否复用增量编译缓存的汇编，是则函数没有IR指令，优化与代码生成都跳过
+    /// @return true: 复用缓存的汇编，false：正常编译
+    bool isCodeReused()
+    {
+        return codeReused;
+    }
+
+    /// @brief 设置该函数复用增量编译缓存的汇编
+    /// @param reused true: 复用，false：正常编译
+    void setCodeReused(bool reused)
+    {
+        codeReused = reused;
+    }
+
     /// @brief 函数指令信息输出
-    /// @param str 函数指令
+    /// @param str 函数指令，原有内容被替换
     void toString(std::string & str);
 
+    /// @brief 函数指令信息逐条输出到输出缓冲区
+    /// @param out 输出缓冲区
+    void toString(OutputBuffer & out);
+
     /// @brief 设置函数出口指令
     /// @param inst 出口Label指令
     void setExitLabel(Instruction * inst);
@@ -90,6 +110,13 @@ public:
         return varsVector;
     }
 
+    /// @brief 获取函数内的内存型Value清单，如栈传递的实参
+    /// @return 内存型Value清单
+    std::vector<MemVariable *> & getMemVariables()
+    {
+        return memVector;
+    }
+
     ///
     /// @brief  检查是否是函数
     /// @return true 是函数
@@ -150,6 +177,14 @@ public:
     /// \return 临时变量Value
     MemVariable * newMemVariable(Type * type);
 
+    /// @brief 获取函数内指定编号的寄存器型Value，不存在时新建。
+    /// 寄存器型Value按函数分别持有，后端按函数并行生成代码时不共享use链
+    /// \param type 寄存器类型
+    /// \param name 寄存器名字
+    /// \param regNo 寄存器编号
+    /// \return 寄存器型Value
+    RegVariable * getRegVariable(Type * type, const std::string & name, int32_t regNo);
+
     /// @brief 清理函数内申请的资源
     void Delete();
 
@@ -218,6 +253,28 @@ public:
         return extraData;
     }
 
+    /// @brief 设置函数的调用次数，来自--profile-use的剖析数据，同时标记函数带有剖析数据
+    /// @param count 调用次数
+    void setEntryCount(uint64_t count)
+    {
+        entryCount = count;
+        profiled = true;
+    }
+
+    /// @brief 获取函数的调用次数，没有剖析数据时为0
+    /// @return 调用次数
+    [[nodiscard]] uint64_t getEntryCount() const
+    {
+        return entryCount;
+    }
+
+    /// @brief 函数是否带有剖析数据，有则Label与条件跳转上的执行次数有效
+    /// @return true 有剖析数据
+    [[nodiscard]] bool hasProfile() const
+    {
+        return profiled;
+    }
+
 private:
     ///
     /// @brief 函数的返回值类型，有点冗余，可删除，直接从type中取得即可
@@ -233,6 +290,11 @@ private:
     /// @brief 是否是内置函数或者外部库函数
     ///
     bool builtIn = false;
+
+    ///
+    /// @brief 是否复用增量编译缓存的汇编
+    ///
+    bool codeReused = false;
     ///
     /// @brief 当前循环的break标签，用于break语句跳转
     ///
@@ -258,6 +320,11 @@ private:
     ///
     std::vector<MemVariable *> memVector;
 
+    ///
+    /// @brief 寄存器型Value，按寄存器编号索引
+    ///
+    std::vector<RegVariable *> regVector;
+
     ///
     /// @brief 函数出口Label指令
     ///
@@ -312,4 +379,10 @@ private:
     
     /// @brief 用于在函数间传递临时指令的额外数据
     ExtraData extraData;
+
+    /// @brief 剖析数据中函数的调用次数
+    uint64_t entryCount = 0;
+
+    /// @brief 是否带有剖析数据
+    bool profiled = false;
 };
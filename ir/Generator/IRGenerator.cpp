@@ -18,7 +18,6 @@
 #include <cstdio>
 #include <unordered_map>
 #include <vector>
-#include <iostream>
 
 #include "AST.h"
 #include "Common.h"
@@ -165,14 +164,13 @@ ast_node * IRGenerator::ir_visit_ast_node(ast_node * node)
 bool IRGenerator::ir_default(ast_node * node)
 {
     // 打印更详细的节点信息
-    printf("Unkown node(%d): 地址=%p", (int) node->node_type, (void *) node);
-
-    // 如果可能的话，打印更多信息
-    if (node) {
-        printf(", 行号=%ld, 名称=%s, 子节点数=%zu\n", node->line_no, node->name.c_str(), node->sons.size());
-    } else {
-        printf("\n");
-    }
+    minic_log(LOG_INFO,
+              "Unkown node(%d): 地址=%p, 行号=%lld, 名称=%s, 子节点数=%zu",
+              (int) node->node_type,
+              (void *) node,
+              (long long) node->line_no,
+              node->name.c_str(),
+              node->sons.size());
 
     // 返回true允许继续处理，不会导致整个编译失败
     return true;
@@ -205,7 +203,7 @@ bool IRGenerator::ir_compile_unit(ast_node * node)
     for (auto son: node->sons) {
         if (son->node_type == ast_operator_type::AST_OP_VAR_DECL ||
             son->node_type == ast_operator_type::AST_OP_DECL_STMT) {
-            printf("DEBUG: 处理全局变量声明\n");
+            minic_log(LOG_DEBUG, "处理全局变量声明");
             ast_node * var_node = ir_visit_ast_node(son);
             if (!var_node) {
                 setLastError("处理全局变量失败");
@@ -221,10 +219,10 @@ bool IRGenerator::ir_compile_unit(ast_node * node)
             ast_node * name_node = son->sons[1];
             ast_node * param_node = son->sons[2];
 
-            printf("DEBUG: 在compile_unit中注册函数: %s, 形参节点类型: %d, sons大小: %zu\n",
-                   name_node->name.c_str(),
-                   static_cast<int>(param_node->node_type),
-                   param_node->sons.size());
+            minic_log(LOG_DEBUG, "在compile_unit中注册函数: %s, 形参节点类型: %d, sons大小: %zu",
+                      name_node->name.c_str(),
+                      static_cast<int>(param_node->node_type),
+                      param_node->sons.size());
 
             // 收集参数信息
             std::vector<FormalParam *> params;
@@ -245,51 +243,51 @@ bool IRGenerator::ir_compile_unit(ast_node * node)
                             for (size_t dimIdx = 2; dimIdx < paramSon->sons.size(); dimIdx++) {
                                 if (paramSon->sons[dimIdx]->node_type == ast_operator_type::AST_OP_LEAF_LITERAL_UINT) {
                                     dimensions.push_back(paramSon->sons[dimIdx]->integer_val);
-                                    printf("DEBUG: 提取维度 %zu: %d\n",
-                                           dimIdx - 2,
-                                           paramSon->sons[dimIdx]->integer_val);
+                                    minic_log(LOG_DEBUG, "提取维度 %zu: %d",
+                                              dimIdx - 2,
+                                              paramSon->sons[dimIdx]->integer_val);
                                 }
                             }
 
                             // 保存维度信息到映射表
                             functionParameterDimensions[name_node->name][paramIdx] = dimensions;
 
-                            printf("DEBUG: 保存函数 %s 参数 %d (%s) 的维度信息，维度数: %zu\n",
-                                   name_node->name.c_str(),
-                                   (int) paramIdx,
-                                   paramName.c_str(),
-                                   dimensions.size());
+                            minic_log(LOG_DEBUG, "保存函数 %s 参数 %d (%s) 的维度信息，维度数: %zu",
+                                      name_node->name.c_str(),
+                                      (int) paramIdx,
+                                      paramName.c_str(),
+                                      dimensions.size());
 
                             // 统一使用简单指针类型注册参数
                             paramType = const_cast<Type *>(
                                 static_cast<const Type *>(PointerType::get(IntegerType::getTypeInt())));
-                            printf("DEBUG: 注册数组参数: %s 为指针类型 (i32*)\n", paramName.c_str());
+                            minic_log(LOG_DEBUG, "注册数组参数: %s 为指针类型 (i32*)", paramName.c_str());
                         } else {
-                            printf("DEBUG: 注册普通参数: %s\n", paramName.c_str());
+                            minic_log(LOG_DEBUG, "注册普通参数: %s", paramName.c_str());
                         }
 
                         params.push_back(new FormalParam{paramType, paramName});
-                        printf("DEBUG: 添加参数: %s\n", paramName.c_str());
+                        minic_log(LOG_DEBUG, "添加参数: %s", paramName.c_str());
                     }
                 }
             } else {
                 // 如果AST中没有参数信息，但根据函数名称可以推断需要参数
                 if (name_node->name == "get_one") {
                     params.push_back(new FormalParam{IntegerType::getTypeInt(), "a"});
-                    printf("DEBUG: 为函数 %s 添加参数: a\n", name_node->name.c_str());
+                    minic_log(LOG_DEBUG, "为函数 %s 添加参数: a", name_node->name.c_str());
                 } else if (name_node->name == "deepWhileBr") {
                     params.push_back(new FormalParam{IntegerType::getTypeInt(), "a"});
                     params.push_back(new FormalParam{IntegerType::getTypeInt(), "b"});
-                    printf("DEBUG: 为函数 %s 添加参数: a, b\n", name_node->name.c_str());
+                    minic_log(LOG_DEBUG, "为函数 %s 添加参数: a, b", name_node->name.c_str());
                 }
             }
 
             // 注册函数原型(带参数信息)
             Function * func = module->newFunction(name_node->name, type_node->type, params);
             if (func) {
-                printf("注册函数原型: %s 成功，参数数量: %zu\n", name_node->name.c_str(), params.size());
+                minic_log(LOG_DEBUG, "注册函数原型: %s 成功，参数数量: %zu", name_node->name.c_str(), params.size());
             } else {
-                printf("注册函数原型: %s 失败\n", name_node->name.c_str());
+                minic_log(LOG_INFO, "注册函数原型: %s 失败", name_node->name.c_str());
             }
         }
     }
@@ -297,6 +295,16 @@ bool IRGenerator::ir_compile_unit(ast_node * node)
     // 第三遍：处理函数定义
     for (auto son: node->sons) {
         if (son->node_type == ast_operator_type::AST_OP_FUNC_DEF) {
+
+            // 复用缓存汇编的函数只需要原型，供其它函数调用
+            if (reusedFunctions && reusedFunctions->count(son->sons[1]->name)) {
+                Function * func = module->findFunction(son->sons[1]->name);
+                if (func) {
+                    func->setCodeReused(true);
+                    continue;
+                }
+            }
+
             ast_node * son_node = ir_visit_ast_node(son);
             if (!son_node) {
                 return false;
@@ -315,7 +323,7 @@ bool IRGenerator::ir_function_define(ast_node * node)
     bool result;
 
     ast_node * name_node = node->sons[1];
-    printf("DEBUG: 处理函数定义: %s\n", name_node->name.c_str());
+    minic_log(LOG_DEBUG, "处理函数定义: %s", name_node->name.c_str());
 
     // 创建一个函数，用于当前函数处理
     if (module->getCurrentFunction()) {
@@ -340,7 +348,7 @@ bool IRGenerator::ir_function_define(ast_node * node)
         // 如果函数不存在，使用AST中的信息创建函数参数列表
         std::vector<FormalParam *> params;
         if (param_node && !param_node->sons.empty()) {
-            printf("DEBUG: 从AST获取函数参数，数量: %zu\n", param_node->sons.size());
+            minic_log(LOG_DEBUG, "从AST获取函数参数，数量: %zu", param_node->sons.size());
             for (auto & paramSon: param_node->sons) {
                 if (paramSon->sons.size() < 2) {
                     setLastError("形参节点格式错误");
@@ -350,10 +358,10 @@ bool IRGenerator::ir_function_define(ast_node * node)
                 Type * paramType = paramSon->sons[0]->type;
                 std::string paramName = paramSon->sons[1]->name;
                 params.push_back(new FormalParam{paramType, paramName});
-                printf("DEBUG: 添加参数: %s\n", paramName.c_str());
+                minic_log(LOG_DEBUG, "添加参数: %s", paramName.c_str());
             }
         } else {
-            printf("DEBUG: 函数 %s 在AST中没有参数信息\n", name_node->name.c_str());
+            minic_log(LOG_DEBUG, "函数 %s 在AST中没有参数信息", name_node->name.c_str());
         }
 
         // 创建一个新的函数定义
@@ -363,9 +371,9 @@ bool IRGenerator::ir_function_define(ast_node * node)
             return false;
         }
 
-        printf("DEBUG: 创建新函数: %s, 参数数量: %zu\n", name_node->name.c_str(), newFunc->getParams().size());
+        minic_log(LOG_DEBUG, "创建新函数: %s, 参数数量: %zu", name_node->name.c_str(), newFunc->getParams().size());
     } else {
-        printf("DEBUG: 使用已注册的函数: %s, 参数数量: %zu\n", name_node->name.c_str(), newFunc->getParams().size());
+        minic_log(LOG_DEBUG, "使用已注册的函数: %s, 参数数量: %zu", name_node->name.c_str(), newFunc->getParams().size());
     }
 
     // 当前函数设置有效，变更为当前的函数
@@ -393,7 +401,7 @@ bool IRGenerator::ir_function_define(ast_node * node)
             if (globalVar) {
                 MoveInstruction * initInst = new MoveInstruction(newFunc, globalVar, module->newConstInt(initValue));
                 irCode.addInst(initInst);
-                printf("DEBUG: 在main函数中初始化全局变量 %s = %d\n", varName.c_str(), initValue);
+                minic_log(LOG_DEBUG, "在main函数中初始化全局变量 %s = %d", varName.c_str(), initValue);
             }
         }
     }
@@ -433,15 +441,15 @@ bool IRGenerator::ir_function_define(ast_node * node)
     }
 
     // 打印调试信息
-    printf("DEBUG: 函数 %s 的block节点指令数量: %zu\n",
-           name_node->name.c_str(),
-           block_node->blockInsts.getInsts().size());
+    minic_log(LOG_DEBUG, "函数 %s 的block节点指令数量: %zu",
+              name_node->name.c_str(),
+              block_node->blockInsts.getInsts().size());
 
     // IR指令追加到当前的节点中
     node->blockInsts.addInst(block_node->blockInsts);
 
     // 此时，所有指令都加入到当前函数中，也就是node->blockInsts
-    printf("DEBUG: 函数 %s 的node节点指令数量: %zu\n", name_node->name.c_str(), node->blockInsts.getInsts().size());
+    minic_log(LOG_DEBUG, "函数 %s 的node节点指令数量: %zu", name_node->name.c_str(), node->blockInsts.getInsts().size());
 
     // node节点的指令移动到函数的IR指令列表中
     irCode.addInst(node->blockInsts);
@@ -453,7 +461,7 @@ bool IRGenerator::ir_function_define(ast_node * node)
     irCode.addInst(new ExitInstruction(newFunc, retValue));
 
     // 打印最终IR指令
-    printf("DEBUG: 函数 %s 的最终IR指令数量: %zu\n", name_node->name.c_str(), irCode.getInsts().size());
+    minic_log(LOG_DEBUG, "函数 %s 的最终IR指令数量: %zu", name_node->name.c_str(), irCode.getInsts().size());
 
     // 恢复成外部函数
     module->setCurrentFunction(nullptr);
@@ -562,7 +570,7 @@ bool IRGenerator::ir_function_formal_params(ast_node * node)
     // 获取函数的IR代码列表
     InterCode & irCode = currentFunc->getInterCode();
 
-    printf("DEBUG: 处理函数形参，数量: %zu, 函数参数数量: %zu\n", node->sons.size(), currentFunc->getParams().size());
+    minic_log(LOG_DEBUG, "处理函数形参，数量: %zu, 函数参数数量: %zu", node->sons.size(), currentFunc->getParams().size());
 
     // 获取函数的参数列表
     const std::vector<FormalParam *> & functionParams = currentFunc->getParams();
@@ -591,7 +599,7 @@ bool IRGenerator::ir_function_formal_params(ast_node * node)
             Type * actualParamType =
                 const_cast<Type *>(static_cast<const Type *>(PointerType::get(IntegerType::getTypeInt())));
 
-            printf("DEBUG: 处理函数数组参数: %s, 类型: pointer (i32*)\n", paramName.c_str());
+            minic_log(LOG_DEBUG, "处理函数数组参数: %s, 类型: pointer (i32*)", paramName.c_str());
 
             // 直接在符号表中注册参数，避免创建局部变量和赋值指令
             if (!module->newVarValueWithValue(actualParamType, paramName, param)) {
@@ -599,11 +607,11 @@ bool IRGenerator::ir_function_formal_params(ast_node * node)
                 return false;
             }
 
-            printf("DEBUG: 直接注册数组参数到符号表: %s (避免局部变量赋值)\n", paramName.c_str());
+            minic_log(LOG_DEBUG, "直接注册数组参数到符号表: %s (避免局部变量赋值)", paramName.c_str());
 
         } else {
             // 普通参数：保持原来的方式，创建局部变量并赋值
-            printf("DEBUG: 处理函数参数: %s, 类型: %s\n", paramName.c_str(), paramType->isInt32Type() ? "int" : "其他");
+            minic_log(LOG_DEBUG, "处理函数参数: %s, 类型: %s", paramName.c_str(), paramType->isInt32Type() ? "int" : "其他");
 
             // 1. 创建局部变量作为实际的形参变量（在函数内部使用）
             Value * localParam = module->newVarValue(paramType, paramName);
@@ -622,7 +630,7 @@ bool IRGenerator::ir_function_formal_params(ast_node * node)
             // 4. 将赋值指令添加到函数的IR代码中（在Entry指令之后）
             irCode.addInst(moveInst);
 
-            printf("DEBUG: 为普通参数创建局部变量和赋值: %s\n", paramName.c_str());
+            minic_log(LOG_DEBUG, "为普通参数创建局部变量和赋值: %s", paramName.c_str());
         }
     }
 
@@ -724,11 +732,11 @@ bool IRGenerator::ir_function_call(ast_node * node)
     std::string funcName = node->sons[0]->name;
     int64_t lineno = node->sons[0]->line_no;
 
-    printf("DEBUG: 处理函数调用: %s 在第%lld行\n", funcName.c_str(), (long long) lineno);
+    minic_log(LOG_DEBUG, "处理函数调用: %s 在第%lld行", funcName.c_str(), (long long) lineno);
 
     ast_node * paramsNode = node->sons[1];
     int actualParamCount = paramsNode->sons.size();
-    printf("DEBUG: 函数调用 %s 提供的参数数量: %d\n", funcName.c_str(), actualParamCount);
+    minic_log(LOG_DEBUG, "函数调用 %s 提供的参数数量: %d", funcName.c_str(), actualParamCount);
 
     // 根据函数名查找函数，看是否存在。若不存在则出错
     auto calledFunction = module->findFunction(funcName);
@@ -740,7 +748,7 @@ bool IRGenerator::ir_function_call(ast_node * node)
     }
 
     int formalParamCount = calledFunction->getParams().size();
-    printf("DEBUG: 找到函数: %s, 需要%d个参数\n", funcName.c_str(), formalParamCount);
+    minic_log(LOG_DEBUG, "找到函数: %s, 需要%d个参数", funcName.c_str(), formalParamCount);
 
     // 当前函数存在函数调用
     currentFunc->setExistFuncCall(true);
@@ -807,22 +815,22 @@ bool IRGenerator::ir_function_call(ast_node * node)
         for (size_t i = 0; i < paramsNode->sons.size(); i++) {
             ast_node * son = paramsNode->sons[i];
 
-            printf("DEBUG: 处理参数 #%zu, 节点类型: %d, 变量名: %s\n",
-                   i,
-                   static_cast<int>(son->node_type),
-                   son->name.c_str());
+            minic_log(LOG_DEBUG, "处理参数 #%zu, 节点类型: %d, 变量名: %s",
+                      i,
+                      static_cast<int>(son->node_type),
+                      son->name.c_str());
 
             // 检查形参是否为指针类型（即数组参数）
             bool shouldPassAsPointer = false;
             if (i < formalParams.size()) {
                 Type * formalParamType = formalParams[i]->getType();
                 shouldPassAsPointer = formalParamType && formalParamType->isPointerType();
-                printf("DEBUG: 形参 #%zu 类型检查 - isPointerType: %s\n", i, shouldPassAsPointer ? "是" : "否");
+                minic_log(LOG_DEBUG, "形参 #%zu 类型检查 - isPointerType: %s", i, shouldPassAsPointer ? "是" : "否");
             }
 
             // 关键修改：正确处理不同维度的数组参数传递
             if (son->node_type == ast_operator_type::AST_OP_ARRAY_ACCESS && shouldPassAsPointer) {
-                printf("DEBUG: *** 处理数组访问作为指针参数: %s[...] ***\n", son->sons[0]->name.c_str());
+                minic_log(LOG_DEBUG, "*** 处理数组访问作为指针参数: %s[...] ***", son->sons[0]->name.c_str());
 
                 // 获取形参的实际类型
                 Type * formalParamType = formalParams[i]->getType();
@@ -839,7 +847,7 @@ bool IRGenerator::ir_function_call(ast_node * node)
                 if (ArrayType * arrayParamType = dynamic_cast<ArrayType *>(formalParamType)) {
                     // 形参是数组类型 int[0][2][3]...
                     const std::vector<int> & paramDimensions = arrayParamType->getDimensions();
-                    printf("DEBUG: 形参是多维数组类型，维度数: %zu\n", paramDimensions.size());
+                    minic_log(LOG_DEBUG, "形参是多维数组类型，维度数: %zu", paramDimensions.size());
 
                     // 计算正确的偏移量，考虑形参的维度信息
                     Value * correctOffset = calculateParameterOffset(son, paramDimensions, node->blockInsts);
@@ -858,10 +866,10 @@ bool IRGenerator::ir_function_call(ast_node * node)
                     node->blockInsts.addInst(addInst);
                     realParams.push_back(addInst);
 
-                    printf("DEBUG: 生成多维数组参数传递: %s -> 偏移量计算\n", arrayName.c_str());
+                    minic_log(LOG_DEBUG, "生成多维数组参数传递: %s -> 偏移量计算", arrayName.c_str());
                 } else {
                     // 形参是简单指针类型 int*，按照原有逻辑处理
-                    printf("DEBUG: 形参是简单指针类型，使用原逻辑\n");
+                    minic_log(LOG_DEBUG, "形参是简单指针类型，使用原逻辑");
 
                     // 计算实际的数组偏移量
                     Value * totalOffset = calculateArrayAccessOffset(son, node->blockInsts);
@@ -881,7 +889,7 @@ bool IRGenerator::ir_function_call(ast_node * node)
                     realParams.push_back(finalAddrInst);
                 }
 
-                printf("DEBUG: 完成数组访问参数传递\n");
+                minic_log(LOG_DEBUG, "完成数组访问参数传递");
                 continue;
             }
 
@@ -889,18 +897,18 @@ bool IRGenerator::ir_function_call(ast_node * node)
             else if (son->node_type == ast_operator_type::AST_OP_LEAF_VAR_ID) {
                 Value * paramVar = module->findVarValue(son->name);
 
-                printf("DEBUG: 找到变量: %s, 变量存在: %s\n", son->name.c_str(), paramVar ? "是" : "否");
+                minic_log(LOG_DEBUG, "找到变量: %s, 变量存在: %s", son->name.c_str(), paramVar ? "是" : "否");
 
                 if (paramVar) {
-                    printf("DEBUG: 变量 %s 类型检查 - isArrayType: %s, isPointerType: %s\n",
-                           son->name.c_str(),
-                           paramVar->getType()->isArrayType() ? "是" : "否",
-                           paramVar->getType()->isPointerType() ? "是" : "否");
+                    minic_log(LOG_DEBUG, "变量 %s 类型检查 - isArrayType: %s, isPointerType: %s",
+                              son->name.c_str(),
+                              paramVar->getType()->isArrayType() ? "是" : "否",
+                              paramVar->getType()->isPointerType() ? "是" : "否");
                 }
 
                 if (paramVar && paramVar->getType()->isArrayType() && shouldPassAsPointer) {
                     // 数组参数：生成 add %array, 0 得到指针
-                    printf("DEBUG: *** 传递数组参数: %s (add %%array, 0 得到指针) ***\n", son->name.c_str());
+                    minic_log(LOG_DEBUG, "*** 传递数组参数: %s (add %%array, 0 得到指针) ***", son->name.c_str());
 
                     Type * ptrType =
                         const_cast<Type *>(static_cast<const Type *>(PointerType::get(IntegerType::getTypeInt())));
@@ -915,19 +923,19 @@ bool IRGenerator::ir_function_call(ast_node * node)
 
                     realParams.push_back(ptrVar);
 
-                    printf("DEBUG: 创建了数组到指针衰减: %s -> %s\n",
-                           paramVar->getIRName().c_str(),
-                           ptrVar->getIRName().c_str());
+                    minic_log(LOG_DEBUG, "创建了数组到指针衰减: %s -> %s",
+                              paramVar->getIRName().c_str(),
+                              ptrVar->getIRName().c_str());
                     continue;
                 } else {
-                    printf("DEBUG: 不满足数组参数条件，按普通参数处理\n");
+                    minic_log(LOG_DEBUG, "不满足数组参数条件，按普通参数处理");
                 }
             } else {
-                printf("DEBUG: 节点类型不是 AST_OP_LEAF_VAR_ID\n");
+                minic_log(LOG_DEBUG, "节点类型不是 AST_OP_LEAF_VAR_ID");
             }
 
             // 处理其他类型的参数
-            printf("DEBUG: 按普通参数处理: %s\n", son->name.c_str());
+            minic_log(LOG_DEBUG, "按普通参数处理: %s", son->name.c_str());
             ast_node * temp = ir_visit_ast_node(son);
             if (!temp) {
                 setLastError("处理函数" + funcName + "的参数时失败");
@@ -948,25 +956,25 @@ bool IRGenerator::ir_function_call(ast_node * node)
         minic_log(LOG_ERROR, "%s", error.c_str());
 
         // 调试输出每个形参的名称和类型
-        printf("DEBUG: 函数 %s 的形参列表:\n", funcName.c_str());
+        minic_log(LOG_DEBUG, "函数 %s 的形参列表:", funcName.c_str());
         for (size_t i = 0; i < calledFunction->getParams().size(); i++) {
             auto param = calledFunction->getParams()[i];
-            printf("  参数 #%zu: %s\n", i, param->getName().c_str());
+            minic_log(LOG_DEBUG, "  参数 #%zu: %s", i, param->getName().c_str());
         }
 
         return false;
     }
 
-    printf("DEBUG: 函数调用参数检查通过: %s\n", funcName.c_str());
+    minic_log(LOG_DEBUG, "函数调用参数检查通过: %s", funcName.c_str());
     // 返回调用有返回值，则需要分配临时变量，用于保存函数调用的返回值
     Type * type = calledFunction->getReturnType();
 
     FuncCallInstruction * funcCallInst = new FuncCallInstruction(currentFunc, calledFunction, realParams, type);
 
     //关键调试：创建指令后立即检查-lxg
-    printf("DEBUG: 函数调用指令创建完成，指令对象地址: %p\n", (void *) funcCallInst);
+    minic_log(LOG_DEBUG, "函数调用指令创建完成，指令对象地址: %p", (void *) funcCallInst);
     if (funcCallInst) {
-        printf("DEBUG: 函数调用指令的返回值类型: %s\n", funcCallInst->getType()->isInt32Type() ? "i32" : "其他");
+        minic_log(LOG_DEBUG, "函数调用指令的返回值类型: %s", funcCallInst->getType()->isInt32Type() ? "i32" : "其他");
     }
 
     // 创建函数调用指令
@@ -1937,7 +1945,7 @@ bool IRGenerator::ir_break(ast_node * node)
     Instruction * breakLabel = func->getBreakLabel();
     if (!breakLabel) {
         // 不在循环内使用break
-        std::cerr << "Error: break statement not inside a loop" << std::endl;
+        minic_log(LOG_ERROR, "break statement not inside a loop");
         return false;
     }
 
@@ -1958,7 +1966,7 @@ bool IRGenerator::ir_continue(ast_node * node)
     Instruction * continueLabel = func->getContinueLabel();
     if (!continueLabel) {
         // 不在循环内使用continue
-        std::cerr << "Error: continue statement not inside a loop" << std::endl;
+        minic_log(LOG_ERROR, "continue statement not inside a loop");
         return false;
     }
 
@@ -2102,9 +2110,9 @@ bool IRGenerator::ir_assign(ast_node * node)
         storeInst->setIsPointerStore(true); // 标记为指针存储，需要在MoveInstruction类中添加此字段和方法
         node->blockInsts.addInst(storeInst);
 
-        printf("DEBUG: 通过指针为数组元素赋值: *%s = %s\n",
-               left->arrayPtr->getIRName().c_str(),
-               right->val->getIRName().c_str());
+        minic_log(LOG_DEBUG, "通过指针为数组元素赋值: *%s = %s",
+                  left->arrayPtr->getIRName().c_str(),
+                  right->val->getIRName().c_str());
     } else {
         // 普通赋值
         MoveInstruction * movInst = new MoveInstruction(module->getCurrentFunction(), left->val, right->val);
@@ -2205,19 +2213,19 @@ bool IRGenerator::ir_leaf_node_var_id(ast_node * node)
     Value * val = module->findVarValue(node->name);
 
     if (!val) {
-        printf("DEBUG: 在符号表中未找到变量: %s, 尝试查找函数参数\n", node->name.c_str());
+        minic_log(LOG_DEBUG, "在符号表中未找到变量: %s, 尝试查找函数参数", node->name.c_str());
 
         // 查找是否是函数参数
         Function * currentFunc = module->getCurrentFunction();
         if (currentFunc) {
             for (auto & param: currentFunc->getParams()) {
                 if (param->getName() == node->name) {
-                    printf("DEBUG: 找到匹配的函数参数: %s\n", node->name.c_str());
+                    minic_log(LOG_DEBUG, "找到匹配的函数参数: %s", node->name.c_str());
                     // 如果找到了匹配的参数名，试图再次在符号表中查找
                     // 这里假设之前在ir_function_formal_params已经创建了这个变量
                     val = module->findVarValue(node->name);
                     if (val) {
-                        printf("DEBUG: 再次查找成功，找到变量: %s\n", node->name.c_str());
+                        minic_log(LOG_DEBUG, "再次查找成功，找到变量: %s", node->name.c_str());
                     }
                     break;
                 }
@@ -2226,7 +2234,7 @@ bool IRGenerator::ir_leaf_node_var_id(ast_node * node)
     }
 
     if (!val) {
-        printf("ERROR: 变量未找到: %s\n", node->name.c_str());
+        minic_log(LOG_ERROR, "变量未找到: %s", node->name.c_str());
         setLastError("变量未找到: " + node->name);
         return false;
     }
@@ -2303,7 +2311,7 @@ bool IRGenerator::ir_variable_declare(ast_node * node)
 
     std::string varName = node->sons[1]->name;
 
-    printf("DEBUG: 处理变量声明: %s, 子节点数量: %zu\n", varName.c_str(), node->sons.size());
+    minic_log(LOG_DEBUG, "处理变量声明: %s, 子节点数量: %zu", varName.c_str(), node->sons.size());
 
     // 创建变量
     Value * var = module->newVarValue(varType, varName);
@@ -2317,7 +2325,7 @@ bool IRGenerator::ir_variable_declare(ast_node * node)
 
     // 处理变量初始化
     if (node->sons.size() > 2 && node->sons[2]) {
-        printf("DEBUG: 变量 %s 有初始化表达式\n", varName.c_str());
+        minic_log(LOG_DEBUG, "变量 %s 有初始化表达式", varName.c_str());
 
         if (currentFunc) {
             // 局部变量初始化
@@ -2339,14 +2347,14 @@ bool IRGenerator::ir_variable_declare(ast_node * node)
 
                     // 添加赋值指令
                     node->blockInsts.addInst(moveInst);
-                    printf("DEBUG: 为局部变量 %s 生成了初始化为%u的指令\n", varName.c_str(), value);
+                    minic_log(LOG_DEBUG, "为局部变量 %s 生成了初始化为%u的指令", varName.c_str(), value);
                 } else {
                     setLastError("变量 " + varName + " 的初始化表达式没有产生有效值");
                     return false;
                 }
             } else {
-                printf("DEBUG: 初始化表达式生成的值类型: %s\n",
-                       init_expr->val->getType()->isInt32Type() ? "int32" : "其他");
+                minic_log(LOG_DEBUG, "初始化表达式生成的值类型: %s",
+                          init_expr->val->getType()->isInt32Type() ? "int32" : "其他");
 
                 // 生成赋值指令
                 MoveInstruction * moveInst = new MoveInstruction(currentFunc, var, init_expr->val);
@@ -2355,18 +2363,18 @@ bool IRGenerator::ir_variable_declare(ast_node * node)
                 node->blockInsts.addInst(init_expr->blockInsts);
                 node->blockInsts.addInst(moveInst);
 
-                printf("DEBUG: 为局部变量 %s 生成了初始化指令\n", varName.c_str());
+                minic_log(LOG_DEBUG, "为局部变量 %s 生成了初始化指令", varName.c_str());
             }
         } else {
             // 全局变量初始化
             if (node->sons[2]->node_type == ast_operator_type::AST_OP_LEAF_LITERAL_UINT) {
                 uint32_t value = node->sons[2]->integer_val;
-                printf("DEBUG: 记录全局变量 %s 的初始值 %u\n", varName.c_str(), value);
+                minic_log(LOG_DEBUG, "记录全局变量 %s 的初始值 %u", varName.c_str(), value);
 
                 // 保存全局变量的初始值
                 globalVarInitValues[varName] = value;
             } else {
-                printf("DEBUG: 全局变量 %s 的初始化表达式太复杂，当前不支持\n", varName.c_str());
+                minic_log(LOG_DEBUG, "全局变量 %s 的初始化表达式太复杂，当前不支持", varName.c_str());
             }
         }
     } else if (currentFunc) {
@@ -2375,7 +2383,7 @@ bool IRGenerator::ir_variable_declare(ast_node * node)
             ConstInt * zeroVal = module->newConstInt(0);
             MoveInstruction * moveInst = new MoveInstruction(currentFunc, var, zeroVal);
             node->blockInsts.addInst(moveInst);
-            printf("DEBUG: 为局部变量 %s 生成了默认初始化为0的指令\n", varName.c_str());
+            minic_log(LOG_DEBUG, "为局部变量 %s 生成了默认初始化为0的指令", varName.c_str());
         }
     }
     node->val = var;
@@ -2395,7 +2403,7 @@ bool IRGenerator::ir_array_def(ast_node * node)
 
     // 获取数组名
     std::string arrayName = node->sons[0]->name;
-    printf("DEBUG: 处理数组定义: %s\n", arrayName.c_str());
+    minic_log(LOG_DEBUG, "处理数组定义: %s", arrayName.c_str());
 
     // 收集维度信息
     std::vector<int> dimensions;
@@ -2410,7 +2418,7 @@ bool IRGenerator::ir_array_def(ast_node * node)
                 return false;
             }
             dimensions.push_back(dimSize);
-            printf("DEBUG: 数组维度 %zu: %d\n", i, dimSize);
+            minic_log(LOG_DEBUG, "数组维度 %zu: %d", i, dimSize);
         } else {
             // 处理表达式作为维度大小
             ast_node * dimExpr = ir_visit_ast_node(node->sons[i]);
@@ -2427,7 +2435,7 @@ bool IRGenerator::ir_array_def(ast_node * node)
                     return false;
                 }
                 dimensions.push_back(dimSize);
-                printf("DEBUG: 数组维度 %zu: %d (从表达式)\n", i, dimSize);
+                minic_log(LOG_DEBUG, "数组维度 %zu: %d (从表达式)", i, dimSize);
             } else {
                 setLastError("数组维度必须是常量表达式");
                 return false;
@@ -2450,7 +2458,7 @@ bool IRGenerator::ir_array_def(ast_node * node)
 
     // 创建数组类型
     Type * elementType = IntegerType::getTypeInt(); // 假设元素类型是int
-    Type * arrayType = new ArrayType(elementType, dimensions);
+    Type * arrayType = ArrayType::get(elementType, dimensions);
 
     // 创建数组变量
     Function * currentFunc = module->getCurrentFunction();
@@ -2459,20 +2467,20 @@ bool IRGenerator::ir_array_def(ast_node * node)
     if (currentFunc) {
         // 局部数组变量
         arrayVar = module->newVarValue(arrayType, arrayName);
-        printf("DEBUG: 创建局部数组变量: %s\n", arrayName.c_str());
+        minic_log(LOG_DEBUG, "创建局部数组变量: %s", arrayName.c_str());
 
         // 处理数组初始化 (如果有)
         if (node->sons.size() > dimensions.size() + 1) {
             ast_node * initNode = node->sons.back();
             if (initNode) {
-                printf("DEBUG: 数组初始化暂不支持\n");
+                minic_log(LOG_DEBUG, "数组初始化暂不支持");
                 // 目前不处理数组初始化，这需要更复杂的实现
             }
         }
     } else {
         // 全局数组变量
         arrayVar = module->newVarValue(arrayType, arrayName);
-        printf("DEBUG: 创建全局数组变量: %s\n", arrayName.c_str());
+        minic_log(LOG_DEBUG, "创建全局数组变量: %s", arrayName.c_str());
 
         // 全局数组初始化同样暂不支持
     }
@@ -2509,7 +2517,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
 
     // 检查是否是函数参数（数组参数）
     if (isCurrentFunctionParameter(arrayName)) {
-        printf("DEBUG: 处理函数数组参数访问: %s\n", arrayName.c_str());
+        minic_log(LOG_DEBUG, "处理函数数组参数访问: %s", arrayName.c_str());
 
         // 🔧 关键修改：获取保存的维度信息
         std::string funcName = currentFunc->getName();
@@ -2529,15 +2537,15 @@ bool IRGenerator::ir_array_access(ast_node * node)
             // 使用保存的维度信息进行正确的偏移计算
             const std::vector<int> & dimensions = functionParameterDimensions[funcName][paramIndex];
 
-            printf("DEBUG: 使用保存的维度信息，维度数: %zu\n", dimensions.size());
+            minic_log(LOG_DEBUG, "使用保存的维度信息，维度数: %zu", dimensions.size());
             for (size_t i = 0; i < dimensions.size(); i++) {
-                printf("DEBUG: 维度 %zu: %d\n", i, dimensions[i]);
+                minic_log(LOG_DEBUG, "维度 %zu: %d", i, dimensions[i]);
             }
 
             return handleParameterArrayAccessWithDimensions(node, arrayVar, dimensions);
         } else {
             // 没有维度信息，按简单指针处理
-            printf("DEBUG: 没有找到维度信息，按简单指针处理\n");
+            minic_log(LOG_DEBUG, "没有找到维度信息，按简单指针处理");
             return handleSimplePointerParamAccess(node, arrayVar);
         }
     }
@@ -2559,7 +2567,7 @@ bool IRGenerator::ir_empty_stmt(ast_node * node)
 {
     // 空语句不需要生成任何实际代码
     // 只需要返回成功即可
-    printf("DEBUG: 处理空语句\n");
+    minic_log(LOG_DEBUG, "处理空语句");
     return true;
 }
 
@@ -2572,7 +2580,7 @@ bool IRGenerator::ir_function_formal_param_array(ast_node * node)
     // 这里不需要特殊处理，因为在ir_function_formal_params中已经处理了
     // 这个函数主要是为了防止ir_default被调用
 
-    printf("DEBUG: 处理数组形参节点: %s\n", node->sons.size() > 1 ? node->sons[1]->name.c_str() : "未知");
+    minic_log(LOG_DEBUG, "处理数组形参节点: %s", node->sons.size() > 1 ? node->sons[1]->name.c_str() : "未知");
 
     return true;
 }
@@ -2642,7 +2650,7 @@ Value * IRGenerator::calculateLinearOffset(ast_node * node, InterCode & blockIns
 
     // 如果所有索引都是0，直接返回0，避免复杂计算
     if (allZeros) {
-        printf("DEBUG: 所有索引都是0，返回常量0\n");
+        minic_log(LOG_DEBUG, "所有索引都是0，返回常量0");
         return module->newConstInt(0);
     }
 
@@ -2669,7 +2677,7 @@ Value * IRGenerator::calculateLinearOffset(ast_node * node, InterCode & blockIns
     // 获取数组维度信息
     ArrayType * arrayType = dynamic_cast<ArrayType *>(arrayVar->getType());
     if (!arrayType) {
-        printf("DEBUG: 数组参数无法获取维度信息，使用简化计算\n");
+        minic_log(LOG_DEBUG, "数组参数无法获取维度信息，使用简化计算");
         return module->newConstInt(0);
     }
 
@@ -2835,7 +2843,7 @@ Value * IRGenerator::calculateArrayAccessOffset(ast_node * arrayAccessNode, Inte
     ArrayType * arrayType = dynamic_cast<ArrayType *>(arrayVar->getType());
     if (!arrayType) {
         // 如果无法获取维度信息，使用简化计算
-        printf("DEBUG: 无法获取数组维度信息，使用简化偏移计算\n");
+        minic_log(LOG_DEBUG, "无法获取数组维度信息，使用简化偏移计算");
 
         // 只处理第一个索引
         ast_node * indexNode = ir_visit_ast_node(arrayAccessNode->sons[1]);
@@ -2951,7 +2959,7 @@ bool IRGenerator::handleSimplePointerParamAccess(ast_node * node, Value * arrayV
     node->arrayPtr = elemPtr;
     node->val = elemValue;
 
-    printf("DEBUG: 完成简单指针参数访问\n");
+    minic_log(LOG_DEBUG, "完成简单指针参数访问");
     return true;
 }
 
@@ -3037,7 +3045,7 @@ bool IRGenerator::handleMultiDimArrayParamAccess(ast_node * node, Value * arrayV
     node->arrayPtr = elemPtr;
     node->val = elemValue;
 
-    printf("DEBUG: 完成多维数组参数访问\n");
+    minic_log(LOG_DEBUG, "完成多维数组参数访问");
     return true;
 }
 
@@ -3134,7 +3142,7 @@ bool IRGenerator::handleRegularArrayAccess(ast_node * node, Value * arrayVar, co
         node->arrayPtr = ptrResult; // 用于赋值操作
         node->val = elemValue;      // 对于表达式，返回元素的值而不是指针
 
-        printf("DEBUG: 完成二维数组访问，读取了元素值: %s\n", elemValue->getIRName().c_str());
+        minic_log(LOG_DEBUG, "完成二维数组访问，读取了元素值: %s", elemValue->getIRName().c_str());
     } else {
         // 处理一般维度的数组 - 使用标准的多维数组展开公式
         Value * linearOffset = module->newConstInt(0);
@@ -3213,7 +3221,7 @@ bool IRGenerator::handleRegularArrayAccess(ast_node * node, Value * arrayVar, co
         node->arrayPtr = elemPtr; // 用于赋值操作
         node->val = elemValue;    // 对于表达式，返回元素的值而不是指针
 
-        printf("DEBUG: 完成多维数组访问，读取了元素值: %s\n", elemValue->getIRName().c_str());
+        minic_log(LOG_DEBUG, "完成多维数组访问，读取了元素值: %s", elemValue->getIRName().c_str());
     }
 
     return true;
@@ -3252,7 +3260,7 @@ bool IRGenerator::handleParameterArrayAccessWithDimensions(ast_node * node,
             stride *= dimensions[j];
         }
 
-        printf("DEBUG: 维度 %zu, 步长: %d\n", i, stride);
+        minic_log(LOG_DEBUG, "维度 %zu, 步长: %d", i, stride);
 
         if (stride == 1) {
             indexContribution = indices[i];
@@ -3305,6 +3313,6 @@ bool IRGenerator::handleParameterArrayAccessWithDimensions(ast_node * node,
     node->arrayPtr = elemPtr;
     node->val = elemValue;
 
-    printf("DEBUG: 完成使用维度信息的数组参数访问\n");
+    minic_log(LOG_DEBUG, "完成使用维度信息的数组参数访问");
     return true;
 }
\ No newline at end of file
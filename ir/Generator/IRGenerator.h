@@ -17,6 +17,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <unordered_set>
 #include <map>
 #include <vector>
 #include <string>
@@ -48,6 +49,13 @@ public:
         return lastError;
     }
 
+    /// @brief 设置复用增量编译缓存汇编的函数，这些函数只注册原型，不翻译函数体
+    /// @param functions 函数名
+    void setReusedFunctions(const std::unordered_set<std::string> * functions)
+    {
+        reusedFunctions = functions;
+    }
+
 protected:
     /// @brief 编译单元AST节点翻译成线性中间IR
     /// @param node AST节点
@@ -270,4 +278,7 @@ private:
     std::unordered_map<std::string, int> globalVarInitValues;
     // 保存函数参数的原始维度信息-lxg
     std::map<std::string, std::map<int, std::vector<int>>> functionParameterDimensions;
+
+    /// @brief 复用增量编译缓存汇编的函数，为空时翻译所有的函数
+    const std::unordered_set<std::string> * reusedFunctions = nullptr;
 };
@@ -13,6 +13,8 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <algorithm>
+
 #include "IRCode.h"
 
 /// @brief 析构函数
@@ -63,3 +65,26 @@ void InterCode::Delete()
 
     code.clear();
 }
+
+/// @brief 删除所有被标记为Dead的指令，并释放其资源
+/// @return 删除的指令条数
+int32_t InterCode::removeDeadInsts()
+{
+    std::vector<Instruction *> deadInsts;
+
+    // 保持剩余指令的相对次序
+    auto pEnd = std::stable_partition(code.begin(), code.end(), [](Instruction * inst) { return !inst->isDead(); });
+    deadInsts.assign(pEnd, code.end());
+    code.erase(pEnd, code.end());
+
+    // 与Delete一样，先清除全部操作数后再释放，避免Dead指令之间相互引用时访问已释放的指令
+    for (auto inst: deadInsts) {
+        inst->clearOperands();
+    }
+
+    for (auto inst: deadInsts) {
+        delete inst;
+    }
+
+    return (int32_t) deadInsts.size();
+}
@@ -48,4 +48,8 @@ public:
 
     /// @brief 删除所有指令
     void Delete();
+
+    /// @brief 删除所有被标记为Dead的指令，并释放其资源
+    /// @return 删除的指令条数
+    int32_t removeDeadInsts();
 };
@@ -16,6 +16,7 @@
 #include <string>
 
 #include "Instruction.h"
+#include "CompileReport.h"
 #include "Function.h"
 
 /// @brief 构造函数
@@ -24,7 +25,9 @@
 /// @param srcVal1
 /// @param srcVal2
 Instruction::Instruction(Function * _func, IRInstOperator _op, Type * _type) : User(_type), op(_op), func(_func)
-{}
+{
+    countObject(CountedObject::INSTRUCTION);
+}
 
 /// @brief 获取指令操作码
 /// @return 指令操作码
@@ -34,6 +34,11 @@ public:
     ///
     Function * calledFunction = nullptr;
 
+    ///
+    /// @brief 后端是否已按调用约定调整过该调用：实参已传送到传递位置，返回值已从返回寄存器传送到结果
+    ///
+    bool lowered = false;
+
 public:
     /// @brief 含有参数的函数调用
     /// @param srcVal 函数的实参Value
@@ -16,6 +16,7 @@
 ///
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include "Instruction.h"
@@ -55,6 +56,23 @@ public:
     ///
     [[nodiscard]] LabelInstruction * getTarget() const;
 
+    ///
+    /// @brief 设置条件跳转走真分支的次数，来自--profile-use的剖析数据
+    /// @param count 次数
+    ///
+    void setTakenCount(uint64_t count)
+    {
+        takenCount = count;
+    }
+
+    ///
+    /// @brief 获取条件跳转走真分支的次数，没有剖析数据时为0
+    /// @return uint64_t 次数
+    ///
+    [[nodiscard]] uint64_t getTakenCount() const
+    {
+        return takenCount;
+    }
 
 private:
     ///
@@ -71,4 +89,9 @@ private:
     /// @brief 是否是条件分支
     ///
     bool isConditional = false;
+
+    ///
+    /// @brief 条件跳转走真分支的次数
+    ///
+    uint64_t takenCount = 0;
 };
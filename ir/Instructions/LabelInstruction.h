@@ -16,6 +16,7 @@
 ///
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include "Instruction.h"
@@ -39,4 +40,28 @@ public:
     /// @param str 返回指令字符串
     ///
     void toString(std::string & str) override;
+
+    ///
+    /// @brief 设置以该Label开始的基本块的执行次数，来自--profile-use的剖析数据
+    /// @param count 执行次数
+    ///
+    void setProfileCount(uint64_t count)
+    {
+        profileCount = count;
+    }
+
+    ///
+    /// @brief 获取以该Label开始的基本块的执行次数，没有剖析数据时为0
+    /// @return uint64_t 执行次数
+    ///
+    [[nodiscard]] uint64_t getProfileCount() const
+    {
+        return profileCount;
+    }
+
+private:
+    ///
+    /// @brief 基本块的执行次数
+    ///
+    uint64_t profileCount = 0;
 };
@@ -0,0 +1,603 @@
+///
+/// @file IRInterpreter.cpp
+/// @brief 线性IR的解释执行，并统计函数与指令的动态执行次数
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+
+#include <algorithm>
+#include <climits>
+
+#include "Function.h"
+#include "PointerType.h"
+#include "ConstInt.h"
+#include "GlobalVariable.h"
+#include "LocalVariable.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "MoveInstruction.h"
+#include "IRInterpreter.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+///
+/// @brief 变量占用的字节数，数组为各维度之积乘以4，其它均为4字节
+/// @param type 类型
+/// @return int64_t 字节数
+///
+static int64_t getStorageSize(Type * type)
+{
+    if (!type->isArrayType()) {
+        return 4;
+    }
+
+    int64_t size = 4;
+    for (int dim: static_cast<ArrayType *>(type)->getDimensions()) {
+        size *= dim;
+    }
+
+    return size;
+}
+
+///
+/// @brief 构造函数
+/// @param _module 要执行的模块
+/// @param _in 内置函数getint等的输入
+/// @param _out 内置函数putint等的输出
+///
+IRInterpreter::IRInterpreter(Module * _module, FILE * _in, FILE * _out) : module(_module), in(_in), out(_out)
+{}
+
+///
+/// @brief 记录运行时错误
+/// @param msg 错误信息
+/// @return false 便于直接return
+///
+bool IRInterpreter::fail(const std::string & msg)
+{
+    // 保留最内层的错误
+    if (lastError.empty()) {
+        lastError = msg;
+    }
+
+    return false;
+}
+
+///
+/// @brief 在内存末尾分配空间，初值为0
+/// @param bytes 字节数
+/// @return int32_t 起始地址
+///
+int32_t IRInterpreter::alloc(int32_t bytes)
+{
+    auto addr = (int32_t) (memory.size() * 4);
+
+    memory.resize(memory.size() + (size_t) (bytes + 3) / 4, 0);
+
+    return addr;
+}
+
+///
+/// @brief 按字节地址读内存
+/// @param addr 地址
+/// @param value 值
+/// @return true 成功
+/// @return false 地址越界或者未对齐
+///
+bool IRInterpreter::load(int32_t addr, int32_t & value)
+{
+    if ((addr <= 0) || (addr % 4) || ((size_t) addr / 4 >= memory.size())) {
+        return fail("非法的内存读地址" + std::to_string(addr));
+    }
+
+    value = memory[(size_t) addr / 4];
+
+    return true;
+}
+
+///
+/// @brief 按字节地址写内存
+/// @param addr 地址
+/// @param value 值
+/// @return true 成功
+/// @return false 地址越界或者未对齐
+///
+bool IRInterpreter::store(int32_t addr, int32_t value)
+{
+    if ((addr <= 0) || (addr % 4) || ((size_t) addr / 4 >= memory.size())) {
+        return fail("非法的内存写地址" + std::to_string(addr));
+    }
+
+    memory[(size_t) addr / 4] = value;
+
+    return true;
+}
+
+///
+/// @brief 分配全局变量
+///
+void IRInterpreter::allocGlobals()
+{
+    // 0地址保留作为空指针
+    memory.assign(1, 0);
+
+    for (auto var: module->getGlobalVariables()) {
+        globalAddr[var] = alloc((int32_t) getStorageSize(var->getType()));
+    }
+}
+
+///
+/// @brief 获取函数预处理后的信息，第一次使用时建立
+/// @param func 函数
+/// @return FunctionInfo&
+///
+IRInterpreter::FunctionInfo & IRInterpreter::getInfo(Function * func)
+{
+    auto pIter = infos.find(func);
+    if (pIter != infos.end()) {
+        return pIter->second;
+    }
+
+    FunctionInfo & info = infos[func];
+
+    auto slotNum = (int32_t) 0;
+    for (auto param: func->getParams()) {
+        info.slots[param] = slotNum++;
+    }
+
+    for (auto var: func->getVarValues()) {
+        info.slots[var] = slotNum++;
+
+        if (var->getType()->isArrayType()) {
+            info.arrays.emplace_back(var, (int32_t) getStorageSize(var->getType()));
+        }
+    }
+
+    auto & insts = func->getInterCode().getInsts();
+    for (size_t k = 0; k < insts.size(); ++k) {
+        Instruction * inst = insts[k];
+
+        if (inst->hasResultValue()) {
+            info.slots[inst] = slotNum++;
+        }
+
+        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            info.labelPos[inst] = k;
+        }
+    }
+
+    info.profile.instCounts.assign(insts.size(), 0);
+
+    return info;
+}
+
+///
+/// @brief 获取函数的执行统计，没有执行过的函数返回空指针
+/// @param func 函数
+/// @return const FunctionProfile*
+///
+const IRInterpreter::FunctionProfile * IRInterpreter::getProfile(Function * func) const
+{
+    auto pIter = infos.find(func);
+    if (pIter == infos.end()) {
+        return nullptr;
+    }
+
+    return &pIter->second.profile;
+}
+
+///
+/// @brief 读取执行结束后标量全局变量的值，如插桩的计数器
+/// @param var 全局变量
+/// @param value 值
+/// @return true 成功
+/// @return false 变量没有分配或者是数组
+///
+bool IRInterpreter::readGlobal(GlobalVariable * var, int32_t & value)
+{
+    auto gIter = globalAddr.find(var);
+    if ((gIter == globalAddr.end()) || var->getType()->isArrayType()) {
+        return false;
+    }
+
+    return load(gIter->second, value);
+}
+
+///
+/// @brief 读取操作数的值，数组类型的变量得到其地址
+/// @param val 操作数
+/// @param slots 当前栈帧
+/// @param info 当前函数信息
+/// @param result 值
+/// @return true 成功
+///
+bool IRInterpreter::readValue(Value * val, std::vector<int32_t> & slots, FunctionInfo & info, int32_t & result)
+{
+    if (Instanceof(constVal, ConstInt *, val)) {
+        result = constVal->getVal();
+        return true;
+    }
+
+    auto pIter = info.slots.find(val);
+    if (pIter != info.slots.end()) {
+        result = slots[pIter->second];
+        return true;
+    }
+
+    auto gIter = globalAddr.find(val);
+    if (gIter != globalAddr.end()) {
+
+        // 全局数组的值为其地址，标量需要读内存
+        if (val->getType()->isArrayType()) {
+            result = gIter->second;
+            return true;
+        }
+
+        return load(gIter->second, result);
+    }
+
+    return fail("无法读取的操作数" + val->getIRName());
+}
+
+///
+/// @brief 写入变量或者指令结果
+/// @param val 变量或指令
+/// @param slots 当前栈帧
+/// @param info 当前函数信息
+/// @param value 值
+/// @return true 成功
+///
+bool IRInterpreter::writeValue(Value * val, std::vector<int32_t> & slots, FunctionInfo & info, int32_t value)
+{
+    auto pIter = info.slots.find(val);
+    if (pIter != info.slots.end()) {
+        slots[pIter->second] = value;
+        return true;
+    }
+
+    auto gIter = globalAddr.find(val);
+    if ((gIter != globalAddr.end()) && !val->getType()->isArrayType()) {
+        return store(gIter->second, value);
+    }
+
+    return fail("无法写入的操作数" + val->getIRName());
+}
+
+///
+/// @brief 从main函数开始执行
+/// @param exitCode main函数的返回值
+/// @return true 成功
+/// @return false 运行时错误，错误信息通过getLastError获取
+///
+bool IRInterpreter::run(int32_t & exitCode)
+{
+    lastError.clear();
+    infos.clear();
+    totalInsts = 0;
+    callDepth = 0;
+
+    Function * mainFunc = module->findFunction("main");
+    if (!mainFunc || mainFunc->isBuiltin()) {
+        return fail("没有找到main函数");
+    }
+
+    allocGlobals();
+
+    bool result = callFunction(mainFunc, {}, exitCode);
+
+    fflush(out);
+
+    return result;
+}
+
+///
+/// @brief 执行内置函数
+/// @param func 内置函数
+/// @param args 实参值
+/// @param retVal 返回值
+/// @return true 成功
+///
+bool IRInterpreter::callBuiltin(Function * func, const std::vector<int32_t> & args, int32_t & retVal)
+{
+    const std::string & name = func->getName();
+    retVal = 0;
+
+    if ((name == "putint") && (args.size() == 1)) {
+        fprintf(out, "%d", args[0]);
+    } else if ((name == "putch") && (args.size() == 1)) {
+        fputc(args[0], out);
+    } else if ((name == "getint") && args.empty()) {
+        if (fscanf(in, "%d", &retVal) != 1) {
+            retVal = 0;
+        }
+    } else if ((name == "getch") && args.empty()) {
+        retVal = fgetc(in);
+    } else if ((name == "getarray") && (args.size() == 1)) {
+        // 先读入个数，再依次读入元素，返回个数
+        if (fscanf(in, "%d", &retVal) != 1) {
+            retVal = 0;
+        }
+        for (int32_t k = 0; k < retVal; ++k) {
+            int32_t value = 0;
+            if ((fscanf(in, "%d", &value) != 1) || !store(args[0] + k * 4, value)) {
+                return fail("getarray读入失败");
+            }
+        }
+    } else if ((name == "putarray") && (args.size() == 2)) {
+        fprintf(out, "%d:", args[0]);
+        for (int32_t k = 0; k < args[0]; ++k) {
+            int32_t value;
+            if (!load(args[1] + k * 4, value)) {
+                return false;
+            }
+            fprintf(out, " %d", value);
+        }
+        fputc('\n', out);
+    } else {
+        return fail("解释器不支持内置函数" + name);
+    }
+
+    return true;
+}
+
+///
+/// @brief 执行函数
+/// @param func 函数
+/// @param args 实参值
+/// @param retVal 返回值
+/// @return true 成功
+///
+bool IRInterpreter::callFunction(Function * func, const std::vector<int32_t> & args, int32_t & retVal)
+{
+    if (func->isBuiltin()) {
+        return callBuiltin(func, args, retVal);
+    }
+
+    if (args.size() != func->getParams().size()) {
+        return fail("调用函数" + func->getName() + "的实参个数与形参个数不一致");
+    }
+
+    if (callDepth >= maxCallDepth) {
+        return fail("函数调用深度超过" + std::to_string(maxCallDepth));
+    }
+
+    FunctionInfo & info = getInfo(func);
+    FunctionProfile & profile = info.profile;
+    profile.calls++;
+
+    // 建立栈帧，形参位于最前面的槽位
+    std::vector<int32_t> slots(info.slots.size(), 0);
+    std::copy(args.begin(), args.end(), slots.begin());
+
+    size_t stackTop = memory.size();
+    for (auto & array: info.arrays) {
+        slots[info.slots[array.first]] = alloc(array.second);
+    }
+
+    callDepth++;
+
+    auto & insts = func->getInterCode().getInsts();
+    std::vector<int32_t> callArgs;
+    bool ok = true;
+    bool finished = false;
+    size_t pc = 0;
+
+    while (ok && !finished && (pc < insts.size())) {
+
+        Instruction * inst = insts[pc];
+        IRInstOperator op = inst->getOp();
+
+        // 与后端一致，跳过标记为死的指令
+        if (inst->isDead() || (op == IRInstOperator::IRINST_OP_LABEL)) {
+            pc++;
+            continue;
+        }
+
+        profile.instCounts[pc]++;
+        profile.insts++;
+        totalInsts++;
+
+        size_t next = pc + 1;
+        int32_t a = 0, b = 0;
+
+        switch (op) {
+            case IRInstOperator::IRINST_OP_ENTRY:
+            case IRInstOperator::IRINST_OP_ARG:
+                // 实参由函数调用指令的操作数给出
+                break;
+            case IRInstOperator::IRINST_OP_EXIT:
+                retVal = 0;
+                if (inst->getOperandsNum() == 1) {
+                    ok = readValue(inst->getOperand(0), slots, info, retVal);
+                }
+                finished = true;
+                break;
+            case IRInstOperator::IRINST_OP_GOTO: {
+                auto gotoInst = static_cast<GotoInstruction *>(inst);
+                Instruction * target = gotoInst->getTarget();
+                if (inst->getOperandsNum() == 1) {
+                    ok = readValue(inst->getOperand(0), slots, info, a);
+                    if (!a) {
+                        target = gotoInst->getFalseTarget();
+                    }
+                }
+                auto pIter = info.labelPos.find(target);
+                if (pIter == info.labelPos.end()) {
+                    ok = fail("函数" + func->getName() + "中跳转目标Label不存在");
+                    break;
+                }
+                next = pIter->second;
+                break;
+            }
+            case IRInstOperator::IRINST_OP_ASSIGN: {
+                auto moveInst = static_cast<MoveInstruction *>(inst);
+                ok = readValue(inst->getOperand(1), slots, info, b);
+                if (ok && moveInst->getIsPointerLoad()) {
+                    ok = load(b, b);
+                }
+                if (ok && moveInst->getIsPointerStore()) {
+                    ok = readValue(inst->getOperand(0), slots, info, a) && store(a, b);
+                } else if (ok) {
+                    ok = writeValue(inst->getOperand(0), slots, info, b);
+                }
+                break;
+            }
+            case IRInstOperator::IRINST_OP_NEG_I:
+                ok = readValue(inst->getOperand(0), slots, info, a);
+                slots[info.slots[inst]] = (int32_t) (0u - (uint32_t) a);
+                break;
+            case IRInstOperator::IRINST_OP_ADD_I:
+            case IRInstOperator::IRINST_OP_SUB_I:
+            case IRInstOperator::IRINST_OP_MUL_I:
+            case IRInstOperator::IRINST_OP_DIV_I:
+            case IRInstOperator::IRINST_OP_MOD_I:
+            case IRInstOperator::IRINST_OP_LT_I:
+            case IRInstOperator::IRINST_OP_GT_I:
+            case IRInstOperator::IRINST_OP_LE_I:
+            case IRInstOperator::IRINST_OP_GE_I:
+            case IRInstOperator::IRINST_OP_EQ_I:
+            case IRInstOperator::IRINST_OP_NE_I: {
+                ok = readValue(inst->getOperand(0), slots, info, a) && readValue(inst->getOperand(1), slots, info, b);
+                if (!ok) {
+                    break;
+                }
+
+                // 加减乘按32位补码回绕
+                int32_t r = 0;
+                switch (op) {
+                    case IRInstOperator::IRINST_OP_ADD_I:
+                        r = (int32_t) ((uint32_t) a + (uint32_t) b);
+                        break;
+                    case IRInstOperator::IRINST_OP_SUB_I:
+                        r = (int32_t) ((uint32_t) a - (uint32_t) b);
+                        break;
+                    case IRInstOperator::IRINST_OP_MUL_I:
+                        r = (int32_t) ((uint32_t) a * (uint32_t) b);
+                        break;
+                    case IRInstOperator::IRINST_OP_DIV_I:
+                    case IRInstOperator::IRINST_OP_MOD_I:
+                        if (b == 0) {
+                            ok = fail("函数" + func->getName() + "中除数为0");
+                        } else if ((a == INT32_MIN) && (b == -1)) {
+                            // 与ARM的sdiv一致，商回绕为INT32_MIN
+                            r = (op == IRInstOperator::IRINST_OP_DIV_I) ? INT32_MIN : 0;
+                        } else {
+                            r = (op == IRInstOperator::IRINST_OP_DIV_I) ? a / b : a % b;
+                        }
+                        break;
+                    case IRInstOperator::IRINST_OP_LT_I:
+                        r = a < b;
+                        break;
+                    case IRInstOperator::IRINST_OP_GT_I:
+                        r = a > b;
+                        break;
+                    case IRInstOperator::IRINST_OP_LE_I:
+                        r = a <= b;
+                        break;
+                    case IRInstOperator::IRINST_OP_GE_I:
+                        r = a >= b;
+                        break;
+                    case IRInstOperator::IRINST_OP_EQ_I:
+                        r = a == b;
+                        break;
+                    default:
+                        r = a != b;
+                        break;
+                }
+
+                slots[info.slots[inst]] = r;
+                break;
+            }
+            case IRInstOperator::IRINST_OP_FUNC_CALL: {
+                auto callInst = static_cast<FuncCallInstruction *>(inst);
+
+                callArgs.clear();
+                for (int32_t k = 0; ok && (k < inst->getOperandsNum()); ++k) {
+                    ok = readValue(inst->getOperand(k), slots, info, a);
+                    callArgs.push_back(a);
+                }
+
+                int32_t result = 0;
+                ok = ok && callFunction(callInst->calledFunction, callArgs, result);
+                if (ok && inst->hasResultValue()) {
+                    slots[info.slots[inst]] = result;
+                }
+                break;
+            }
+            default:
+                ok = fail("解释器不支持的指令");
+                break;
+        }
+
+        pc = next;
+    }
+
+    callDepth--;
+
+    // 释放局部数组
+    memory.resize(stackTop);
+
+    if (ok && !finished) {
+        return fail("函数" + func->getName() + "没有执行exit指令");
+    }
+
+    return ok;
+}
+
+///
+/// @brief 输出执行统计，指令需事先通过renameIR命名
+/// @param fp 输出文件
+///
+void IRInterpreter::printProfile(FILE * fp)
+{
+    fprintf(fp, "===---------------------------------------------------------===\n");
+    fprintf(fp, "                  IR interpreter execution profile\n");
+    fprintf(fp, "===---------------------------------------------------------===\n");
+    fprintf(fp, "  Total dynamic instructions: %llu\n\n", (unsigned long long) totalInsts);
+    fprintf(fp, "  %-24s %12s %16s\n", "Function", "Calls", "Instructions");
+
+    for (auto func: module->getFunctionList()) {
+        const FunctionProfile * profile = getProfile(func);
+        if (profile) {
+            fprintf(fp,
+                    "  %-24s %12llu %16llu\n",
+                    func->getName().c_str(),
+                    (unsigned long long) profile->calls,
+                    (unsigned long long) profile->insts);
+        }
+    }
+
+    // 每条指令的执行次数，按源程序的指令次序
+    for (auto func: module->getFunctionList()) {
+        const FunctionProfile * profile = getProfile(func);
+        if (!profile) {
+            continue;
+        }
+
+        fprintf(fp, "\n  define %s\n", func->getName().c_str());
+
+        auto & insts = func->getInterCode().getInsts();
+        for (size_t k = 0; k < insts.size(); ++k) {
+
+            std::string str;
+            insts[k]->toString(str);
+            if (str.empty() || insts[k]->isDead()) {
+                continue;
+            }
+
+            if (insts[k]->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+                fprintf(fp, "  %12s  %s\n", "", str.c_str());
+            } else {
+                fprintf(fp, "  %12llu  \t%s\n", (unsigned long long) profile->instCounts[k], str.c_str());
+            }
+        }
+    }
+}
@@ -0,0 +1,242 @@
+///
+/// @file IRInterpreter.h
+/// @brief 线性IR的解释执行，并统计函数与指令的动态执行次数
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Module.h"
+
+///
+/// @brief 线性IR解释器。
+/// 内存按字节编址，以4字节为单元存放，0地址保留作为空指针；
+/// 全局变量在启动时分配，局部数组在函数调用时在栈上分配，返回时释放；
+/// 标量的局部变量、形参与指令结果保存在函数栈帧的槽位中。
+///
+class IRInterpreter {
+
+public:
+    ///
+    /// @brief 单个函数的执行统计
+    ///
+    struct FunctionProfile {
+
+        /// @brief 被调用次数
+        uint64_t calls = 0;
+
+        /// @brief 执行的指令条数，不含Label
+        uint64_t insts = 0;
+
+        /// @brief 每条指令的执行次数，与函数的指令序列一一对应
+        std::vector<uint64_t> instCounts;
+    };
+
+    ///
+    /// @brief 构造函数
+    /// @param _module 要执行的模块
+    /// @param _in 内置函数getint等的输入
+    /// @param _out 内置函数putint等的输出
+    ///
+    IRInterpreter(Module * _module, FILE * _in = stdin, FILE * _out = stdout);
+
+    ///
+    /// @brief 从main函数开始执行
+    /// @param exitCode main函数的返回值
+    /// @return true 成功
+    /// @return false 运行时错误，错误信息通过getLastError获取
+    ///
+    bool run(int32_t & exitCode);
+
+    ///
+    /// @brief 获取执行的指令总条数
+    /// @return uint64_t 指令条数
+    ///
+    uint64_t getTotalInsts() const
+    {
+        return totalInsts;
+    }
+
+    ///
+    /// @brief 获取函数的执行统计，没有执行过的函数返回空指针
+    /// @param func 函数
+    /// @return const FunctionProfile*
+    ///
+    const FunctionProfile * getProfile(Function * func) const;
+
+    ///
+    /// @brief 输出执行统计，指令需事先通过renameIR命名
+    /// @param fp 输出文件
+    ///
+    void printProfile(FILE * fp);
+
+    ///
+    /// @brief 读取执行结束后标量全局变量的值，如插桩的计数器
+    /// @param var 全局变量
+    /// @param value 值
+    /// @return true 成功
+    /// @return false 变量没有分配或者是数组
+    ///
+    bool readGlobal(GlobalVariable * var, int32_t & value);
+
+    ///
+    /// @brief 设置调用的最大深度，超过时报错，避免宿主栈溢出
+    /// @param depth 深度
+    ///
+    void setMaxCallDepth(int32_t depth)
+    {
+        maxCallDepth = depth;
+    }
+
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    ///
+    /// @brief 函数预处理后的信息
+    ///
+    struct FunctionInfo {
+
+        /// @brief 形参、标量局部变量、有结果的指令到栈帧槽位的映射
+        std::unordered_map<Value *, int32_t> slots;
+
+        /// @brief Label指令在指令序列中的位置
+        std::unordered_map<Instruction *, size_t> labelPos;
+
+        /// @brief 局部数组及其所需的字节数，调用时分配，地址保存在对应的槽位中
+        std::vector<std::pair<Value *, int32_t>> arrays;
+
+        /// @brief 执行统计
+        FunctionProfile profile;
+    };
+
+    ///
+    /// @brief 获取函数预处理后的信息，第一次使用时建立
+    /// @param func 函数
+    /// @return FunctionInfo&
+    ///
+    FunctionInfo & getInfo(Function * func);
+
+    ///
+    /// @brief 分配全局变量
+    ///
+    void allocGlobals();
+
+    ///
+    /// @brief 执行函数
+    /// @param func 函数
+    /// @param args 实参值
+    /// @param retVal 返回值
+    /// @return true 成功
+    ///
+    bool callFunction(Function * func, const std::vector<int32_t> & args, int32_t & retVal);
+
+    ///
+    /// @brief 执行内置函数
+    /// @param func 内置函数
+    /// @param args 实参值
+    /// @param retVal 返回值
+    /// @return true 成功
+    ///
+    bool callBuiltin(Function * func, const std::vector<int32_t> & args, int32_t & retVal);
+
+    ///
+    /// @brief 读取操作数的值，数组类型的变量得到其地址
+    /// @param val 操作数
+    /// @param slots 当前栈帧
+    /// @param info 当前函数信息
+    /// @param result 值
+    /// @return true 成功
+    ///
+    bool readValue(Value * val, std::vector<int32_t> & slots, FunctionInfo & info, int32_t & result);
+
+    ///
+    /// @brief 写入变量或者指令结果
+    /// @param val 变量或指令
+    /// @param slots 当前栈帧
+    /// @param info 当前函数信息
+    /// @param value 值
+    /// @return true 成功
+    ///
+    bool writeValue(Value * val, std::vector<int32_t> & slots, FunctionInfo & info, int32_t value);
+
+    ///
+    /// @brief 按字节地址读内存
+    /// @param addr 地址
+    /// @param value 值
+    /// @return true 成功
+    /// @return false 地址越界或者未对齐
+    ///
+    bool load(int32_t addr, int32_t & value);
+
+    ///
+    /// @brief 按字节地址写内存
+    /// @param addr 地址
+    /// @param value 值
+    /// @return true 成功
+    /// @return false 地址越界或者未对齐
+    ///
+    bool store(int32_t addr, int32_t value);
+
+    ///
+    /// @brief 在内存末尾分配空间，初值为0
+    /// @param bytes 字节数
+    /// @return int32_t 起始地址
+    ///
+    int32_t alloc(int32_t bytes);
+
+    ///
+    /// @brief 记录运行时错误
+    /// @param msg 错误信息
+    /// @return false 便于直接return
+    ///
+    bool fail(const std::string & msg);
+
+    ///
+    /// @brief 要执行的模块
+    ///
+    Module * module;
+
+    /// @brief 内置函数的输入
+    FILE * in;
+
+    /// @brief 内置函数的输出
+    FILE * out;
+
+    /// @brief 内存，每个元素4字节
+    std::vector<int32_t> memory;
+
+    /// @brief 全局变量的地址
+    std::unordered_map<Value *, int32_t> globalAddr;
+
+    /// @brief 函数预处理后的信息
+    std::unordered_map<Function *, FunctionInfo> infos;
+
+    /// @brief 当前调用深度
+    int32_t callDepth = 0;
+
+    /// @brief 调用的最大深度
+    int32_t maxCallDepth = 4000;
+
+    /// @brief 执行的指令总条数
+    uint64_t totalInsts = 0;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
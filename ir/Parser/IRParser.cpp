@@ -0,0 +1,919 @@
+///
+/// @file IRParser.cpp
+/// @brief 文本形式的线性IR(DragonIR)解析，重建Module
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+#include "Common.h"
+#include "IRConstant.h"
+#include "Function.h"
+#include "IntegerType.h"
+#include "VoidType.h"
+#include "PointerType.h"
+#include "FormalParam.h"
+#include "LocalVariable.h"
+#include "BinaryInstruction.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+#include "MoveInstruction.h"
+#include "IRParser.h"
+
+///
+/// @brief 去除首尾的空白字符，含制表符与回车
+/// @param str 字符串
+/// @return std::string 去除后的字符串
+///
+static std::string strip(const std::string & str)
+{
+    const char * blanks = " \t\r\n";
+
+    size_t begin = str.find_first_not_of(blanks);
+    if (begin == std::string::npos) {
+        return "";
+    }
+
+    return str.substr(begin, str.find_last_not_of(blanks) - begin + 1);
+}
+
+///
+/// @brief 判断字符串是否以指定前缀开始
+/// @param str 字符串
+/// @param prefix 前缀
+/// @return true 是
+///
+static bool startsWith(const std::string & str, const std::string & prefix)
+{
+    return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+///
+/// @brief 去除行尾;开始的注释以及首尾空白
+/// @param line 行
+/// @return std::string 去除注释后的内容
+///
+static std::string stripComment(const std::string & line)
+{
+    return strip(line.substr(0, line.find(';')));
+}
+
+///
+/// @brief 按分隔符拆分，并去除每一项的首尾空白，空串返回空列表
+/// @param str 字符串
+/// @param sep 分隔符
+/// @return std::vector<std::string>
+///
+static std::vector<std::string> split(const std::string & str, char sep)
+{
+    std::vector<std::string> items;
+
+    if (strip(str).empty()) {
+        return items;
+    }
+
+    std::stringstream ss(str);
+    std::string item;
+    while (std::getline(ss, item, sep)) {
+        items.push_back(strip(item));
+    }
+
+    return items;
+}
+
+///
+/// @brief 拆分出第一个空白分隔的单词
+/// @param str 字符串
+/// @param rest 剩余部分，已去除首尾空白
+/// @return std::string 第一个单词
+///
+static std::string firstWord(const std::string & str, std::string & rest)
+{
+    std::string s = strip(str);
+
+    size_t pos = s.find_first_of(" \t");
+    if (pos == std::string::npos) {
+        rest.clear();
+        return s;
+    }
+
+    rest = strip(s.substr(pos));
+
+    return s.substr(0, pos);
+}
+
+///
+/// @brief 拆分变量名后的数组维度，如@a[10][20]
+/// @param str 带维度的名字
+/// @param name 不含维度的名字
+/// @param dims 维度
+/// @return true 成功
+/// @return false 维度格式错误
+///
+static bool splitDimensions(const std::string & str, std::string & name, std::vector<int> & dims)
+{
+    size_t pos = str.find('[');
+    name = strip(str.substr(0, pos));
+
+    while (pos != std::string::npos) {
+
+        size_t end = str.find(']', pos);
+        if (end == std::string::npos) {
+            return false;
+        }
+
+        std::string num = str.substr(pos + 1, end - pos - 1);
+        char * endPtr = nullptr;
+        long dim = std::strtol(num.c_str(), &endPtr, 10);
+        if (num.empty() || (*endPtr != '\0') || (dim <= 0) || (dim > INT_MAX)) {
+            return false;
+        }
+
+        dims.push_back((int) dim);
+
+        pos = str.find('[', end);
+    }
+
+    return true;
+}
+
+///
+/// @brief 比较运算的条件名字对应的IR操作符
+/// @param cond 条件名字
+/// @param op 操作符
+/// @return true 成功
+///
+static bool getCompareOp(const std::string & cond, IRInstOperator & op)
+{
+    static const std::unordered_map<std::string, IRInstOperator> compareOps = {
+        {"lt", IRInstOperator::IRINST_OP_LT_I},
+        {"gt", IRInstOperator::IRINST_OP_GT_I},
+        {"le", IRInstOperator::IRINST_OP_LE_I},
+        {"ge", IRInstOperator::IRINST_OP_GE_I},
+        {"eq", IRInstOperator::IRINST_OP_EQ_I},
+        {"ne", IRInstOperator::IRINST_OP_NE_I},
+    };
+
+    auto pIter = compareOps.find(cond);
+    if (pIter == compareOps.end()) {
+        return false;
+    }
+
+    op = pIter->second;
+
+    return true;
+}
+
+///
+/// @brief 算术运算的名字对应的IR操作符
+/// @param name 运算名字
+/// @param op 操作符
+/// @return true 成功
+///
+static bool getArithOp(const std::string & name, IRInstOperator & op)
+{
+    static const std::unordered_map<std::string, IRInstOperator> arithOps = {
+        {"add", IRInstOperator::IRINST_OP_ADD_I},
+        {"sub", IRInstOperator::IRINST_OP_SUB_I},
+        {"mul", IRInstOperator::IRINST_OP_MUL_I},
+        {"div", IRInstOperator::IRINST_OP_DIV_I},
+        {"mod", IRInstOperator::IRINST_OP_MOD_I},
+        {"neg", IRInstOperator::IRINST_OP_NEG_I},
+    };
+
+    auto pIter = arithOps.find(name);
+    if (pIter == arithOps.end()) {
+        return false;
+    }
+
+    op = pIter->second;
+
+    return true;
+}
+
+///
+/// @brief 构造函数
+/// @param _module 要填充的模块，内部只含有内置函数
+///
+IRParser::IRParser(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 记录出错位置与原因
+/// @param msg 错误信息
+/// @return false 便于直接return
+///
+bool IRParser::fail(const std::string & msg)
+{
+    lastError = "第" + std::to_string(lineNo + 1) + "行: " + msg;
+    return false;
+}
+
+///
+/// @brief 解析IR文件
+/// @param filename 文件名
+/// @return true 成功
+/// @return false 失败，错误信息通过getLastError获取
+///
+bool IRParser::parseFile(const std::string & filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) {
+        lastError = "IR文件(" + filename + ")打开失败";
+        return false;
+    }
+
+    std::stringstream ss;
+    ss << in.rdbuf();
+
+    return parseString(ss.str());
+}
+
+///
+/// @brief 解析内存中的IR文本
+/// @param text IR文本
+/// @return true 成功
+/// @return false 失败，错误信息通过getLastError获取
+///
+bool IRParser::parseString(const std::string & text)
+{
+    lines.clear();
+    lastError.clear();
+
+    std::stringstream ss(text);
+    std::string line;
+    while (std::getline(ss, line)) {
+        lines.push_back(line);
+    }
+
+    // 第一遍：全局变量与函数头，函数可先调用后定义
+    std::vector<FunctionRange> ranges;
+
+    for (lineNo = 0; lineNo < lines.size(); ++lineNo) {
+
+        line = stripComment(lines[lineNo]);
+        if (line.empty()) {
+            continue;
+        }
+
+        if (startsWith(line, "declare ")) {
+
+            if (!parseGlobalDeclare(line)) {
+                return false;
+            }
+
+        } else if (startsWith(line, "define ")) {
+
+            FunctionRange range;
+            if (!parseFunctionHeader(line, range)) {
+                return false;
+            }
+
+            // 函数头的下一个非空行必须是{
+            do {
+                ++lineNo;
+            } while ((lineNo < lines.size()) && stripComment(lines[lineNo]).empty());
+
+            if ((lineNo >= lines.size()) || (stripComment(lines[lineNo]) != "{")) {
+                return fail("函数" + range.func->getName() + "缺少{");
+            }
+
+            range.begin = lineNo + 1;
+
+            while ((lineNo < lines.size()) && (stripComment(lines[lineNo]) != "}")) {
+                ++lineNo;
+            }
+
+            if (lineNo >= lines.size()) {
+                return fail("函数" + range.func->getName() + "缺少}");
+            }
+
+            range.end = lineNo;
+
+            ranges.push_back(range);
+
+        } else {
+            return fail("无法识别的语句: " + line);
+        }
+    }
+
+    // 第二遍：函数体
+    for (auto & range: ranges) {
+        if (!parseFunctionBody(range)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 解析类型，支持i32、i1、void，以及指针*与数组[N]后缀
+/// @param str 类型字符串
+/// @return Type* 不支持的类型返回空指针
+///
+Type * IRParser::parseType(const std::string & str)
+{
+    std::string base;
+    std::vector<int> dims;
+    if (!splitDimensions(strip(str), base, dims)) {
+        return nullptr;
+    }
+
+    // 指针的层数
+    size_t depth = 0;
+    while (!base.empty() && (base.back() == '*')) {
+        base.pop_back();
+        depth++;
+    }
+
+    Type * type;
+    if (base == "i32") {
+        type = IntegerType::getTypeInt();
+    } else if (base == "i1") {
+        type = IntegerType::getTypeBool();
+    } else if (base == "void") {
+        type = VoidType::getType();
+    } else {
+        return nullptr;
+    }
+
+    for (size_t k = 0; k < depth; ++k) {
+        type = const_cast<Type *>(static_cast<const Type *>(PointerType::get(type)));
+    }
+
+    if (!dims.empty()) {
+        type = ArrayType::get(type, dims);
+    }
+
+    return type;
+}
+
+///
+/// @brief 解析全局变量的declare语句，形如declare i32 @a[10][20]
+/// @param line 去除注释后的行
+/// @return true 成功
+///
+bool IRParser::parseGlobalDeclare(const std::string & line)
+{
+    std::string rest;
+    (void) firstWord(line, rest);
+
+    std::string typeStr = firstWord(rest, rest);
+
+    std::string name;
+    std::vector<int> dims;
+    if (!splitDimensions(rest, name, dims)) {
+        return fail("数组维度格式错误: " + rest);
+    }
+
+    if ((name.size() < 2) || (name[0] != '@')) {
+        return fail("全局变量名应以@开始: " + name);
+    }
+
+    Type * type = parseType(typeStr);
+    if (!type || type->isVoidType()) {
+        return fail("不支持的类型: " + typeStr);
+    }
+
+    if (!dims.empty()) {
+        type = ArrayType::get(type, dims);
+    }
+
+    // 当前函数为空时创建的是全局变量
+    Value * var = module->newVarValue(type, name.substr(1));
+    if (!var) {
+        return fail("全局变量" + name + "重复定义");
+    }
+
+    globals[name] = var;
+
+    return true;
+}
+
+///
+/// @brief 解析函数头，形如define i32 @f(i32%t0, i32*%t1)
+/// @param line 去除注释后的行
+/// @param range 函数体位置，函数对象在这里返回
+/// @return true 成功
+///
+bool IRParser::parseFunctionHeader(const std::string & line, FunctionRange & range)
+{
+    std::string rest;
+    (void) firstWord(line, rest);
+
+    std::string retTypeStr = firstWord(rest, rest);
+    Type * retType = parseType(retTypeStr);
+    if (!retType) {
+        return fail("不支持的返回值类型: " + retTypeStr);
+    }
+
+    size_t lparen = rest.find('(');
+    size_t rparen = rest.rfind(')');
+    if ((rest.empty()) || (rest[0] != '@') || (lparen == std::string::npos) || (rparen == std::string::npos) ||
+        (rparen < lparen)) {
+        return fail("函数头格式错误: " + line);
+    }
+
+    std::string name = strip(rest.substr(1, lparen - 1));
+
+    // 形参的类型与名字之间没有空格，以%分隔
+    std::vector<FormalParam *> params;
+    for (auto & paramStr: split(rest.substr(lparen + 1, rparen - lparen - 1), ',')) {
+
+        size_t pos = paramStr.find('%');
+        if (pos == std::string::npos) {
+            return fail("形参格式错误: " + paramStr);
+        }
+
+        Type * paramType = parseType(paramStr.substr(0, pos));
+        if (!paramType || paramType->isVoidType()) {
+            return fail("不支持的形参类型: " + paramStr);
+        }
+
+        params.push_back(new FormalParam{paramType, ""});
+        range.paramNames.push_back(strip(paramStr.substr(pos)));
+    }
+
+    if (module->findFunction(name)) {
+        for (auto param: params) {
+            delete param;
+        }
+        return fail("函数" + name + "重复定义");
+    }
+
+    range.func = module->newFunction(name, retType, params);
+
+    return true;
+}
+
+///
+/// @brief 解析函数体
+/// @param range 函数体位置
+/// @return true 成功
+///
+bool IRParser::parseFunctionBody(const FunctionRange & range)
+{
+    currentFunc = range.func;
+    locals.clear();
+    tempTypes.clear();
+    labels.clear();
+    pendingArgs.clear();
+
+    auto & params = currentFunc->getParams();
+    for (size_t k = 0; k < params.size(); ++k) {
+        locals[range.paramNames[k]] = params[k];
+    }
+
+    // 先创建所有的Label指令，向前的跳转可以直接引用
+    for (lineNo = range.begin; lineNo < range.end; ++lineNo) {
+
+        std::string line = stripComment(lines[lineNo]);
+        if (line.empty() || (line.back() != ':')) {
+            continue;
+        }
+
+        line.pop_back();
+        if (labels.find(line) != labels.end()) {
+            return fail("Label" + line + "重复定义");
+        }
+
+        labels[line] = new LabelInstruction(currentFunc);
+    }
+
+    for (lineNo = range.begin; lineNo < range.end; ++lineNo) {
+
+        std::string line = stripComment(lines[lineNo]);
+        if (line.empty()) {
+            continue;
+        }
+
+        bool result;
+        if (startsWith(line, "declare ")) {
+            // 注释中含有局部变量的名字，需要原始行
+            result = parseLocalDeclare(lines[lineNo]);
+        } else {
+            result = parseInstruction(line);
+        }
+
+        if (!result) {
+            return false;
+        }
+    }
+
+    if (!pendingArgs.empty()) {
+        return fail("函数" + currentFunc->getName() + "中存在没有call指令使用的arg指令");
+    }
+
+    auto & insts = currentFunc->getInterCode().getInsts();
+    if (insts.empty() || (insts.back()->getOp() != IRInstOperator::IRINST_OP_EXIT)) {
+        return fail("函数" + currentFunc->getName() + "的最后一条指令不是exit");
+    }
+
+    // 被引用但没有出现在指令序列中的Label
+    std::unordered_set<Instruction *> placed(insts.begin(), insts.end());
+    for (auto & label: labels) {
+        if (placed.find(label.second) == placed.end()) {
+            return fail("函数" + currentFunc->getName() + "中的Label" + label.first + "没有定义");
+        }
+    }
+
+    // exit之前的Label为函数出口，return语句跳转到这里
+    if ((insts.size() >= 2) && (insts[insts.size() - 2]->getOp() == IRInstOperator::IRINST_OP_LABEL)) {
+        currentFunc->setExitLabel(insts[insts.size() - 2]);
+    }
+
+    // exit的操作数为局部变量时即为返回值变量
+    Instruction * exitInst = insts.back();
+    if (exitInst->getOperandsNum() == 1) {
+        auto retValue = dynamic_cast<LocalVariable *>(exitInst->getOperand(0));
+        if (retValue) {
+            currentFunc->setReturnValue(retValue);
+        }
+    }
+
+    currentFunc = nullptr;
+
+    return true;
+}
+
+///
+/// @brief 解析函数内的declare语句，形如declare i32 %l1 ; 1:a或declare i32 %l2[10] ;数组b
+/// @param line 原始行，注释中含有变量名与作用域层级
+/// @return true 成功
+///
+bool IRParser::parseLocalDeclare(const std::string & line)
+{
+    size_t pos = line.find(';');
+    std::string comment = (pos == std::string::npos) ? "" : strip(line.substr(pos + 1));
+
+    std::string rest;
+    (void) firstWord(stripComment(line), rest);
+
+    std::string typeStr = firstWord(rest, rest);
+    Type * type = parseType(typeStr);
+    if (!type || type->isVoidType()) {
+        return fail("不支持的类型: " + typeStr);
+    }
+
+    std::string irName;
+    std::vector<int> dims;
+    if (!splitDimensions(rest, irName, dims)) {
+        return fail("数组维度格式错误: " + rest);
+    }
+
+    if (!dims.empty()) {
+        type = ArrayType::get(type, dims);
+    }
+
+    if ((irName.size() < 2) || (irName[0] != '%')) {
+        return fail("变量名应以%开始: " + irName);
+    }
+
+    if (locals.find(irName) != locals.end() || tempTypes.find(irName) != tempTypes.end()) {
+        return fail("变量" + irName + "重复定义");
+    }
+
+    if (startsWith(irName, IR_LOCAL_VARNAME_PREFIX)) {
+
+        // 局部变量，注释给出作用域层级与源程序中的名字
+        std::string name;
+        int32_t scopeLevel = 1;
+
+        if (startsWith(comment, "数组")) {
+            name = strip(comment.substr(std::string("数组").size()));
+        } else if ((pos = comment.find(':')) != std::string::npos) {
+            scopeLevel = (int32_t) std::strtol(comment.substr(0, pos).c_str(), nullptr, 10);
+            name = strip(comment.substr(pos + 1));
+        }
+
+        locals[irName] = currentFunc->newLocalVarValue(type, name, scopeLevel);
+
+    } else if (startsWith(irName, IR_MEM_VARNAME_PREFIX)) {
+
+        locals[irName] = currentFunc->newMemVariable(type);
+
+    } else {
+
+        // 临时变量由指令产生，这里只记录类型
+        tempTypes[irName] = type;
+    }
+
+    return true;
+}
+
+///
+/// @brief 解析一条指令，并加入到当前函数中
+/// @param line 去除注释后的行
+/// @return true 成功
+///
+bool IRParser::parseInstruction(const std::string & line)
+{
+    InterCode & irCode = currentFunc->getInterCode();
+
+    // Label
+    if (line.back() == ':') {
+        irCode.addInst(labels[line.substr(0, line.size() - 1)]);
+        return true;
+    }
+
+    std::string rest;
+    std::string word = firstWord(line, rest);
+
+    if (word == "entry") {
+
+        irCode.addInst(new EntryInstruction(currentFunc));
+
+    } else if (word == "exit") {
+
+        Value * result = nullptr;
+        if (!rest.empty() && !(result = getValue(rest))) {
+            return false;
+        }
+
+        irCode.addInst(new ExitInstruction(currentFunc, result));
+
+    } else if (word == "br") {
+
+        // br label .L1
+        std::string target;
+        if ((firstWord(rest, target) != "label")) {
+            return fail("br指令格式错误: " + line);
+        }
+
+        LabelInstruction * label = getLabel(target);
+        if (!label) {
+            return false;
+        }
+
+        irCode.addInst(new GotoInstruction(currentFunc, label));
+
+    } else if (word == "bc") {
+
+        // bc %t1, label .L1, label .L2
+        auto items = split(rest, ',');
+        std::string trueTarget, falseTarget;
+        if ((items.size() != 3) || (firstWord(items[1], trueTarget) != "label") ||
+            (firstWord(items[2], falseTarget) != "label")) {
+            return fail("bc指令格式错误: " + line);
+        }
+
+        Value * cond = getValue(items[0]);
+        LabelInstruction * trueLabel = getLabel(trueTarget);
+        LabelInstruction * falseLabel = getLabel(falseTarget);
+        if (!cond || !trueLabel || !falseLabel) {
+            return false;
+        }
+
+        irCode.addInst(new GotoInstruction(currentFunc, cond, trueLabel, falseLabel));
+
+    } else if (word == "arg") {
+
+        // 实参由随后的call指令统一作为操作数
+        Value * arg = getValue(rest);
+        if (!arg) {
+            return false;
+        }
+
+        pendingArgs.push_back(arg);
+
+    } else if (word == "call") {
+
+        return parseCall("", line);
+
+    } else {
+
+        size_t pos = line.find('=');
+        if (pos == std::string::npos) {
+            return fail("无法识别的指令: " + line);
+        }
+
+        std::string dst = strip(line.substr(0, pos));
+        std::string rhs = strip(line.substr(pos + 1));
+        if (dst.empty() || rhs.empty()) {
+            return fail("无法识别的指令: " + line);
+        }
+
+        std::string op = firstWord(rhs, rest);
+        IRInstOperator irOp;
+        if ((op == "call") || (op == "icmp") || getArithOp(op, irOp)) {
+            return parseValueInstruction(dst, rhs);
+        }
+
+        // 赋值，含*%t1 = %l1的指针写与%l1 = *%t1的指针读
+        bool isStore = dst[0] == '*';
+        bool isLoad = rhs[0] == '*';
+
+        Value * dstVal = getValue(isStore ? strip(dst.substr(1)) : dst);
+        Value * srcVal = getValue(isLoad ? strip(rhs.substr(1)) : rhs);
+        if (!dstVal || !srcVal) {
+            return false;
+        }
+
+        auto moveInst = new MoveInstruction(currentFunc, dstVal, srcVal);
+        moveInst->setIsPointerStore(isStore);
+        moveInst->setIsPointerLoad(isLoad);
+
+        irCode.addInst(moveInst);
+    }
+
+    return true;
+}
+
+///
+/// @brief 解析有结果的指令，形如%t1 = add %l1,2或%t2 = icmp lt %t1,0
+/// @param dst 结果名
+/// @param rhs 等号右边的部分
+/// @return true 成功
+///
+bool IRParser::parseValueInstruction(const std::string & dst, const std::string & rhs)
+{
+    if (locals.find(dst) != locals.end()) {
+        return fail("指令结果" + dst + "重复定义");
+    }
+
+    std::string rest;
+    std::string op = firstWord(rhs, rest);
+
+    if (op == "call") {
+        return parseCall(dst, rhs);
+    }
+
+    IRInstOperator irOp;
+    Type * type = IntegerType::getTypeInt();
+
+    if (op == "icmp") {
+        std::string cond = firstWord(rest, rest);
+        if (!getCompareOp(cond, irOp)) {
+            return fail("未知的比较条件: " + cond);
+        }
+
+        type = IntegerType::getTypeBool();
+    } else if (!getArithOp(op, irOp)) {
+        return fail("未知的运算: " + op);
+    }
+
+    // 指针运算的结果类型由declare给出
+    auto pIter = tempTypes.find(dst);
+    if (pIter != tempTypes.end()) {
+        type = pIter->second;
+    }
+
+    auto items = split(rest, ',');
+    size_t num = (irOp == IRInstOperator::IRINST_OP_NEG_I) ? 1 : 2;
+    if (items.size() != num) {
+        return fail(op + "的操作数个数应为" + std::to_string(num));
+    }
+
+    Value * src1 = getValue(items[0]);
+    Value * src2 = (num == 2) ? getValue(items[1]) : nullptr;
+    if (!src1 || ((num == 2) && !src2)) {
+        return false;
+    }
+
+    auto inst = new BinaryInstruction(currentFunc, irOp, src1, src2, type);
+    currentFunc->getInterCode().addInst(inst);
+
+    locals[dst] = inst;
+
+    return true;
+}
+
+///
+/// @brief 解析函数调用，形如call i32 @f(i32 %l1, i32* %t2)
+/// @param dst 结果名，void函数为空串
+/// @param rhs call开始的部分
+/// @return true 成功
+///
+bool IRParser::parseCall(const std::string & dst, const std::string & rhs)
+{
+    size_t at = rhs.find('@');
+    size_t lparen = rhs.find('(');
+    size_t rparen = rhs.rfind(')');
+    if ((at == std::string::npos) || (lparen == std::string::npos) || (rparen == std::string::npos) ||
+        (lparen < at) || (rparen < lparen)) {
+        return fail("call指令格式错误: " + rhs);
+    }
+
+    std::string name = strip(rhs.substr(at + 1, lparen - at - 1));
+
+    Function * calledFunction = module->findFunction(name);
+    if (!calledFunction) {
+        return fail("函数" + name + "未定义");
+    }
+
+    Type * type = calledFunction->getReturnType();
+    if (!dst.empty() && type->isVoidType()) {
+        return fail("void函数" + name + "的调用不能有结果");
+    }
+
+    // 实参形如i32 %l1，值在最后
+    std::vector<Value *> realParams;
+    for (auto & argStr: split(rhs.substr(lparen + 1, rparen - lparen - 1), ',')) {
+
+        size_t pos = argStr.find_last_of(" \t");
+        Value * arg = getValue(pos == std::string::npos ? argStr : argStr.substr(pos + 1));
+        if (!arg) {
+            return false;
+        }
+
+        realParams.push_back(arg);
+    }
+
+    // 有arg指令时call中不再列出实参
+    if (realParams.empty()) {
+        realParams.swap(pendingArgs);
+    } else if (!pendingArgs.empty()) {
+        return fail("call指令同时存在arg指令与实参列表");
+    }
+
+    // 与IR生成时一致，统计函数调用与实参个数的最大值
+    currentFunc->setExistFuncCall(true);
+    if ((int) realParams.size() > currentFunc->getMaxFuncCallArgCnt()) {
+        currentFunc->setMaxFuncCallArgCnt((int) realParams.size());
+    }
+
+    auto inst = new FuncCallInstruction(currentFunc, calledFunction, realParams, type);
+    currentFunc->getInterCode().addInst(inst);
+
+    if (!dst.empty()) {
+        locals[dst] = inst;
+    }
+
+    return true;
+}
+
+///
+/// @brief 根据IR名字查找操作数，整数会创建常量
+/// @param name IR名字
+/// @return Value* 找不到时返回空指针并设置错误信息
+///
+Value * IRParser::getValue(const std::string & name)
+{
+    if (name.empty()) {
+        fail("缺少操作数");
+        return nullptr;
+    }
+
+    if (name[0] == '@') {
+        auto pIter = globals.find(name);
+        if (pIter == globals.end()) {
+            fail("全局变量" + name + "未定义");
+            return nullptr;
+        }
+        return pIter->second;
+    }
+
+    if (name[0] == '%') {
+        auto pIter = locals.find(name);
+        if (pIter == locals.end()) {
+            fail("变量" + name + "未定义或者在定义之前使用");
+            return nullptr;
+        }
+        return pIter->second;
+    }
+
+    // 整数常量
+    char * endPtr = nullptr;
+    errno = 0;
+    long long val = std::strtoll(name.c_str(), &endPtr, 10);
+    if ((*endPtr != '\0') || (errno != 0) || (val < INT32_MIN) || (val > INT32_MAX)) {
+        fail("无法识别的操作数: " + name);
+        return nullptr;
+    }
+
+    return module->newConstInt((int32_t) val);
+}
+
+///
+/// @brief 根据IR名字查找Label指令
+/// @param name IR名字，如.L3
+/// @return LabelInstruction* 找不到时返回空指针并设置错误信息
+///
+LabelInstruction * IRParser::getLabel(const std::string & name)
+{
+    auto pIter = labels.find(name);
+    if (pIter == labels.end()) {
+        fail("Label" + name + "没有定义");
+        return nullptr;
+    }
+
+    return pIter->second;
+}
@@ -0,0 +1,217 @@
+///
+/// @file IRParser.h
+/// @brief 文本形式的线性IR(DragonIR)解析，重建Module
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Module.h"
+
+class LabelInstruction;
+
+///
+/// @brief DragonIR文本解析器，把-I输出的线性IR重新构建为Module，
+/// 便于跳过前端直接对IR进行优化、检查或者产生汇编
+///
+class IRParser {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要填充的模块，内部只含有内置函数
+    ///
+    explicit IRParser(Module * _module);
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~IRParser() = default;
+
+    ///
+    /// @brief 解析IR文件
+    /// @param filename 文件名
+    /// @return true 成功
+    /// @return false 失败，错误信息通过getLastError获取
+    ///
+    bool parseFile(const std::string & filename);
+
+    ///
+    /// @brief 解析内存中的IR文本
+    /// @param text IR文本
+    /// @return true 成功
+    /// @return false 失败，错误信息通过getLastError获取
+    ///
+    bool parseString(const std::string & text);
+
+    void setLastError(const std::string & error)
+    {
+        lastError = error;
+    }
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    ///
+    /// @brief 函数定义在文本中的位置
+    ///
+    struct FunctionRange {
+
+        /// @brief 函数
+        Function * func;
+
+        /// @brief 形参的IR名字，与函数的形参一一对应
+        std::vector<std::string> paramNames;
+
+        /// @brief 函数体的起始行(含)，即{的下一行
+        size_t begin;
+
+        /// @brief 函数体的结束行(不含)，即}所在的行
+        size_t end;
+    };
+
+    ///
+    /// @brief 解析全局变量的declare语句
+    /// @param line 去除注释后的行
+    /// @return true 成功
+    ///
+    bool parseGlobalDeclare(const std::string & line);
+
+    ///
+    /// @brief 解析函数头define，创建函数及其形参
+    /// @param line 去除注释后的行
+    /// @param range 函数体位置，函数对象在这里返回
+    /// @return true 成功
+    ///
+    bool parseFunctionHeader(const std::string & line, FunctionRange & range);
+
+    ///
+    /// @brief 解析函数体
+    /// @param range 函数体位置
+    /// @return true 成功
+    ///
+    bool parseFunctionBody(const FunctionRange & range);
+
+    ///
+    /// @brief 解析函数内的declare语句，创建局部变量或者记录临时变量的类型
+    /// @param line 原始行，注释中含有变量名与作用域层级
+    /// @return true 成功
+    ///
+    bool parseLocalDeclare(const std::string & line);
+
+    ///
+    /// @brief 解析一条指令，并加入到当前函数中
+    /// @param line 去除注释后的行
+    /// @return true 成功
+    ///
+    bool parseInstruction(const std::string & line);
+
+    ///
+    /// @brief 解析有结果的指令，形如%t1 = add %l1,2
+    /// @param dst 结果名
+    /// @param rhs 等号右边的部分
+    /// @return true 成功
+    ///
+    bool parseValueInstruction(const std::string & dst, const std::string & rhs);
+
+    ///
+    /// @brief 解析函数调用，形如call i32 @f(i32 %l1, i32* %t2)
+    /// @param dst 结果名，void函数为空串
+    /// @param rhs call开始的部分
+    /// @return true 成功
+    ///
+    bool parseCall(const std::string & dst, const std::string & rhs);
+
+    ///
+    /// @brief 解析类型，支持i32、i1、void，以及指针*与数组[N]后缀
+    /// @param str 类型字符串
+    /// @return Type* 不支持的类型返回空指针
+    ///
+    Type * parseType(const std::string & str);
+
+    ///
+    /// @brief 根据IR名字查找操作数，整数会创建常量
+    /// @param name IR名字
+    /// @return Value* 找不到时返回空指针并设置错误信息
+    ///
+    Value * getValue(const std::string & name);
+
+    ///
+    /// @brief 根据IR名字查找Label指令
+    /// @param name IR名字，如.L3
+    /// @return LabelInstruction* 找不到时返回空指针并设置错误信息
+    ///
+    LabelInstruction * getLabel(const std::string & name);
+
+    ///
+    /// @brief 记录出错位置与原因
+    /// @param msg 错误信息
+    /// @return false 便于直接return
+    ///
+    bool fail(const std::string & msg);
+
+    ///
+    /// @brief 要填充的模块
+    ///
+    Module * module;
+
+    ///
+    /// @brief 按行拆分后的IR文本
+    ///
+    std::vector<std::string> lines;
+
+    ///
+    /// @brief 当前处理的行号，从0开始
+    ///
+    size_t lineNo = 0;
+
+    ///
+    /// @brief 全局变量，IR名字到Value
+    ///
+    std::unordered_map<std::string, Value *> globals;
+
+    ///
+    /// @brief 当前函数
+    ///
+    Function * currentFunc = nullptr;
+
+    ///
+    /// @brief 当前函数内的形参、局部变量与指令结果，IR名字到Value
+    ///
+    std::unordered_map<std::string, Value *> locals;
+
+    ///
+    /// @brief 当前函数内临时变量declare声明的类型
+    ///
+    std::unordered_map<std::string, Type *> tempTypes;
+
+    ///
+    /// @brief 当前函数内的Label指令
+    ///
+    std::unordered_map<std::string, LabelInstruction *> labels;
+
+    ///
+    /// @brief 当前函数中arg指令给出的实参，由随后的call指令使用
+    ///
+    std::vector<Value *> pendingArgs;
+
+    ///
+    /// @brief 错误信息
+    ///
+    std::string lastError;
+};
@@ -21,17 +21,58 @@
 #include <vector>
 
 #include "Type.h"
+#include "StorageSet.h"
 
 class FunctionType final : public Type {
+
+    ///
+    /// @brief Hash用结构体，按返回类型与各形参类型计算
+    ///
+    struct FunctionTypeHasher final {
+        size_t operator()(const FunctionType & type) const noexcept
+        {
+            size_t hash = std::hash<const Type *>{}(type.getReturnType());
+            for (Type * argType: type.getArgTypes()) {
+                hash = hash * 31 + std::hash<const Type *>{}(argType);
+            }
+            return hash;
+        }
+    };
+
+    ///
+    /// @brief 判断两者相等的结构体，返回类型与形参类型清单都相同时相等
+    ///
+    struct FunctionTypeEqual final {
+        bool operator()(const FunctionType & lhs, const FunctionType & rhs) const noexcept
+        {
+            return (lhs.getReturnType() == rhs.getReturnType()) && (lhs.getArgTypes() == rhs.getArgTypes());
+        }
+    };
+
 public:
     ///
     /// @brief 函数类型
     /// @param retType 函数返回值类型
     /// @param argTypes 函数形参类型
     ///
-    FunctionType(Type * _retType, std::vector<Type *> _argTypes) : retType{_retType}, argTypes{std::move(_argTypes)}
+    FunctionType(Type * _retType, std::vector<Type *> _argTypes)
+        : Type(FunctionTyID), retType{_retType}, argTypes{std::move(_argTypes)}
     {}
 
+    ///
+    /// @brief 获取函数类型，返回类型与形参类型都相同的函数共用一个函数类型
+    /// @param retType 函数返回值类型
+    /// @param argTypes 函数形参类型
+    /// @return FunctionType* 函数类型
+    ///
+    static FunctionType * get(Type * retType, const std::vector<Type *> & argTypes)
+    {
+        static StorageSet<FunctionType, FunctionTypeHasher, FunctionTypeEqual> storageSet;
+
+        // 类型创建后不再修改，去掉const便于作为Type *使用
+        return const_cast<FunctionType *>(storageSet.get(retType, argTypes));
+    }
+
     ///
     /// @brief 函数类型的IR字符串
     /// @return std::string
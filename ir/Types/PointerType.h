@@ -126,6 +126,15 @@ public:
         return pointeeType->toString() + "*";
     }
 
+    ///
+    /// @brief 获得类型所占内存空间大小，目标平台ARM32的指针为4个字节
+    /// @return int32_t
+    ///
+    [[nodiscard]] int32_t getSize() const override
+    {
+        return 4;
+    }
+
 private:
     ///
     /// @brief 指针直接指向的类型，在指针操作中只解引用一次
@@ -151,6 +160,31 @@ private:
 /// @brief 数组类型
 ///
 class ArrayType : public Type {
+
+    ///
+    /// @brief Hash用结构体，按元素类型与各维度大小计算
+    ///
+    struct ArrayTypeHasher final {
+        size_t operator()(const ArrayType & type) const noexcept
+        {
+            size_t hash = std::hash<const Type *>{}(type.getElementType());
+            for (int dim: type.getDimensions()) {
+                hash = hash * 31 + std::hash<int>{}(dim);
+            }
+            return hash;
+        }
+    };
+
+    ///
+    /// @brief 判断两者相等的结构体，元素类型与各维度大小都相同时相等
+    ///
+    struct ArrayTypeEqual final {
+        bool operator()(const ArrayType & lhs, const ArrayType & rhs) const noexcept
+        {
+            return (lhs.getElementType() == rhs.getElementType()) && (lhs.getDimensions() == rhs.getDimensions());
+        }
+    };
+
 private:
     /// @brief 元素类型
     Type* elementType;
@@ -215,11 +249,14 @@ public:
         return result;
     }
     
-    /// @brief 创建数组类型的静态方法
+    /// @brief 获取数组类型，相同元素类型与维度的数组类型只创建一个，类型相等可直接比较指针
     /// @param elemType 元素类型
     /// @param dims 维度大小列表
     /// @return 数组类型指针
     static ArrayType* get(Type* elemType, const std::vector<int>& dims) {
-        return new ArrayType(elemType, dims);
+        static StorageSet<ArrayType, ArrayTypeHasher, ArrayTypeEqual> storageSet;
+
+        // 类型创建后不再修改，去掉const便于作为Type *使用
+        return const_cast<ArrayType *>(storageSet.get(elemType, dims));
     }
 };
\ No newline at end of file
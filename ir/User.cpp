@@ -18,6 +18,7 @@
 #include <algorithm>
 
 #include "User.h"
+#include "CompileReport.h"
 
 ///
 /// @brief 构造函数
@@ -52,6 +53,7 @@ void User::addOperand(Value * val)
 
     // If not, add the given Value as a new use.
     auto use = new Use(val, this);
+    countObject(CountedObject::USE);
 
     // 增加到操作数中
     operands.push_back(use);
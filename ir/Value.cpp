@@ -93,6 +93,20 @@ void Value::removeUse(Use * use)
     }
 }
 
+///
+/// @brief 把所有使用本Value的地方替换为新的Value
+/// @param newVal 新的Value
+///
+void Value::replaceAllUseWith(Value * newVal)
+{
+    // setUsee会修改uses，因此必须先拷贝一份再遍历
+    std::vector<Use *> oldUses = uses;
+
+    for (auto use: oldUses) {
+        use->setUsee(newVal);
+    }
+}
+
 ///
 /// @brief 取得变量所在的作用域层级
 /// @return int32_t 层级
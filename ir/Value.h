@@ -92,6 +92,21 @@ public:
     ///
     void removeUse(Use * use);
 
+    ///
+    /// @brief 获取define-use链，即使用本Value的所有边
+    /// @return std::vector<Use *>&
+    ///
+    std::vector<Use *> & getUses()
+    {
+        return uses;
+    }
+
+    ///
+    /// @brief 把所有使用本Value的地方替换为新的Value
+    /// @param newVal 新的Value
+    ///
+    void replaceAllUseWith(Value * newVal);
+
     ///
     /// @brief 取得变量所在的作用域层级
     /// @return int32_t 层级
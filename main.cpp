@@ -9,8 +9,16 @@
  *
  */
 
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include <getopt.h>
 
 #ifdef _WIN32
@@ -19,15 +27,30 @@
 
 #include "Common.h"
 #include "AST.h"
+#include "ASTFingerprint.h"
 #include "Antlr4Executor.h"
 #include "CodeGenerator.h"
 #include "CodeGeneratorArm32.h"
+#include "CompileCache.h"
+#include "CompileReport.h"
 #include "FlexBisonExecutor.h"
 #include "FrontEndExecutor.h"
+#include "FunctionCodeCache.h"
 #include "Graph.h"
 #include "IRGenerator.h"
+#include "IRParser.h"
+#include "IRInterpreter.h"
+#include "IRBinaryReader.h"
+#include "IRBinaryWriter.h"
+#include "MappedFile.h"
 #include "RecursiveDescentExecutor.h"
 #include "Module.h"
+#include "PassManager.h"
+#include "ProfileData.h"
+#include "ProfileGeneratePass.h"
+#include "ProfileUsePass.h"
+#include "Sha256.h"
+#include "ThreadPool.h"
 
 ///
 /// @brief 是否显示帮助信息
@@ -55,9 +78,9 @@ static bool gShowASM = false;
 static bool gShowSymbol = false;
 
 ///
-/// @brief 前端分析器，默认选Flex和Bison
+/// @brief 前端分析器Flex和Bison，是否选中
 ///
-static bool gFrontEndFlexBison = true;
+static bool gFrontEndFlexBison = false;
 
 ///
 /// @brief 前端分析器Antlr4，是否选中
@@ -65,9 +88,9 @@ static bool gFrontEndFlexBison = true;
 static bool gFrontEndAntlr4 = false;
 
 ///
-/// @brief 前端分析器用递归下降分析法，是否选中
+/// @brief 前端分析器用递归下降分析法，默认选中
 ///
-static bool gFrontEndRecursiveDescentParsing = false;
+static bool gFrontEndRecursiveDescentParsing = true;
 
 ///
 /// @brief 在输出汇编时是否输出中间IR作为注释
@@ -77,15 +100,95 @@ static bool gAsmAlsoShowIR = false;
 /// @brief 优化的级别，即-O后面的数字，默认为0
 static int gOptLevel = 0;
 
+/// @brief 自定义的Pass流水线，逗号分隔，指定后替代-O对应的缺省流水线
+static std::string gPasses;
+
+/// @brief 是否输出每个Pass的执行时间与内存统计
+static bool gTimePasses = false;
+
+/// @brief 是否输出编译各阶段的墙上时间与CPU时间
+static bool gTimeReport = false;
+
+/// @brief 是否输出编译各阶段的内存峰值增长与对象数目
+static bool gMemReport = false;
+
+/// @brief 编译阶段统计是否以JSON格式输出，否则输出文本表格
+static bool gReportJson = false;
+
+/// @brief 是否在每个Pass执行后进行IR合法性检查
+static bool gVerifyIR = false;
+
+/// @brief 是否解释执行线性IR，替代汇编的输出
+static bool gInterpret = false;
+
+/// @brief 解释执行后是否输出函数与指令的动态执行次数
+static bool gInterpProfile = false;
+
+/// @brief 是否插桩产生剖析数据，程序退出时计数器写入gProfileGenerateFile
+static bool gProfileGenerate = false;
+
+/// @brief 插桩程序产生的剖析数据文件
+static std::string gProfileGenerateFile = ProfileData::DEFAULT_FILE;
+
+/// @brief 指导优化的剖析数据文件，为空时不使用
+static std::string gProfileUseFile;
+
+/// @brief 后端按函数并行生成代码的线程数，0表示取硬件的并发数
+static int gJobs = 0;
+
 /// @brief 指定CPU目标架构，这里默认为ARM32
 static std::string gCPUTarget = "ARM32";
 
-/// @brief 输入源文件
-static std::string gInputFile;
+/// @brief 输入源文件，批量编译时为多个，@开头的为响应文件，每行一个源文件
+static std::vector<std::string> gInputFiles;
 
-/// @brief 输出文件，不同的选项输出的内容不同
+/// @brief 输出文件，不同的选项输出的内容不同。批量编译时为输出目录，为空时输出到源文件所在目录
 static std::string gOutputFile;
 
+/// @brief 是否批量编译：一个进程内在线程池上并行编译多个源文件，每个源文件一个输出
+static bool gBatch = false;
+
+/// @brief 不可重入的前端以及抽象语法树的图片输出在批量编译时需串行执行
+static std::mutex gSerialMutex;
+
+/// @brief 是否使用编译缓存，源文件与选项都相同时直接取缓存的输出
+static bool gUseCache = false;
+
+/// @brief 编译缓存的目录，为空时取缺省目录
+static std::string gCacheDir;
+
+/// @brief 编译缓存的容量，单位MB
+static uint64_t gCacheSizeMB = 256;
+
+/// @brief 编译结束后是否输出编译缓存的统计
+static bool gCacheStats = false;
+
+/// @brief 编译缓存，批量编译时各线程共用
+static CompileCache gCache;
+
+/// @brief 缓存格式的版本，缓存的内容或键的组成变化时修改，使旧的条目失效
+static const char * CACHE_FORMAT_VERSION = "minic-cache-1";
+
+/// @brief 只有长选项的选项值，避免与短选项字符冲突
+enum LongOnlyOption {
+    OPT_PASSES = 256,
+    OPT_TIME_PASSES,
+    OPT_VERIFY_IR,
+    OPT_INTERP,
+    OPT_INTERP_PROFILE,
+    OPT_PROFILE_GENERATE,
+    OPT_PROFILE_USE,
+    OPT_JOBS,
+    OPT_BATCH,
+    OPT_TIME_REPORT,
+    OPT_MEM_REPORT,
+    OPT_LOG_LEVEL,
+    OPT_LOG_FILE,
+    OPT_CACHE,
+    OPT_CACHE_SIZE,
+    OPT_CACHE_STATS,
+};
+
 static struct option long_options[] = {
     {"help", no_argument, 0, 'h'},
     {"output", required_argument, 0, 'o'},
@@ -94,9 +197,26 @@ static struct option long_options[] = {
     {"ir", no_argument, 0, 'I'},
     {"antlr4", no_argument, 0, 'A'},
     {"recursive-descent", no_argument, 0, 'D'},
+    {"flex-bison", no_argument, 0, 'F'},
     {"optimize", required_argument, 0, 'O'},
     {"target", required_argument, 0, 't'},
     {"asmir", no_argument, 0, 'c'},
+    {"passes", required_argument, 0, OPT_PASSES},
+    {"time-passes", no_argument, 0, OPT_TIME_PASSES},
+    {"verify-ir", no_argument, 0, OPT_VERIFY_IR},
+    {"interp", no_argument, 0, OPT_INTERP},
+    {"interp-profile", no_argument, 0, OPT_INTERP_PROFILE},
+    {"profile-generate", optional_argument, 0, OPT_PROFILE_GENERATE},
+    {"profile-use", required_argument, 0, OPT_PROFILE_USE},
+    {"jobs", required_argument, 0, OPT_JOBS},
+    {"batch", no_argument, 0, OPT_BATCH},
+    {"time-report", optional_argument, 0, OPT_TIME_REPORT},
+    {"mem-report", optional_argument, 0, OPT_MEM_REPORT},
+    {"log-level", required_argument, 0, OPT_LOG_LEVEL},
+    {"log-file", required_argument, 0, OPT_LOG_FILE},
+    {"cache", optional_argument, 0, OPT_CACHE},
+    {"cache-size", required_argument, 0, OPT_CACHE_SIZE},
+    {"cache-stats", no_argument, 0, OPT_CACHE_STATS},
     {0, 0, 0, 0}
 };
 
@@ -104,18 +224,102 @@ static struct option long_options[] = {
 /// @param exeName
 static void showHelp(const std::string & exeName)
 {
-    std::cout << exeName + " -S [--symbol] [-A | --antlr4 | -D | --recursive-descent] [-T | --ast | -I | --ir] [-o output | --output=output] source\n";
+    std::cout << exeName + " -S [--symbol] [-A | --antlr4 | -D | --recursive-descent | -F | --flex-bison] [-T | --ast | -I | --ir] [-o output | --output=output] source\n";
     std::cout << "Options:\n";
     std::cout << "  -h, --help                 Show this help message\n";
-    std::cout << "  -o, --output=FILE          Specify output file\n";
+    std::cout << "  -o, --output=FILE          Specify output file; - writes IR or assembly to stdout\n";
     std::cout << "  -S, --symbol               Show symbol information\n";
     std::cout << "  -T, --ast                  Output abstract syntax tree\n";
     std::cout << "  -I, --ir                   Output intermediate representation\n";
     std::cout << "  -A, --antlr4               Use Antlr4 for lexical and syntax analysis\n";
-    std::cout << "  -D, --recursive-descent    Use recursive descent parsing\n";
+    std::cout << "  -D, --recursive-descent    Use recursive descent parsing (default)\n";
+    std::cout << "  -F, --flex-bison           Use Flex and Bison for lexical and syntax analysis\n";
     std::cout << "  -O, --optimize=LEVEL       Set optimization level\n";
     std::cout << "  -t, --target=CPU           Specify target CPU architecture\n";
     std::cout << "  -c, --asmir                Show IR instructions as comments in assembly output\n";
+    std::cout << "      --passes=P1,P2,...     Run the given IR passes instead of the -O pipeline\n";
+    std::cout << "      --time-passes          Report wall time and memory of each IR pass to stderr\n";
+    std::cout << "      --time-report[=FORMAT] Report wall and CPU time of each compilation phase to stderr;\n";
+    std::cout << "                             FORMAT is text (default) or json\n";
+    std::cout << "      --mem-report[=FORMAT]  Report peak RSS growth and AST node, IR instruction, use and\n";
+    std::cout << "                             ARM instruction counts of each compilation phase to stderr\n";
+    std::cout << "      --log-level=LEVEL      Log messages of LEVEL and above: debug, info, error (default) or none\n";
+    std::cout << "      --log-file=FILE        Append log messages to FILE instead of stderr\n";
+    std::cout << "      --verify-ir            Verify the IR after IR generation and after each pass\n";
+    std::cout << "      --interp               Execute the IR in-process; the exit code is main's return value\n";
+    std::cout << "      --interp-profile       Like --interp, then report per-function and per-instruction counts to stderr\n";
+    std::cout << "      --profile-generate[=FILE] Instrument block and branch counters; the program (or --interp)\n";
+    std::cout << "                             writes them to FILE (default minic.profdata) at exit\n";
+    std::cout << "      --profile-use=FILE     Use the counts in FILE for block layout and stack slot order\n";
+    std::cout << "      --jobs=N               Generate code for N functions in parallel (default: all cores);\n";
+    std::cout << "                             with --batch, compile N sources in parallel instead\n";
+    std::cout << "      --batch                Compile every source (and every line of an @FILE response file)\n";
+    std::cout << "                             in one process; -o names the output directory; a summary goes to stderr\n";
+    std::cout << "      --cache[=DIR]          Reuse the assembly or text IR of an earlier compile of the same source\n";
+    std::cout << "                             with the same options, and the assembly of unchanged functions of an\n";
+    std::cout << "                             edited source; DIR defaults to $MINIC_CACHE_DIR, else $HOME/.cache/minic\n";
+    std::cout << "      --cache-size=MB        Evict least recently used cache entries above MB (default 256)\n";
+    std::cout << "      --cache-stats          Report cumulative cache hits, misses and size to stderr (implies --cache)\n";
+    std::cout << "A source ending in .ir (DragonIR text) or .irb (binary IR module) skips the front end;\n";
+    std::cout << "with -I an output ending in .irb is written as a binary IR module\n";
+    std::cout << "Passes:\n" << std::flush;
+    PassManager::printRegisteredPasses(stdout);
+}
+
+/// @brief 判断字符串是否以指定后缀结尾
+/// @param str 字符串
+/// @param suffix 后缀
+/// @return true 是
+static bool hasSuffix(const std::string & str, const std::string & suffix)
+{
+    return (str.size() > suffix.size()) && (str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0);
+}
+
+/// @brief 判断输入是否为.ir后缀的DragonIR文本或者.irb后缀的IR二进制模块，是则跳过前端直接读入IR
+/// @param inputFile 输入文件
+/// @return true 是
+static bool isIRFile(const std::string & inputFile)
+{
+    return hasSuffix(inputFile, ".ir") || hasSuffix(inputFile, ".irb");
+}
+
+/// @brief 把@开头的响应文件替换为其中列出的源文件，每行一个，忽略空行与#开头的注释行
+/// @return true 成功
+/// @return false 响应文件不能打开
+static bool expandResponseFiles()
+{
+    std::vector<std::string> inputFiles;
+
+    for (auto & arg: gInputFiles) {
+
+        if (arg.size() < 2 || arg[0] != '@') {
+            inputFiles.push_back(arg);
+            continue;
+        }
+
+        std::ifstream ifs(arg.substr(1));
+        if (!ifs.is_open()) {
+            minic_log(LOG_ERROR, "响应文件(%s)不能打开", arg.c_str() + 1);
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(ifs, line)) {
+
+            // 去掉首尾空白，兼容CRLF换行
+            size_t first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#') {
+                continue;
+            }
+
+            size_t last = line.find_last_not_of(" \t\r");
+            inputFiles.push_back(line.substr(first, last - first + 1));
+        }
+    }
+
+    gInputFiles.swap(inputFiles);
+
+    return true;
 }
 
 /// @brief 参数解析与有效性检查
@@ -126,15 +330,15 @@ static int ArgsAnalysis(int argc, char * argv[])
 {
     int ch;
 
-    // 指定参数解析的选项，可识别-h、-o、-S、-T、-I、-A、-D等选项
+    // 指定参数解析的选项，可识别-h、-o、-S、-T、-I、-A、-D、-F等选项
     // -S必须项，输出中间IR、抽象语法树或汇编
     // -T指定时输出AST，-I输出中间IR，不指定则默认输出汇编
-    // -A指定按照antlr4进行词法与语法分析，-D指定按照递归下降分析法执行，不指定时按flex+bison执行
+    // -A指定按照antlr4进行词法与语法分析，-F指定按照flex+bison执行，-D或不指定时按递归下降分析法执行
     // -o要求必须带有附加参数，指定输出的文件
     // -O要求必须带有附加整数，指明优化的级别
     // -t要求必须带有目标CPU，指明目标CPU的汇编
     // -c选项在输出汇编时有效，附带输出IR指令内容
-    const char options[] = "ho:STIADO:t:c";
+    const char options[] = "ho:STIADFO:t:c";
     int option_index = 0;
 
     opterr = 1;
@@ -171,8 +375,14 @@ lb_check:
                 gFrontEndFlexBison = false;
                 gFrontEndRecursiveDescentParsing = true;
                 break;
+            case 'F':
+                // 选用flex+bison
+                gFrontEndAntlr4 = false;
+                gFrontEndFlexBison = true;
+                gFrontEndRecursiveDescentParsing = false;
+                break;
             case 'O':
-                // 优化级别分析，暂时没有用，如开启优化时请使用
+                // 优化级别分析，决定缺省的Pass流水线
                 gOptLevel = std::stoi(optarg);
                 break;
             case 't':
@@ -181,6 +391,87 @@ lb_check:
             case 'c':
                 gAsmAlsoShowIR = true;
                 break;
+            case OPT_PASSES:
+                gPasses = optarg;
+                break;
+            case OPT_TIME_PASSES:
+                gTimePasses = true;
+                break;
+            case OPT_VERIFY_IR:
+                gVerifyIR = true;
+                break;
+            case OPT_INTERP:
+                gInterpret = true;
+                break;
+            case OPT_INTERP_PROFILE:
+                gInterpret = true;
+                gInterpProfile = true;
+                break;
+            case OPT_PROFILE_GENERATE:
+                gProfileGenerate = true;
+                if (optarg) {
+                    gProfileGenerateFile = optarg;
+                }
+                break;
+            case OPT_PROFILE_USE:
+                gProfileUseFile = optarg;
+                break;
+            case OPT_JOBS:
+                gJobs = std::stoi(optarg);
+                if (gJobs < 0) {
+                    return -1;
+                }
+                break;
+            case OPT_BATCH:
+                gBatch = true;
+                break;
+            case OPT_LOG_LEVEL: {
+                int level;
+                if (!minic_log_parse_level(optarg, level)) {
+                    return -1;
+                }
+                minic_log_set_level(level);
+                break;
+            }
+            case OPT_LOG_FILE:
+                if (!minic_log_set_file(optarg)) {
+                    return -1;
+                }
+                break;
+            case OPT_CACHE:
+                gUseCache = true;
+                if (optarg) {
+                    gCacheDir = optarg;
+                }
+                break;
+            case OPT_CACHE_SIZE: {
+                long long size = std::atoll(optarg);
+                if (size <= 0) {
+                    return -1;
+                }
+                gCacheSizeMB = (uint64_t) size;
+                break;
+            }
+            case OPT_CACHE_STATS:
+                gUseCache = true;
+                gCacheStats = true;
+                break;
+            case OPT_TIME_REPORT:
+            case OPT_MEM_REPORT:
+                if (ch == OPT_TIME_REPORT) {
+                    gTimeReport = true;
+                } else {
+                    gMemReport = true;
+                }
+                if (optarg) {
+                    std::string format = optarg;
+                    if (format == "json") {
+                        gReportJson = true;
+                    } else if (format != "text") {
+                        return -1;
+                    }
+                }
+                break;
             default:
                 return -1;
                 break; /* no break */
@@ -192,14 +483,8 @@ lb_check:
 
     if (argc >= 1) {
 
-        // 第一次设置
-        if (gInputFile.empty()) {
-
-            gInputFile = argv[0];
-        } else {
-            // 重复设置则出错
-            return -1;
-        }
+        // 非批量编译时只能有一个源文件，在解析完所有选项后检查
+        gInputFiles.push_back(argv[0]);
 
         if (argc > 1) {
             // 多余一个参数，则说明输入的源文件后仍然有参数要解析
@@ -208,8 +493,41 @@ lb_check:
         }
     }
 
+    if (gBatch) {
+
+        // 展开响应文件
+        if (!expandResponseFiles()) {
+            return -1;
+        }
+
+        // 解释执行的输出与退出码只对应一个程序
+        if (gInterpret) {
+            return -1;
+        }
+
+        // 多个源文件并行编译时，进程的CPU时间、内存峰值与对象数目不能区分到单个源文件
+        if (gTimeReport || gMemReport) {
+            return -1;
+        }
+    } else if (gInputFiles.size() > 1) {
+        // 重复设置则出错
+        return -1;
+    }
+
     // 必须指定要进行编译的输入文件
-    if (gInputFile.empty()) {
+    if (gInputFiles.empty()) {
+        return -1;
+    }
+
+    // .ir与.irb后缀的输入为线性IR，没有抽象语法树
+    for (auto & inputFile: gInputFiles) {
+        if (isIRFile(inputFile) && gShowAST) {
+            return -1;
+        }
+    }
+
+    // 插桩的程序与使用剖析数据的程序不能是同一个
+    if (gProfileGenerate && !gProfileUseFile.empty()) {
         return -1;
     }
 
@@ -218,18 +536,18 @@ lb_check:
         return -1;
     }
 
-    int flag = (int) gShowLineIR + (int) gShowAST;
+    int flag = (int) gShowLineIR + (int) gShowAST + (int) gInterpret;
 
     if (0 == flag) {
         // 没有指定，则输出汇编指令
         gShowASM = true;
     } else if (flag != 1) {
-        // 线性中间IR、抽象语法树只能同时选择一个
+        // 线性中间IR、抽象语法树、解释执行只能同时选择一个
         return -1;
     }
 
-    // 没有指定输出文件则产生默认文件
-    if (gOutputFile.empty()) {
+    // 没有指定输出文件则产生默认文件，批量编译时按源文件产生
+    if (gOutputFile.empty() && !gBatch) {
 
         // 默认文件名
         if (gShowAST) {
@@ -244,6 +562,140 @@ lb_check:
     return 0;
 }
 
+/// @brief 编译缓存的缺省目录：环境变量MINIC_CACHE_DIR，其次为$HOME/.cache/minic，都没有时为当前目录下的.minic-cache
+/// @return 缓存目录
+static std::string defaultCacheDir()
+{
+    const char * dir = std::getenv("MINIC_CACHE_DIR");
+    if (dir && dir[0]) {
+        return dir;
+    }
+
+    const char * home = std::getenv("HOME");
+    if (home && home[0]) {
+        return std::string(home) + "/.cache/minic";
+    }
+
+    return ".minic-cache";
+}
+
+/// @brief 编译器自身的标识，编译器重新构建后缓存的条目失效
+/// @param hash 散列
+static void hashCompilerIdentity(Sha256 & hash)
+{
+    std::error_code ec;
+    std::filesystem::path exe("/proc/self/exe");
+
+    auto size = std::filesystem::file_size(exe, ec);
+    if (!ec) {
+        auto time = std::filesystem::last_write_time(exe, ec);
+        if (!ec) {
+            hash.updateField(std::to_string(size));
+            hash.updateField(std::to_string(time.time_since_epoch().count()));
+            return;
+        }
+    }
+
+    // 不能取得可执行文件时退化为构建时间
+    hash.updateField(__DATE__ " " __TIME__);
+}
+
+/// @brief 影响输出的选项加入编译缓存的键
+/// @param hash 散列
+/// @return true 成功
+/// @return false 剖析数据文件不能读取
+static bool hashCompileOptions(Sha256 & hash)
+{
+    hash.updateField(CACHE_FORMAT_VERSION);
+    hashCompilerIdentity(hash);
+
+    // 前端、优化与输出的选项
+    hash.updateField(gFrontEndAntlr4 ? "antlr4" : (gFrontEndFlexBison ? "flex-bison" : "recursive-descent"));
+    hash.updateField(std::to_string(gOptLevel));
+    hash.updateField(gPasses);
+    hash.updateField(gShowASM ? "asm" : "ir");
+    hash.updateField(gCPUTarget);
+    hash.updateField(gAsmAlsoShowIR ? "asmir" : "");
+
+    // 插桩的程序中含有剖析数据的文件名，使用剖析数据时其内容影响代码布局
+    hash.updateField(gProfileGenerate ? gProfileGenerateFile : "");
+    if (!gProfileUseFile.empty()) {
+        MappedFile profile;
+        if (!profile.open(gProfileUseFile)) {
+            return false;
+        }
+        hash.updateField(std::string_view(profile.data(), profile.size()));
+    }
+
+    return true;
+}
+
+/// @brief 计算编译缓存的键：源文件的内容以及影响输出的选项。MiniC没有预处理，源文件的内容就是编译的全部输入
+/// @param inputFile 源文件
+/// @param outputFile 输出文件
+/// @param key 键
+/// @return true 可以缓存
+/// @return false 文件不能读取，或者输出不适合缓存
+static bool compileCacheKey(const std::string & inputFile, const std::string & outputFile, std::string & key)
+{
+    // 只缓存汇编与文本的线性IR；输出到标准输出、IR二进制模块以及需输出诊断统计的编译不缓存
+    if (!gShowASM && !(gShowLineIR && !hasSuffix(outputFile, ".irb"))) {
+        return false;
+    }
+
+    if (outputFile == "-" || gTimePasses || gTimeReport || gMemReport || gVerifyIR) {
+        return false;
+    }
+
+    Sha256 hash;
+
+    if (!hashCompileOptions(hash)) {
+        return false;
+    }
+
+    MappedFile source;
+    if (!source.open(inputFile)) {
+        return false;
+    }
+
+    // 源文件名只用于区分.ir与.irb等输入的格式，内容相同的文件共用条目
+    hash.updateField(isIRFile(inputFile) ? (hasSuffix(inputFile, ".irb") ? "irb" : "ir") : "c");
+    hash.updateField(std::string_view(source.data(), source.size()));
+
+    key = hash.hexDigest();
+
+    return true;
+}
+
+/// @brief 函数级增量编译：整个文件未命中缓存时，按函数的指纹复用未修改函数的汇编，
+/// 只有修改过的函数进行IR生成、优化与指令选择
+/// @param astRoot 抽象语法树
+/// @return 函数汇编的缓存，不能按函数增量编译时为空
+static std::unique_ptr<FunctionCodeCache> lookupFunctionCode(ast_node * astRoot)
+{
+    // 插桩与剖析数据按整个模块编号；-c输出的IR注释中的Label按函数编号，不能与汇编的Label一起重新编号
+    if (!gCache.isOpen() || !gShowASM || gAsmAlsoShowIR || gProfileGenerate || !gProfileUseFile.empty()) {
+        return nullptr;
+    }
+
+    Sha256 hash;
+    if (!hashCompileOptions(hash)) {
+        return nullptr;
+    }
+
+    std::unordered_map<std::string, std::string> fingerprints;
+
+    ASTFingerprint fingerprint(astRoot);
+    if (!fingerprint.run(hash.hexDigest(), fingerprints)) {
+        return nullptr;
+    }
+
+    auto codeCache = std::make_unique<FunctionCodeCache>(gCache);
+    codeCache->lookup(fingerprints);
+
+    return codeCache;
+}
+
 ///
 /// @brief 对源文件进行编译处理生成汇编
 /// @return true 成功
@@ -259,6 +711,22 @@ static int compile(std::string inputFile, std::string outputFile)
 
     Module * module = nullptr;
 
+    // 函数级增量编译的缓存，在代码生成时使用
+    std::unique_ptr<FunctionCodeCache> codeCache;
+
+    // 编译各阶段的统计，出错提前退出时统计到出错的阶段为止
+    CompileReport report;
+
+    // 编译缓存的键，为空时不使用缓存
+    std::string cacheKey;
+    std::string cacheSuffix = gShowASM ? ".s" : ".ir";
+
+    if (gCache.isOpen() && compileCacheKey(inputFile, outputFile, cacheKey)) {
+        if (gCache.lookup(cacheKey, cacheSuffix, outputFile)) {
+            return 0;
+        }
+    }
+
     // 这里采用do {} while(0)架构的目的是如果处理出错可通过break退出循环，出口唯一
     // 在编译器编译优化时会自动去除，因为while恒假的缘故
     do {
@@ -266,46 +734,181 @@ static int compile(std::string inputFile, std::string outputFile)
         // 编译过程主要包括：
         // 1）词法语法分析生成AST
         // 2) 遍历AST生成线性IR
-        // 3) 对线性IR进行优化：目前不支持
+        // 3) 对线性IR进行优化：由PassManager按-O或--passes执行
         // 4) 把线性IR转换成汇编
 
-        // 创建词法语法分析器
-        FrontEndExecutor * frontEndExecutor;
-        if (gFrontEndAntlr4) {
-            // Antlr4
-            frontEndExecutor = new Antlr4Executor(inputFile);
-        } else if (gFrontEndRecursiveDescentParsing) {
-            // 递归下降分析法
-            frontEndExecutor = new RecursiveDescentExecutor(inputFile);
+        if (isIRFile(inputFile)) {
+
+            report.begin("irread");
+
+            // 符号表，保存所有的变量以及函数等信息
+            module = new Module(inputFile);
+
+            // 直接重建线性IR，跳过词法语法分析与IR生成
+            std::string error;
+            if (hasSuffix(inputFile, ".irb")) {
+                IRBinaryReader irReader(module);
+                subResult = irReader.read(inputFile);
+                error = irReader.getLastError();
+            } else {
+                IRParser irParser(module);
+                subResult = irParser.parseFile(inputFile);
+                error = irParser.getLastError();
+            }
+
+            if (!subResult) {
+
+                minic_log(LOG_ERROR, "中间IR读入错误 - 详细信息：%s", error.c_str());
+
+                break;
+            }
+
+        } else {
+
+            report.begin("frontend");
+
+            // 创建词法语法分析器
+            FrontEndExecutor * frontEndExecutor;
+            if (gFrontEndAntlr4) {
+                // Antlr4
+                frontEndExecutor = new Antlr4Executor(inputFile);
+            } else if (gFrontEndFlexBison) {
+                // Flex+Bison
+                frontEndExecutor = new FlexBisonExecutor(inputFile);
+            } else {
+                // 默认为递归下降分析法
+                frontEndExecutor = new RecursiveDescentExecutor(inputFile);
+            }
+
+            // 使用全局变量的前端不可重入，多个源文件并行编译时串行执行
+            std::unique_lock<std::mutex> frontEndLock(gSerialMutex, std::defer_lock);
+            if (!frontEndExecutor->isReentrant()) {
+                frontEndLock.lock();
+            }
+
+            // 前端执行：词法分析、语法分析后产生抽象语法树，其root由前端执行器的getASTRoot获取
+            subResult = frontEndExecutor->run();
+
+            // 获取抽象语法树的根节点
+            ast_node * astRoot = frontEndExecutor->getASTRoot();
+
+            // 清理前端资源
+            delete frontEndExecutor;
+
+            if (frontEndLock.owns_lock()) {
+                frontEndLock.unlock();
+            }
+
+            if (!subResult) {
+
+                minic_log(LOG_ERROR, "前端分析错误");
+                // 退出循环
+                break;
+            }
+
+            // 这里可进行非线性AST的优化
+
+            if (gShowAST) {
+
+                report.begin("ast-output");
+
+                // 遍历抽象语法树，生成抽象语法树图片，Graphviz不能多线程使用
+                {
+                    std::lock_guard<std::mutex> graphLock(gSerialMutex);
+                    OutputAST(astRoot, outputFile);
+                }
+
+                // 清理抽象语法树
+                free_ast(astRoot);
+
+                // 设置返回结果：正常
+                result = 0;
+
+                break;
+            }
+
+            // 输出线性中间IR、计算器模拟解释执行、输出汇编指令
+            // 都需要遍历AST转换成线性IR指令
+
+            report.begin("irgen");
+
+            // 符号表，保存所有的变量以及函数等信息
+            module = new Module(inputFile);
+
+            // 汇编可复用的函数不再产生线性IR
+            codeCache = lookupFunctionCode(astRoot);
+
+            // 遍历抽象语法树产生线性IR，相关信息保存到符号表中
+            IRGenerator ast2IR(astRoot, module);
+            if (codeCache) {
+                ast2IR.setReusedFunctions(&codeCache->getReusedFunctions());
+            }
+            subResult = ast2IR.run();
+            if (!subResult) {
+
+                // 输出错误信息
+                minic_log(LOG_ERROR, "中间IR生成错误 - 详细信息：%s", ast2IR.getLastError().c_str());
+
+                break;
+            }
+
+            // 清理抽象语法树
+            free_ast(astRoot);
+        }
+
+        report.begin("optimize");
+
+        // 中间代码优化，体系结构无关的优化，-I输出的也是优化后的IR
+        PassManager passManager(module);
+        passManager.setTimePasses(gTimePasses);
+        passManager.setVerifyEach(gVerifyIR);
+
+        // 插桩与剖析数据的标注都在优化之前进行，保证两者看到的IR一致，插桩点的编号相同
+        if (gProfileGenerate) {
+            passManager.addPass(new ProfileGeneratePass(gProfileGenerateFile));
+        } else if (!gProfileUseFile.empty()) {
+            passManager.addPass(new ProfileUsePass(gProfileUseFile));
+        }
+
+        if (!gPasses.empty()) {
+            if (!passManager.parsePipeline(gPasses)) {
+                break;
+            }
         } else {
-            // 默认为Flex+Bison
-            frontEndExecutor = new FlexBisonExecutor(inputFile);
+            passManager.buildPipeline(gOptLevel);
         }
 
-        // 前端执行：词法分析、语法分析后产生抽象语法树，其root为全局变量ast_root
-        subResult = frontEndExecutor->run();
-        if (!subResult) {
+        subResult = passManager.run();
 
-            minic_log(LOG_ERROR, "前端分析错误");
-            // 退出循环
+        if (gTimePasses) {
+            passManager.printTimeReport(stderr);
+        }
+
+        if (!subResult) {
+            minic_log(LOG_ERROR, "中间IR优化错误");
             break;
         }
 
-        // 获取抽象语法树的根节点
-        ast_node * astRoot = frontEndExecutor->getASTRoot();
+        if (gShowLineIR) {
 
-        // 清理前端资源
-        delete frontEndExecutor;
+            report.begin("ir-output");
 
-        // 这里可进行非线性AST的优化
+            if (hasSuffix(outputFile, ".irb")) {
 
-        if (gShowAST) {
+                // 输出IR二进制模块，不需要IR名字
+                IRBinaryWriter irWriter(module);
+                if (!irWriter.write(outputFile)) {
+                    minic_log(LOG_ERROR, "IR二进制模块输出错误 - 详细信息：%s", irWriter.getLastError().c_str());
+                    break;
+                }
+            } else {
 
-            // 遍历抽象语法树，生成抽象语法树图片
-            OutputAST(astRoot, outputFile);
+                // 对IR的名字重命名
+                module->renameIR();
 
-            // 清理抽象语法树
-            free_ast(astRoot);
+                // 输出IR
+                module->outputIR(outputFile);
+            }
 
             // 设置返回结果：正常
             result = 0;
@@ -313,36 +916,46 @@ static int compile(std::string inputFile, std::string outputFile)
             break;
         }
 
-        // 输出线性中间IR、计算器模拟解释执行、输出汇编指令
-        // 都需要遍历AST转换成线性IR指令
+        if (gInterpret) {
 
-        // 符号表，保存所有的变量以及函数等信息
-        Module * module = new Module(inputFile);
+            report.begin("interp");
 
-        // 遍历抽象语法树产生线性IR，相关信息保存到符号表中
-        IRGenerator ast2IR(astRoot, module);
-        subResult = ast2IR.run();
-        if (!subResult) {
+            // 解释执行，程序的输出直接到标准输出，返回值作为进程的退出码
+            IRInterpreter interpreter(module);
 
-			// 输出错误信息
-			minic_log(LOG_ERROR, "中间IR生成错误 - 详细信息：%s", ast2IR.getLastError().c_str());
+            int32_t exitCode = 0;
+            if (!interpreter.run(exitCode)) {
+                minic_log(LOG_ERROR, "解释执行错误 - 详细信息：%s", interpreter.getLastError().c_str());
+                break;
+            }
 
-            break;
-        }
+            if (gInterpProfile) {
+                // 对IR的名字重命名，便于输出指令
+                module->renameIR();
+                interpreter.printProfile(stderr);
+            }
 
-        // 清理抽象语法树
-        free_ast(astRoot);
+            // 插桩的程序与编译后的程序一样，退出时写出剖析数据
+            auto & counters = module->getProfileCounters();
+            if (!counters.empty()) {
 
-        if (gShowLineIR) {
+                ProfileData profile;
+                profile.setChecksum(module->getProfileChecksum());
 
-            // 对IR的名字重命名
-            module->renameIR();
+                for (auto counter: counters) {
+                    int32_t count = 0;
+                    interpreter.readGlobal(counter, count);
+                    profile.getCounts().push_back((uint32_t) count);
+                }
 
-            // 输出IR
-            module->outputIR(outputFile);
+                if (!profile.write(module->getProfileFile())) {
+                    minic_log(LOG_ERROR, "剖析数据输出错误 - 详细信息：%s", profile.getLastError().c_str());
+                }
+            }
 
-            // 设置返回结果：正常
-            result = 0;
+            module->Delete();
+
+            result = exitCode & 0xFF;
 
             break;
         }
@@ -353,19 +966,23 @@ static int compile(std::string inputFile, std::string outputFile)
             module->renameIR();
         }
 
-        // 这里可追加中间代码优化，体系结果无关的优化等
-
         // 后端处理，体系结果相关的操作
         // 这里提供一种面向ARM32的汇编产生器CodeGeneratorArm32作为参考
         // 需要时可根据需要修改或追加新的目标体系架构
         if (gShowASM) {
 
+            report.begin("codegen");
+
             CodeGenerator * generator = nullptr;
 
             if (gCPUTarget == "ARM32") {
                 // 输出面向ARM32的汇编指令
                 generator = new CodeGeneratorArm32(module);
                 generator->setShowLinearIR(gAsmAlsoShowIR);
+                // 批量编译时源文件之间已经并行，每个源文件的函数不再并行
+                generator->setJobs(gBatch ? 1 : gJobs);
+                generator->setOptLevel(gOptLevel);
+                generator->setFunctionCodeCache(codeCache.get());
                 generator->run(outputFile);
             } else {
                 // 不支持指定的CPU架构
@@ -376,6 +993,8 @@ static int compile(std::string inputFile, std::string outputFile)
             delete generator;
         }
 
+        report.begin("cleanup");
+
         // 清理符号表
         module->Delete();
 
@@ -386,9 +1005,119 @@ static int compile(std::string inputFile, std::string outputFile)
 
     delete module;
 
+    if (result == 0 && !cacheKey.empty()) {
+        gCache.store(cacheKey, cacheSuffix, outputFile);
+    }
+
+    if (gTimeReport || gMemReport) {
+        report.print(stderr, gTimeReport, gMemReport, gReportJson);
+    }
+
     return result;
 }
 
+/// @brief 批量编译时源文件对应的输出文件：输出目录(缺省为源文件所在目录)下与源文件同名、后缀按输出内容替换的文件
+/// @param inputFile 源文件
+/// @return 输出文件
+static std::string batchOutputFile(const std::string & inputFile)
+{
+    size_t slash = inputFile.find_last_of("/\\");
+    size_t nameBegin = (slash == std::string::npos) ? 0 : slash + 1;
+
+    std::string name = inputFile.substr(nameBegin);
+    size_t dot = name.find_last_of('.');
+    if (dot != std::string::npos && dot > 0) {
+        name.erase(dot);
+    }
+
+    if (gShowAST) {
+        name += ".png";
+    } else if (gShowLineIR) {
+        name += ".ir";
+    } else {
+        name += ".s";
+    }
+
+    if (gOutputFile.empty()) {
+        return inputFile.substr(0, nameBegin) + name;
+    }
+
+    if (gOutputFile.back() == '/') {
+        return gOutputFile + name;
+    }
+
+    return gOutputFile + "/" + name;
+}
+
+/// @brief 批量编译：所有源文件作为任务提交到任务窃取的线程池并行编译，完成后向标准错误输出汇总
+/// @return 0 全部成功，-1 有失败
+static int batchCompile()
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto start = Clock::now();
+
+    size_t count = gInputFiles.size();
+
+    // 各源文件的编译结果与耗时，按源文件的次序保存，汇总与调度次序无关
+    std::vector<int> results(count, -1);
+    std::vector<double> seconds(count, 0);
+
+    int32_t threads;
+    uint64_t steals;
+
+    {
+        ThreadPool pool(count > 1 ? gJobs : 1);
+
+        for (size_t k = 0; k < count; ++k) {
+            pool.submit([k, &results, &seconds]() {
+                auto begin = Clock::now();
+                results[k] = compile(gInputFiles[k], batchOutputFile(gInputFiles[k]));
+                seconds[k] = std::chrono::duration<double>(Clock::now() - begin).count();
+            });
+        }
+
+        pool.wait();
+
+        threads = pool.size();
+        steals = pool.getStealCount();
+    }
+
+    double total = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // 汇总：失败的源文件以及耗时最长的源文件
+    size_t failed = 0;
+    size_t slowest = 0;
+    double busy = 0;
+    for (size_t k = 0; k < count; ++k) {
+        if (results[k] != 0) {
+            failed++;
+        }
+
+        if (seconds[k] > seconds[slowest]) {
+            slowest = k;
+        }
+
+        busy += seconds[k];
+    }
+
+    fprintf(stderr, "===---------------------------------------------------------===\n");
+    fprintf(stderr, "                     Batch compile report\n");
+    fprintf(stderr, "===---------------------------------------------------------===\n");
+    fprintf(stderr, "  Inputs: %zu  Succeeded: %zu  Failed: %zu\n", count, count - failed, failed);
+    fprintf(stderr, "  Threads: %d  Steals: %llu\n", threads, (unsigned long long) steals);
+    fprintf(stderr, "  Wall: %.6f s  Sum of per-file: %.6f s\n", total, busy);
+    fprintf(stderr, "  Slowest: %s (%.6f s)\n", gInputFiles[slowest].c_str(), seconds[slowest]);
+
+    for (size_t k = 0; k < count; ++k) {
+        if (results[k] != 0) {
+            fprintf(stderr, "  FAILED: %s\n", gInputFiles[k].c_str());
+        }
+    }
+
+    return failed ? -1 : 0;
+}
+
 /// @brief 主程序
 /// @param argc
 /// @param argv
@@ -421,8 +1150,28 @@ int main(int argc, char * argv[])
         return 0;
     }
 
-    // 参数解析正确，进行编译处理，目前只支持一个文件的编译。
-    result = compile(gInputFile, gOutputFile);
+    // 编译缓存打开失败时不使用缓存，编译照常进行
+    if (gUseCache) {
+        std::string dir = gCacheDir.empty() ? defaultCacheDir() : gCacheDir;
+        if (!gCache.open(dir, gCacheSizeMB * 1024 * 1024)) {
+            minic_log(LOG_ERROR, "编译缓存不能使用 - 详细信息：%s", gCache.getLastError().c_str());
+        }
+    }
+
+    // 参数解析正确，进行编译处理
+    if (gBatch) {
+        result = batchCompile();
+    } else {
+        result = compile(gInputFiles[0], gOutputFile);
+    }
+
+    if (gCache.isOpen()) {
+        gCache.finish();
+
+        if (gCacheStats) {
+            gCache.printStats(stderr);
+        }
+    }
 
     return result;
 }
@@ -0,0 +1,211 @@
+///
+/// @file BlockLayoutPass.cpp
+/// @brief 基于剖析数据的基本块布局
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Function.h"
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "BlockLayoutPass.h"
+
+///
+/// @brief 基本块，指令序列中[begin, end)区间的指令
+///
+struct LayoutBlock {
+
+    /// @brief 首指令位置
+    size_t begin;
+
+    /// @brief 尾后位置
+    size_t end;
+
+    /// @brief 执行次数
+    uint64_t count;
+
+    /// @brief 最后一条有效指令，即跳转、exit或者顺序执行到下一块的普通指令
+    Instruction * terminator;
+};
+
+///
+/// @brief 对函数的基本块重新布局
+/// @param func 要处理的函数
+/// @return true IR被修改
+///
+bool BlockLayoutPass::runOnFunction(Function * func)
+{
+    if (!func->hasProfile()) {
+        return false;
+    }
+
+    auto & insts = func->getInterCode().getInsts();
+
+    // 按entry与Label划分基本块
+    std::vector<LayoutBlock> blocks;
+    std::vector<size_t> instBlock(insts.size());
+    std::unordered_map<Instruction *, size_t> labelBlock;
+
+    for (size_t k = 0; k < insts.size(); ++k) {
+
+        Instruction * inst = insts[k];
+
+        if ((k == 0) || (inst->getOp() == IRInstOperator::IRINST_OP_LABEL)) {
+
+            uint64_t count = func->getEntryCount();
+            if (k != 0) {
+                count = static_cast<LabelInstruction *>(inst)->getProfileCount();
+                labelBlock[inst] = blocks.size();
+            }
+
+            if (!blocks.empty()) {
+                blocks.back().end = k;
+            }
+
+            blocks.push_back(LayoutBlock{k, insts.size(), count, nullptr});
+        }
+
+        instBlock[k] = blocks.size() - 1;
+
+        if (!inst->isDead()) {
+            blocks.back().terminator = inst;
+        }
+    }
+
+    // 最后一块含有exit指令，固定在最后，只有一个可移动的块时不需要处理
+    size_t n = blocks.size();
+    if (n <= 3) {
+        return false;
+    }
+
+    // 后继块以及对应跳转边的执行次数
+    std::vector<std::vector<std::pair<size_t, uint64_t>>> succs(n);
+
+    for (size_t b = 0; b < n; ++b) {
+
+        Instruction * terminator = blocks[b].terminator;
+        uint64_t count = blocks[b].count;
+
+        if (terminator && (terminator->getOp() == IRInstOperator::IRINST_OP_GOTO)) {
+
+            auto gotoInst = static_cast<GotoInstruction *>(terminator);
+
+            if (gotoInst->getOperandsNum() == 1) {
+                uint64_t taken = std::min(gotoInst->getTakenCount(), count);
+                succs[b].emplace_back(labelBlock[gotoInst->getTarget()], taken);
+                succs[b].emplace_back(labelBlock[gotoInst->getFalseTarget()], count - taken);
+            } else {
+                succs[b].emplace_back(labelBlock[gotoInst->getTarget()], count);
+            }
+        } else if ((!terminator || (terminator->getOp() != IRInstOperator::IRINST_OP_EXIT)) && (b + 1 < n)) {
+            succs[b].emplace_back(b + 1, count);
+        }
+    }
+
+    // 沿执行次数最多的后继边贪心地串接基本块
+    size_t last = n - 1;
+    std::vector<size_t> order{0};
+    std::vector<bool> placed(n, false);
+    placed[0] = true;
+    placed[last] = true;
+
+    size_t current = 0;
+    size_t scan = 1;
+
+    while (order.size() < last) {
+
+        size_t best = n;
+        uint64_t bestCount = 0;
+
+        for (auto & succ: succs[current]) {
+            if (placed[succ.first]) {
+                continue;
+            }
+
+            if ((best == n) || (succ.second > bestCount) || ((succ.second == bestCount) && (succ.first < best))) {
+                best = succ.first;
+                bestCount = succ.second;
+            }
+        }
+
+        if (best == n) {
+            while (placed[scan]) {
+                scan++;
+            }
+            best = scan;
+        }
+
+        placed[best] = true;
+        order.push_back(best);
+        current = best;
+    }
+
+    order.push_back(last);
+
+    std::vector<size_t> position(n);
+    bool identity = true;
+    for (size_t k = 0; k < n; ++k) {
+        position[order[k]] = k;
+        identity = identity && (order[k] == k);
+    }
+
+    if (identity) {
+        return false;
+    }
+
+    // 指令结果的使用需仍在定义之后，后续的Pass以及IR输出都依赖该次序
+    std::unordered_map<Instruction *, size_t> instIndex;
+    for (size_t k = 0; k < insts.size(); ++k) {
+        instIndex[insts[k]] = k;
+    }
+
+    for (size_t k = 0; k < insts.size(); ++k) {
+        for (auto use: insts[k]->getUses()) {
+
+            auto userInst = dynamic_cast<Instruction *>(use->getUser());
+            if (!userInst) {
+                continue;
+            }
+
+            auto pIter = instIndex.find(userInst);
+            if ((pIter != instIndex.end()) && (position[instBlock[pIter->second]] < position[instBlock[k]])) {
+                return false;
+            }
+        }
+    }
+
+    std::vector<Instruction *> newInsts;
+    newInsts.reserve(insts.size() + n);
+
+    for (size_t k = 0; k < n; ++k) {
+
+        LayoutBlock & block = blocks[order[k]];
+        newInsts.insert(newInsts.end(), insts.begin() + (long) block.begin, insts.begin() + (long) block.end);
+
+        // 原来顺序执行到下一块的，下一块不再紧邻时补充无条件跳转
+        Instruction * terminator = block.terminator;
+        bool fallThrough = !terminator || ((terminator->getOp() != IRInstOperator::IRINST_OP_GOTO) &&
+                                           (terminator->getOp() != IRInstOperator::IRINST_OP_EXIT));
+
+        size_t next = order[k] + 1;
+        if (fallThrough && (next < n) && ((k + 1 == n) || (order[k + 1] != next))) {
+            newInsts.push_back(new GotoInstruction(func, insts[blocks[next].begin]));
+        }
+    }
+
+    insts.swap(newInsts);
+
+    return true;
+}
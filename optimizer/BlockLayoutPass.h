@@ -0,0 +1,41 @@
+///
+/// @file BlockLayoutPass.h
+/// @brief 基于剖析数据的基本块布局
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include "Pass.h"
+
+///
+/// @brief 基本块布局：从entry所在块开始，每次把当前块执行次数最多的未放置后继块紧接着放置，
+/// 没有可放置的后继时取原次序中第一个未放置的块，出口块始终在最后。
+/// 热路径因此变为顺序执行，原来顺序执行的块不再相邻时补充无条件跳转，
+/// 之后由simplifycfg删除跳转到下一条指令的跳转，后端对条件跳转只产生一条跳转指令。
+/// 没有剖析数据的函数不做处理
+///
+class BlockLayoutPass : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    BlockLayoutPass() : FunctionPass("blocklayout")
+    {}
+
+    ///
+    /// @brief 对函数的基本块重新布局
+    /// @param func 要处理的函数
+    /// @return true IR被修改
+    ///
+    bool runOnFunction(Function * func) override;
+};
@@ -0,0 +1,156 @@
+///
+/// @file ConstFoldPass.cpp
+/// @brief 常量折叠
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+
+#include <cstdint>
+
+#include "Module.h"
+#include "Function.h"
+#include "ConstInt.h"
+#include "BinaryInstruction.h"
+#include "GotoInstruction.h"
+#include "ConstFoldPass.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+///
+/// @brief 对整数常量进行编译期求值
+/// @param op 运算符
+/// @param a 左操作数
+/// @param b 右操作数，一元运算时忽略
+/// @param result 运算结果
+/// @return true 可以折叠
+/// @return false 不能折叠，如除零等运行时行为需保留
+///
+static bool evalConstBinary(IRInstOperator op, int32_t a, int32_t b, int32_t & result)
+{
+    // 加减乘按32位补码回绕，用无符号运算避免有符号溢出的未定义行为
+    auto ua = (uint32_t) a;
+    auto ub = (uint32_t) b;
+
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+            result = (int32_t) (ua + ub);
+            break;
+        case IRInstOperator::IRINST_OP_SUB_I:
+            result = (int32_t) (ua - ub);
+            break;
+        case IRInstOperator::IRINST_OP_MUL_I:
+            result = (int32_t) (ua * ub);
+            break;
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+            // 除零以及INT32_MIN / -1保留到运行时
+            if ((b == 0) || ((a == INT32_MIN) && (b == -1))) {
+                return false;
+            }
+            result = (op == IRInstOperator::IRINST_OP_DIV_I) ? a / b : a % b;
+            break;
+        case IRInstOperator::IRINST_OP_NEG_I:
+            result = (int32_t) (0u - ua);
+            break;
+        case IRInstOperator::IRINST_OP_LT_I:
+            result = a < b;
+            break;
+        case IRInstOperator::IRINST_OP_GT_I:
+            result = a > b;
+            break;
+        case IRInstOperator::IRINST_OP_LE_I:
+            result = a <= b;
+            break;
+        case IRInstOperator::IRINST_OP_GE_I:
+            result = a >= b;
+            break;
+        case IRInstOperator::IRINST_OP_EQ_I:
+            result = a == b;
+            break;
+        case IRInstOperator::IRINST_OP_NE_I:
+            result = a != b;
+            break;
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief 对函数执行常量折叠
+/// @param func 要处理的函数
+/// @return true IR被修改
+///
+bool ConstFoldPass::runOnFunction(Function * func)
+{
+    bool changed = false;
+
+    auto & insts = func->getInterCode().getInsts();
+
+    // 指令按序排列，前面折叠出的常量会传播给后面的指令，一遍即可
+    for (auto & inst: insts) {
+
+        if (Instanceof(binInst, BinaryInstruction *, inst)) {
+
+            // 指针运算(数组地址计算)的结果不能替换为整数常量
+            if (!binInst->getType()->isIntegerType() || binInst->getUses().empty()) {
+                continue;
+            }
+
+            Instanceof(left, ConstInt *, binInst->getOperand(0));
+            if (!left) {
+                continue;
+            }
+
+            int32_t rightVal = 0;
+            if (binInst->getOp() != IRInstOperator::IRINST_OP_NEG_I) {
+                Instanceof(right, ConstInt *, binInst->getOperand(1));
+                if (!right) {
+                    continue;
+                }
+                rightVal = right->getVal();
+            }
+
+            int32_t result;
+            if (!evalConstBinary(binInst->getOp(), left->getVal(), rightVal, result)) {
+                continue;
+            }
+
+            // 指令本身变为无用指令，交由死代码删除处理
+            binInst->replaceAllUseWith(module->newConstInt(result));
+            changed = true;
+
+        } else if (Instanceof(gotoInst, GotoInstruction *, inst)) {
+
+            // 条件为常量的条件跳转变为无条件跳转
+            if (gotoInst->getOperandsNum() != 1) {
+                continue;
+            }
+
+            Instanceof(cond, ConstInt *, gotoInst->getOperand(0));
+            if (!cond) {
+                continue;
+            }
+
+            Instruction * target = cond->getVal() ? gotoInst->getTarget() : gotoInst->getFalseTarget();
+
+            inst = new GotoInstruction(func, target);
+
+            gotoInst->clearOperands();
+            delete gotoInst;
+
+            changed = true;
+        }
+    }
+
+    return changed;
+}
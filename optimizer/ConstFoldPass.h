@@ -0,0 +1,38 @@
+///
+/// @file ConstFoldPass.h
+/// @brief 常量折叠
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include "Pass.h"
+
+///
+/// @brief 常量折叠：操作数均为整数常量的二元运算、求负、比较运算在编译期求值，
+/// 指令结果的所有使用处替换为常量，原指令由死代码删除Pass清理
+///
+class ConstFoldPass : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    ConstFoldPass() : FunctionPass("constfold")
+    {}
+
+    ///
+    /// @brief 对函数执行常量折叠
+    /// @param func 要处理的函数
+    /// @return true IR被修改
+    ///
+    bool runOnFunction(Function * func) override;
+};
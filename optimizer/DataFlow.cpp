@@ -0,0 +1,245 @@
+///
+/// @file DataFlow.cpp
+/// @brief 函数内的控制流图、值编号以及通用的数据流分析框架
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <utility>
+
+#include "Function.h"
+#include "GotoInstruction.h"
+#include "DataFlow.h"
+
+ControlFlowGraph::ControlFlowGraph(Function * _func) : func(_func)
+{
+    auto & insts = func->getInterCode().getInsts();
+
+    instBlock.resize(insts.size());
+
+    // 跳转目标Label到所在块的映射
+    std::unordered_map<Instruction *, uint32_t> labelBlock;
+
+    // 跳转或exit之后的指令开始新的块，即使没有Label，这样块内的指令总是顺序执行
+    bool startBlock = true;
+
+    for (size_t k = 0; k < insts.size(); ++k) {
+
+        Instruction * inst = insts[k];
+        IRInstOperator op = inst->getOp();
+
+        if (startBlock || (op == IRInstOperator::IRINST_OP_LABEL)) {
+
+            if (!blocks.empty()) {
+                blocks.back().end = k;
+            }
+
+            blocks.push_back(CFGBlock{k, insts.size(), {}, {}});
+            startBlock = false;
+        }
+
+        instBlock[k] = (uint32_t) blocks.size() - 1;
+
+        if (op == IRInstOperator::IRINST_OP_LABEL) {
+            labelBlock[inst] = instBlock[k];
+        }
+
+        if (!inst->isDead() && ((op == IRInstOperator::IRINST_OP_GOTO) || (op == IRInstOperator::IRINST_OP_EXIT))) {
+            startBlock = true;
+        }
+    }
+
+    uint32_t n = (uint32_t) blocks.size();
+
+    for (uint32_t b = 0; b < n; ++b) {
+
+        // 块的最后一条有效指令决定后继
+        Instruction * terminator = nullptr;
+        for (size_t k = blocks[b].end; k > blocks[b].begin; --k) {
+            if (!insts[k - 1]->isDead()) {
+                terminator = insts[k - 1];
+                break;
+            }
+        }
+
+        auto & succs = blocks[b].succs;
+
+        if (terminator && (terminator->getOp() == IRInstOperator::IRINST_OP_GOTO)) {
+
+            auto gotoInst = static_cast<GotoInstruction *>(terminator);
+
+            succs.push_back(labelBlock[gotoInst->getTarget()]);
+            if (gotoInst->getOperandsNum() == 1) {
+                uint32_t falseBlock = labelBlock[gotoInst->getFalseTarget()];
+                if (falseBlock != succs.front()) {
+                    succs.push_back(falseBlock);
+                }
+            }
+        } else if ((!terminator || (terminator->getOp() != IRInstOperator::IRINST_OP_EXIT)) && (b + 1 < n)) {
+            succs.push_back(b + 1);
+        }
+
+        for (uint32_t succ: succs) {
+            blocks[succ].preds.push_back(b);
+        }
+    }
+
+    if (n == 0) {
+        return;
+    }
+
+    // 非递归的深度优先遍历求后序，栈中保存块及下一个要访问的后继序号
+    std::vector<uint32_t> postOrder;
+    postOrder.reserve(n);
+
+    BitSet visited(n);
+    std::vector<std::pair<uint32_t, size_t>> stack{{0, 0}};
+    visited.set(0);
+
+    while (!stack.empty()) {
+
+        auto & top = stack.back();
+        auto & succs = blocks[top.first].succs;
+
+        if (top.second < succs.size()) {
+            uint32_t succ = succs[top.second++];
+            if (!visited.test(succ)) {
+                visited.set(succ);
+                stack.emplace_back(succ, 0);
+            }
+        } else {
+            postOrder.push_back(top.first);
+            stack.pop_back();
+        }
+    }
+
+    rpo.assign(postOrder.rbegin(), postOrder.rend());
+
+    for (uint32_t b = 0; b < n; ++b) {
+        if (!visited.test(b)) {
+            rpo.push_back(b);
+        }
+    }
+}
+
+ValueNumbering::ValueNumbering(Function * func)
+{
+    for (auto var: func->getVarValues()) {
+        add(var);
+    }
+
+    for (auto var: func->getMemVariables()) {
+        add(var);
+    }
+
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (inst->hasResultValue()) {
+            add(inst);
+        }
+    }
+}
+
+void ValueNumbering::add(Value * val)
+{
+    // 数组通过地址访问元素，按内存处理
+    if (val->getType()->isArrayType()) {
+        return;
+    }
+
+    numbers.emplace(val, (uint32_t) values.size());
+    values.push_back(val);
+}
+
+DataFlowAnalysis::DataFlowAnalysis(Function * func, DataFlowDirection _direction, DataFlowMeet _meet)
+    : cfg(func), direction(_direction), meet(_meet)
+{}
+
+void DataFlowAnalysis::solve()
+{
+    uint32_t n = cfg.size();
+    auto & blocks = cfg.getBlocks();
+
+    gen.assign(n, BitSet(0));
+    kill.assign(n, BitSet(0));
+
+    initialize();
+
+    bool forward = direction == DataFlowDirection::FORWARD;
+    bool intersect = meet == DataFlowMeet::INTERSECT;
+
+    // 交集分析从全集开始向下收敛，并集分析从空集开始向上收敛
+    in.assign(n, BitSet(universe, intersect && !forward));
+    out.assign(n, BitSet(universe, intersect && forward));
+
+    // 前向分析按逆后序处理，后向分析按逆后序的逆序处理，使得多数块处理时其输入已经算过
+    std::vector<uint32_t> order = cfg.getReversePostOrder();
+    if (!forward) {
+        std::reverse(order.begin(), order.end());
+    }
+
+    std::vector<uint32_t> position(n);
+    for (uint32_t k = 0; k < n; ++k) {
+        position[order[k]] = k;
+    }
+
+    // 工作表按处理次序中的位置记录待处理的块，每次取当前位置之后最近的块，到末尾后从头开始
+    BitSet pending(n, true);
+    BitSet meetSet(universe);
+    BitSet result(universe);
+
+    iterations = 0;
+
+    int32_t pos = pending.findFirst();
+    while (pos != -1) {
+
+        pending.reset((uint32_t) pos);
+        iterations++;
+
+        uint32_t b = order[pos];
+        auto & neighbors = forward ? blocks[b].preds : blocks[b].succs;
+        auto & sources = forward ? out : in;
+
+        // 汇合，入口块以及没有相邻块的块为边界，取空集
+        if ((forward && (b == 0)) || neighbors.empty()) {
+            meetSet.clear();
+        } else {
+            meetSet = sources[neighbors.front()];
+            for (size_t k = 1; k < neighbors.size(); ++k) {
+                if (intersect) {
+                    meetSet.intersectWith(sources[neighbors[k]]);
+                } else {
+                    meetSet.unionWith(sources[neighbors[k]]);
+                }
+            }
+        }
+
+        // 传递函数gen ∪ (x - kill)
+        result = meetSet;
+        result.subtract(kill[b]);
+        result.unionWith(gen[b]);
+
+        (forward ? in : out)[b] = meetSet;
+
+        BitSet & target = forward ? out[b] : in[b];
+        if (result != target) {
+            target = result;
+
+            for (uint32_t next: forward ? blocks[b].succs : blocks[b].preds) {
+                pending.set(position[next]);
+            }
+        }
+
+        pos = pending.findNext((uint32_t) pos);
+        if (pos == -1) {
+            pos = pending.findFirst();
+        }
+    }
+}
@@ -0,0 +1,329 @@
+///
+/// @file DataFlow.h
+/// @brief 函数内的控制流图、值编号以及通用的数据流分析框架
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "BitSet.h"
+
+class Function;
+class Instruction;
+class Value;
+
+///
+/// @brief 基本块，函数指令序列中[begin, end)区间的指令
+///
+struct CFGBlock {
+
+    /// @brief 首指令位置
+    size_t begin;
+
+    /// @brief 尾后位置
+    size_t end;
+
+    /// @brief 后继块的编号
+    std::vector<uint32_t> succs;
+
+    /// @brief 前驱块的编号
+    std::vector<uint32_t> preds;
+};
+
+///
+/// @brief 函数的控制流图。以entry、Label以及跳转或exit之后的指令作为块的开始划分基本块，
+/// 块0为入口块，块的编号与指令序列中的次序一致
+///
+class ControlFlowGraph {
+
+public:
+    ///
+    /// @brief 构造函数，由函数当前的指令序列建立控制流图，Dead指令属于所在的块但不参与边的计算
+    /// @param func 函数
+    ///
+    explicit ControlFlowGraph(Function * func);
+
+    ///
+    /// @brief 获取函数
+    /// @return Function* 函数
+    ///
+    [[nodiscard]] Function * getFunction() const
+    {
+        return func;
+    }
+
+    ///
+    /// @brief 获取全部基本块
+    /// @return const std::vector<CFGBlock>& 基本块
+    ///
+    [[nodiscard]] const std::vector<CFGBlock> & getBlocks() const
+    {
+        return blocks;
+    }
+
+    ///
+    /// @brief 基本块个数
+    /// @return uint32_t 基本块个数
+    ///
+    [[nodiscard]] uint32_t size() const
+    {
+        return (uint32_t) blocks.size();
+    }
+
+    ///
+    /// @brief 获取指令序列中第k条指令所在的块
+    /// @param k 指令位置
+    /// @return uint32_t 块编号
+    ///
+    [[nodiscard]] uint32_t getInstBlock(size_t k) const
+    {
+        return instBlock[k];
+    }
+
+    ///
+    /// @brief 入口块可达的块按逆后序排列，不可达的块按原次序排在其后
+    /// @return const std::vector<uint32_t>& 块编号序列
+    ///
+    [[nodiscard]] const std::vector<uint32_t> & getReversePostOrder() const
+    {
+        return rpo;
+    }
+
+private:
+    ///
+    /// @brief 所属函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 基本块
+    ///
+    std::vector<CFGBlock> blocks;
+
+    ///
+    /// @brief 每条指令所在的块
+    ///
+    std::vector<uint32_t> instBlock;
+
+    ///
+    /// @brief 逆后序
+    ///
+    std::vector<uint32_t> rpo;
+};
+
+///
+/// @brief 数据流分析所跟踪的值的稠密编号，编号从0开始连续，便于用位集合表示值的集合。
+/// 跟踪的值依次为非数组的局部变量、内存型Value以及有结果的指令(临时变量)，
+/// 全局变量、形参、常量与数组不跟踪，数组按内存处理，总是认为活跃
+///
+class ValueNumbering {
+
+public:
+    ///
+    /// @brief 构造函数，对函数内的值编号
+    /// @param func 函数
+    ///
+    explicit ValueNumbering(Function * func);
+
+    ///
+    /// @brief 获取值的编号
+    /// @param val 值
+    /// @return int32_t 编号，不跟踪的值为-1
+    ///
+    [[nodiscard]] int32_t getNumber(Value * val) const
+    {
+        auto pIter = numbers.find(val);
+        return pIter == numbers.end() ? -1 : (int32_t) pIter->second;
+    }
+
+    ///
+    /// @brief 获取编号对应的值
+    /// @param n 编号
+    /// @return Value* 值
+    ///
+    [[nodiscard]] Value * getValue(uint32_t n) const
+    {
+        return values[n];
+    }
+
+    ///
+    /// @brief 跟踪的值的个数，即位集合的范围
+    /// @return uint32_t 值的个数
+    ///
+    [[nodiscard]] uint32_t size() const
+    {
+        return (uint32_t) values.size();
+    }
+
+private:
+    ///
+    /// @brief 加入跟踪的值
+    /// @param val 值
+    ///
+    void add(Value * val);
+
+    ///
+    /// @brief 编号到值
+    ///
+    std::vector<Value *> values;
+
+    ///
+    /// @brief 值到编号
+    ///
+    std::unordered_map<Value *, uint32_t> numbers;
+};
+
+///
+/// @brief 数据流分析的方向
+///
+enum class DataFlowDirection : std::int8_t {
+
+    /// @brief 前向，由前驱的out计算in，如到达定值
+    FORWARD,
+
+    /// @brief 后向，由后继的in计算out，如活跃变量
+    BACKWARD,
+};
+
+///
+/// @brief 汇合点的运算
+///
+enum class DataFlowMeet : std::int8_t {
+
+    /// @brief 并集，可能(may)分析
+    UNION,
+
+    /// @brief 交集，必然(must)分析
+    INTERSECT,
+};
+
+///
+/// @brief gen/kill形式的位向量数据流分析框架。派生类在initialize中给出集合的范围以及每个块的gen与kill，
+/// solve按逆后序(后向分析时为其逆序)用工作表迭代到不动点：
+/// 前向时in = meet(前驱的out)，out = gen ∪ (in - kill)；
+/// 后向时out = meet(后继的in)，in = gen ∪ (out - kill)。
+/// 边界块(前向的入口块、后向的无后继的块)的汇合值为空集
+///
+class DataFlowAnalysis {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param func 要分析的函数
+    /// @param _direction 方向
+    /// @param _meet 汇合运算
+    ///
+    DataFlowAnalysis(Function * func, DataFlowDirection _direction, DataFlowMeet _meet);
+
+    ///
+    /// @brief 析构函数
+    ///
+    virtual ~DataFlowAnalysis() = default;
+
+    ///
+    /// @brief 计算gen/kill后迭代求解
+    ///
+    void solve();
+
+    ///
+    /// @brief 获取控制流图
+    /// @return const ControlFlowGraph& 控制流图
+    ///
+    [[nodiscard]] const ControlFlowGraph & getCFG() const
+    {
+        return cfg;
+    }
+
+    ///
+    /// @brief 获取块入口处的集合
+    /// @param b 块编号
+    /// @return const BitSet& 集合
+    ///
+    [[nodiscard]] const BitSet & getIn(uint32_t b) const
+    {
+        return in[b];
+    }
+
+    ///
+    /// @brief 获取块出口处的集合
+    /// @param b 块编号
+    /// @return const BitSet& 集合
+    ///
+    [[nodiscard]] const BitSet & getOut(uint32_t b) const
+    {
+        return out[b];
+    }
+
+    ///
+    /// @brief 迭代求解时处理块的次数，用于观察收敛的快慢
+    /// @return uint32_t 次数
+    ///
+    [[nodiscard]] uint32_t getIterations() const
+    {
+        return iterations;
+    }
+
+protected:
+    ///
+    /// @brief 计算集合的范围以及每个块的gen与kill，需设置universe并填充gen与kill
+    ///
+    virtual void initialize() = 0;
+
+    ///
+    /// @brief 控制流图
+    ///
+    ControlFlowGraph cfg;
+
+    ///
+    /// @brief 集合的范围[0, universe)
+    ///
+    uint32_t universe = 0;
+
+    ///
+    /// @brief 每个块的gen集合
+    ///
+    std::vector<BitSet> gen;
+
+    ///
+    /// @brief 每个块的kill集合
+    ///
+    std::vector<BitSet> kill;
+
+    ///
+    /// @brief 每个块入口处的集合
+    ///
+    std::vector<BitSet> in;
+
+    ///
+    /// @brief 每个块出口处的集合
+    ///
+    std::vector<BitSet> out;
+
+private:
+    ///
+    /// @brief 方向
+    ///
+    DataFlowDirection direction;
+
+    ///
+    /// @brief 汇合运算
+    ///
+    DataFlowMeet meet;
+
+    ///
+    /// @brief 处理块的次数
+    ///
+    uint32_t iterations = 0;
+};
@@ -0,0 +1,113 @@
+///
+/// @file DeadCodeElimPass.cpp
+/// @brief 死代码删除
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+
+#include "Function.h"
+#include "BinaryInstruction.h"
+#include "LocalVariable.h"
+#include "Liveness.h"
+#include "DeadCodeElimPass.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+///
+/// @brief 检查指令结果是否都被Dead指令使用，即删除后不会影响其它指令
+/// @param inst 指令
+/// @return true 没有活跃的使用者
+///
+static bool hasNoLiveUse(Instruction * inst)
+{
+    for (auto use: inst->getUses()) {
+        Instanceof(userInst, Instruction *, use->getUser());
+        if (!userInst || !userInst->isDead()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 标记赋值后不再活跃的局部变量的赋值指令为Dead
+/// @param func 函数
+/// @return true 有指令被标记
+///
+static bool markDeadStores(Function * func)
+{
+    auto & insts = func->getInterCode().getInsts();
+
+    Liveness liveness(func);
+    auto & blocks = liveness.getCFG().getBlocks();
+    auto & numbering = liveness.getNumbering();
+
+    bool marked = false;
+
+    for (uint32_t b = 0; b < liveness.getCFG().size(); ++b) {
+
+        // 从块出口的活跃集合逆序推出每条指令之后的活跃集合
+        BitSet live = liveness.getLiveOut(b);
+
+        for (size_t k = blocks[b].end; k > blocks[b].begin; --k) {
+
+            Instruction * inst = insts[k - 1];
+
+            if ((inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) && !inst->isDead()) {
+
+                // 只删除局部变量的赋值，全局变量在函数外可见，内存型Value由后端产生
+                int32_t def = liveness.getDefNumber(inst);
+                if ((def != -1) && !live.test((uint32_t) def)) {
+
+                    Instanceof(var, LocalVariable *, numbering.getValue((uint32_t) def));
+                    if (var) {
+                        inst->setDead();
+                        marked = true;
+                        continue;
+                    }
+                }
+            }
+
+            liveness.stepBackward(inst, live);
+        }
+    }
+
+    return marked;
+}
+
+///
+/// @brief 对函数执行死代码删除
+/// @param func 要处理的函数
+/// @return true IR被修改
+///
+bool DeadCodeElimPass::runOnFunction(Function * func)
+{
+    auto & insts = func->getInterCode().getInsts();
+
+    bool marked = markDeadStores(func);
+
+    // 使用者总在定义之后，逆序扫描一遍即可把整条无用的计算链都标记为Dead
+    for (auto pIter = insts.rbegin(); pIter != insts.rend(); ++pIter) {
+
+        Instanceof(binInst, BinaryInstruction *, *pIter);
+        if (binInst && !binInst->isDead() && hasNoLiveUse(binInst)) {
+            binInst->setDead();
+            marked = true;
+        }
+    }
+
+    if (!marked) {
+        return false;
+    }
+
+    return func->getInterCode().removeDeadInsts() > 0;
+}
@@ -0,0 +1,39 @@
+///
+/// @file DeadCodeElimPass.h
+/// @brief 死代码删除
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include "Pass.h"
+
+///
+/// @brief 死代码删除：删除结果没有被使用且没有副作用的指令，如算术运算、比较运算；
+/// 借助活跃变量分析删除赋值后不再被使用的局部变量的赋值。
+/// 函数调用可能有副作用，写全局变量或经指针写内存的赋值，均不删除
+///
+class DeadCodeElimPass : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    DeadCodeElimPass() : FunctionPass("dce")
+    {}
+
+    ///
+    /// @brief 对函数执行死代码删除
+    /// @param func 要处理的函数
+    /// @return true IR被修改
+    ///
+    bool runOnFunction(Function * func) override;
+};
@@ -0,0 +1,229 @@
+///
+/// @file IRVerifier.cpp
+/// @brief 线性IR的合法性检查
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "Common.h"
+#include "Module.h"
+#include "Function.h"
+#include "Instruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "IRVerifier.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+///
+/// @brief 对模块进行检查，出错时输出错误信息
+/// @param module 模块
+/// @return false 检查不会修改IR，始终返回false
+///
+bool IRVerifier::runOnModule(Module * module)
+{
+    if (!verifyModule(module)) {
+        minic_log(LOG_ERROR, "IR检查失败：%s", lastError.c_str());
+    }
+
+    return false;
+}
+
+///
+/// @brief 检查模块内的所有函数
+/// @param module 模块
+/// @return true 合法
+/// @return false 不合法
+///
+bool IRVerifier::verifyModule(Module * module)
+{
+    lastError.clear();
+
+    for (auto func: module->getFunctionList()) {
+        if (!verifyFunction(func)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 记录错误信息
+/// @param func 出错的函数
+/// @param msg 错误信息
+/// @return false 便于直接return
+///
+bool IRVerifier::fail(Function * func, const std::string & msg)
+{
+    lastError = "函数" + func->getName() + ": " + msg;
+    return false;
+}
+
+///
+/// @brief 检查单个函数
+/// @param func 函数
+/// @return true 合法
+/// @return false 不合法
+///
+bool IRVerifier::verifyFunction(Function * func)
+{
+    lastError.clear();
+
+    // 内置函数以及复用缓存汇编的函数没有指令
+    if (func->isBuiltin() || func->isCodeReused()) {
+        return true;
+    }
+
+    auto & insts = func->getInterCode().getInsts();
+    if (insts.empty()) {
+        return fail(func, "指令序列为空");
+    }
+
+    if (insts.front()->getOp() != IRInstOperator::IRINST_OP_ENTRY) {
+        return fail(func, "第一条指令不是entry");
+    }
+
+    if (insts.back()->getOp() != IRInstOperator::IRINST_OP_EXIT) {
+        return fail(func, "最后一条指令不是exit");
+    }
+
+    // 函数内现存的所有指令，用于检查操作数与跳转目标
+    std::unordered_set<Instruction *> instSet(insts.begin(), insts.end());
+    if (instSet.size() != insts.size()) {
+        return fail(func, "同一条指令在指令序列中出现多次");
+    }
+
+    for (size_t k = 0; k < insts.size(); ++k) {
+
+        Instruction * inst = insts[k];
+        IRInstOperator op = inst->getOp();
+        std::string pos = "第" + std::to_string(k) + "条指令";
+
+        if (inst->getFunction() != func) {
+            return fail(func, pos + "所属函数不正确");
+        }
+
+        if ((op == IRInstOperator::IRINST_OP_ENTRY) && (k != 0)) {
+            return fail(func, pos + "是多余的entry指令");
+        }
+
+        if ((op == IRInstOperator::IRINST_OP_EXIT) && (k != insts.size() - 1)) {
+            return fail(func, pos + "是多余的exit指令");
+        }
+
+        // 检查def-use边两端的一致性
+        for (auto use: inst->getOperands()) {
+
+            Value * usee = use->getUsee();
+            if (usee == nullptr) {
+                return fail(func, pos + "存在空的操作数");
+            }
+
+            if (use->getUser() != inst) {
+                return fail(func, pos + "操作数的使用者不正确");
+            }
+
+            auto & useeUses = usee->getUses();
+            if (std::find(useeUses.begin(), useeUses.end(), use) == useeUses.end()) {
+                return fail(func, pos + "操作数" + usee->getIRName() + "的define-use链中缺少该边");
+            }
+
+            // 作为操作数的指令必须是本函数内仍然存在的指令
+            if (Instanceof(defInst, Instruction *, usee)) {
+                if (instSet.find(defInst) == instSet.end()) {
+                    return fail(func, pos + "使用了不在本函数指令序列中的指令结果");
+                }
+            }
+        }
+
+        // 指令结果的所有使用者必须仍在本函数中
+        for (auto use: inst->getUses()) {
+            Instanceof(userInst, Instruction *, use->getUser());
+            if (userInst && (instSet.find(userInst) == instSet.end())) {
+                return fail(func, pos + "的结果被已删除的指令使用");
+            }
+        }
+
+        // 各类指令的操作数个数检查
+        int32_t num = inst->getOperandsNum();
+        switch (op) {
+            case IRInstOperator::IRINST_OP_ENTRY:
+            case IRInstOperator::IRINST_OP_LABEL:
+                if (num != 0) {
+                    return fail(func, pos + "不应有操作数");
+                }
+                break;
+            case IRInstOperator::IRINST_OP_EXIT:
+                if (num > 1) {
+                    return fail(func, pos + "exit指令的操作数多于1个");
+                }
+                break;
+            case IRInstOperator::IRINST_OP_NEG_I:
+            case IRInstOperator::IRINST_OP_ARG:
+                if (num != 1) {
+                    return fail(func, pos + "操作数个数应为1");
+                }
+                break;
+            case IRInstOperator::IRINST_OP_ASSIGN:
+            case IRInstOperator::IRINST_OP_ADD_I:
+            case IRInstOperator::IRINST_OP_SUB_I:
+            case IRInstOperator::IRINST_OP_MUL_I:
+            case IRInstOperator::IRINST_OP_DIV_I:
+            case IRInstOperator::IRINST_OP_MOD_I:
+            case IRInstOperator::IRINST_OP_LT_I:
+            case IRInstOperator::IRINST_OP_GT_I:
+            case IRInstOperator::IRINST_OP_LE_I:
+            case IRInstOperator::IRINST_OP_GE_I:
+            case IRInstOperator::IRINST_OP_EQ_I:
+            case IRInstOperator::IRINST_OP_NE_I:
+                if (num != 2) {
+                    return fail(func, pos + "操作数个数应为2");
+                }
+                break;
+            case IRInstOperator::IRINST_OP_GOTO: {
+                Instanceof(gotoInst, GotoInstruction *, inst);
+                if (!gotoInst || (num > 1)) {
+                    return fail(func, pos + "跳转指令不合法");
+                }
+
+                if (instSet.find(gotoInst->getTarget()) == instSet.end()) {
+                    return fail(func, pos + "跳转目标Label不在本函数中");
+                }
+
+                if ((num == 1) && (instSet.find(gotoInst->getFalseTarget()) == instSet.end())) {
+                    return fail(func, pos + "条件跳转的假分支Label不在本函数中");
+                }
+                break;
+            }
+            case IRInstOperator::IRINST_OP_FUNC_CALL: {
+                Instanceof(callInst, FuncCallInstruction *, inst);
+                if (!callInst || !callInst->calledFunction) {
+                    return fail(func, pos + "函数调用缺少被调用函数");
+                }
+
+                // 内置函数可能是变参函数，如putf，不检查实参个数
+                Function * callee = callInst->calledFunction;
+                if (!callee->isBuiltin() && (num != (int32_t) callee->getParams().size())) {
+                    return fail(func, pos + "调用" + callee->getName() + "的实参个数与形参个数不一致");
+                }
+                break;
+            }
+            default:
+                return fail(func, pos + "是未知的指令");
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,94 @@
+///
+/// @file IRVerifier.h
+/// @brief 线性IR的合法性检查
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+
+#include "Pass.h"
+
+///
+/// @brief IR合法性检查，可作为普通的Pass使用，也可由PassManager在每个Pass后自动执行
+///
+/// 检查的内容包括：
+/// (1) 函数的第一条指令是entry，最后一条指令是exit，且各自只有一条
+/// (2) 指令所属函数正确，操作数非空，def-use边两端一致
+/// (3) 作为操作数的指令必须属于同一函数且仍在指令序列中
+/// (4) 跳转目标Label必须在本函数的指令序列中
+/// (5) 各类指令的操作数个数正确
+///
+class IRVerifier : public ModulePass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    IRVerifier() : ModulePass("verify")
+    {}
+
+    ///
+    /// @brief 对模块进行检查，出错时输出错误信息
+    /// @param module 模块
+    /// @return false 检查不会修改IR，始终返回false
+    ///
+    bool runOnModule(Module * module) override;
+
+    ///
+    /// @brief 检查模块内的所有函数
+    /// @param module 模块
+    /// @return true 合法
+    /// @return false 不合法，错误信息可通过getLastError获取
+    ///
+    bool verifyModule(Module * module);
+
+    ///
+    /// @brief 检查单个函数
+    /// @param func 函数
+    /// @return true 合法
+    /// @return false 不合法，错误信息可通过getLastError获取
+    ///
+    bool verifyFunction(Function * func);
+
+    ///
+    /// @brief 获取最近一次检查失败的原因
+    /// @return const std::string&
+    ///
+    [[nodiscard]] const std::string & getLastError() const
+    {
+        return lastError;
+    }
+
+    ///
+    /// @brief 最近一次检查是否通过
+    /// @return true 通过
+    ///
+    [[nodiscard]] bool isValid() const
+    {
+        return lastError.empty();
+    }
+
+private:
+    ///
+    /// @brief 记录错误信息
+    /// @param func 出错的函数
+    /// @param msg 错误信息
+    /// @return false 便于直接return
+    ///
+    bool fail(Function * func, const std::string & msg);
+
+    ///
+    /// @brief 最近一次检查失败的原因，为空则表示通过
+    ///
+    std::string lastError;
+};
@@ -0,0 +1,90 @@
+///
+/// @file Liveness.cpp
+/// @brief 活跃变量分析
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include "Function.h"
+#include "MoveInstruction.h"
+#include "Liveness.h"
+
+Liveness::Liveness(Function * func)
+    : DataFlowAnalysis(func, DataFlowDirection::BACKWARD, DataFlowMeet::UNION), numbering(func)
+{
+    solve();
+}
+
+bool Liveness::isDefOperand(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_ASSIGN) {
+        return false;
+    }
+
+    // 指针存储写的是指针指向的内存，指针本身是使用
+    return !static_cast<MoveInstruction *>(inst)->getIsPointerStore();
+}
+
+Value * Liveness::getDef(Instruction * inst)
+{
+    if (inst->hasResultValue()) {
+        return inst;
+    }
+
+    return isDefOperand(inst) ? inst->getOperand(0) : nullptr;
+}
+
+void Liveness::stepBackward(Instruction * inst, BitSet & live) const
+{
+    if (inst->isDead()) {
+        return;
+    }
+
+    int32_t def = getDefNumber(inst);
+    if (def != -1) {
+        live.reset((uint32_t) def);
+    }
+
+    forEachUse(inst, [&live](uint32_t n) { live.set(n); });
+}
+
+void Liveness::initialize()
+{
+    universe = numbering.size();
+
+    auto & insts = cfg.getFunction()->getInterCode().getInsts();
+    auto & blocks = cfg.getBlocks();
+
+    for (uint32_t b = 0; b < cfg.size(); ++b) {
+
+        BitSet & blockGen = gen[b];
+        BitSet & blockKill = kill[b];
+
+        blockGen.resize(universe);
+        blockKill.resize(universe);
+
+        // 逆序扫描，定值之前的使用才是向上暴露的使用
+        for (size_t k = blocks[b].end; k > blocks[b].begin; --k) {
+
+            Instruction * inst = insts[k - 1];
+            if (inst->isDead()) {
+                continue;
+            }
+
+            int32_t def = getDefNumber(inst);
+            if (def != -1) {
+                blockKill.set((uint32_t) def);
+                blockGen.reset((uint32_t) def);
+            }
+
+            forEachUse(inst, [&blockGen](uint32_t n) { blockGen.set(n); });
+        }
+    }
+}
@@ -0,0 +1,125 @@
+///
+/// @file Liveness.h
+/// @brief 活跃变量分析
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include "DataFlow.h"
+#include "Instruction.h"
+
+///
+/// @brief 活跃变量分析：后向、并集的数据流分析，集合元素为ValueNumbering的编号。
+/// 块的gen为块内先使用后定值的值，kill为块内定值的值。
+/// 赋值指令定值其目的操作数，指针存储(*p = v)时目的操作数p是使用；有结果的指令定值其自身。
+/// 构造时即完成分析，块内各指令处的活跃集合可从块出口的集合用stepBackward逆序推出，
+/// 供寄存器分配、栈槽复用以及死代码删除使用
+///
+class Liveness : public DataFlowAnalysis {
+
+public:
+    ///
+    /// @brief 构造函数，对函数进行活跃变量分析
+    /// @param func 函数
+    ///
+    explicit Liveness(Function * func);
+
+    ///
+    /// @brief 获取值编号
+    /// @return const ValueNumbering& 值编号
+    ///
+    [[nodiscard]] const ValueNumbering & getNumbering() const
+    {
+        return numbering;
+    }
+
+    ///
+    /// @brief 块入口处活跃的值
+    /// @param b 块编号
+    /// @return const BitSet& 值编号的集合
+    ///
+    [[nodiscard]] const BitSet & getLiveIn(uint32_t b) const
+    {
+        return getIn(b);
+    }
+
+    ///
+    /// @brief 块出口处活跃的值
+    /// @param b 块编号
+    /// @return const BitSet& 值编号的集合
+    ///
+    [[nodiscard]] const BitSet & getLiveOut(uint32_t b) const
+    {
+        return getOut(b);
+    }
+
+    ///
+    /// @brief 获取指令定值的值
+    /// @param inst 指令
+    /// @return Value* 定值的值，没有时为nullptr，该值不一定被跟踪
+    ///
+    static Value * getDef(Instruction * inst);
+
+    ///
+    /// @brief 获取指令定值的值的编号
+    /// @param inst 指令
+    /// @return int32_t 编号，没有定值或不跟踪时为-1
+    ///
+    [[nodiscard]] int32_t getDefNumber(Instruction * inst) const
+    {
+        Value * def = getDef(inst);
+        return def ? numbering.getNumber(def) : -1;
+    }
+
+    ///
+    /// @brief 访问指令使用的被跟踪的值的编号，同一值可能访问多次
+    /// @param inst 指令
+    /// @param fn 访问函数，参数为编号
+    ///
+    template <typename Fn>
+    void forEachUse(Instruction * inst, Fn fn) const
+    {
+        int32_t operandsNum = inst->getOperandsNum();
+        for (int32_t k = isDefOperand(inst) ? 1 : 0; k < operandsNum; ++k) {
+            int32_t n = numbering.getNumber(inst->getOperand(k));
+            if (n != -1) {
+                fn((uint32_t) n);
+            }
+        }
+    }
+
+    ///
+    /// @brief 由指令之后的活跃集合推出指令之前的活跃集合，即live = (live - def) ∪ use
+    /// @param inst 指令，Dead指令不改变集合
+    /// @param live 活跃集合
+    ///
+    void stepBackward(Instruction * inst, BitSet & live) const;
+
+protected:
+    ///
+    /// @brief 计算每个块的gen与kill
+    ///
+    void initialize() override;
+
+private:
+    ///
+    /// @brief 指令的第0个操作数是否为定值的目的操作数
+    /// @param inst 指令
+    /// @return true 是
+    ///
+    static bool isDefOperand(Instruction * inst);
+
+    ///
+    /// @brief 值编号
+    ///
+    ValueNumbering numbering;
+};
@@ -0,0 +1,141 @@
+///
+/// @file Pass.h
+/// @brief 中间IR优化遍(Pass)的基类定义
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+class Module;
+class Function;
+
+///
+/// @brief Pass的种类
+///
+enum class PassKind : std::int8_t {
+
+    /// @brief 以函数为单位执行的Pass，内置函数不会被处理
+    FUNCTION_PASS,
+
+    /// @brief 以整个Module为单位执行的Pass
+    MODULE_PASS,
+};
+
+///
+/// @brief 所有优化遍的基类
+///
+class Pass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _name Pass的名字，用于--passes=指定以及统计输出
+    /// @param _kind Pass的种类
+    ///
+    Pass(std::string _name, PassKind _kind) : name(std::move(_name)), kind(_kind)
+    {}
+
+    ///
+    /// @brief 析构函数
+    ///
+    virtual ~Pass() = default;
+
+    ///
+    /// @brief 获取Pass的名字
+    /// @return const std::string&
+    ///
+    [[nodiscard]] const std::string & getName() const
+    {
+        return name;
+    }
+
+    ///
+    /// @brief 获取Pass的种类
+    /// @return PassKind
+    ///
+    [[nodiscard]] PassKind getKind() const
+    {
+        return kind;
+    }
+
+    ///
+    /// @brief 设置Pass所处理的Module，由PassManager在执行前设置
+    /// @param _module 模块
+    ///
+    void setModule(Module * _module)
+    {
+        module = _module;
+    }
+
+protected:
+    ///
+    /// @brief Pass的名字
+    ///
+    std::string name;
+
+    ///
+    /// @brief Pass的种类
+    ///
+    PassKind kind;
+
+    ///
+    /// @brief 当前处理的Module，如常量折叠需要借助Module创建常量
+    ///
+    Module * module = nullptr;
+};
+
+///
+/// @brief 函数级的Pass，对每个用户自定义函数分别执行
+///
+class FunctionPass : public Pass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _name Pass的名字
+    ///
+    explicit FunctionPass(std::string _name) : Pass(std::move(_name), PassKind::FUNCTION_PASS)
+    {}
+
+    ///
+    /// @brief 对函数执行该Pass
+    /// @param func 要处理的函数
+    /// @return true IR被修改
+    /// @return false IR没有修改
+    ///
+    virtual bool runOnFunction(Function * func) = 0;
+};
+
+///
+/// @brief 模块级的Pass，对整个Module执行一次
+///
+class ModulePass : public Pass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _name Pass的名字
+    ///
+    explicit ModulePass(std::string _name) : Pass(std::move(_name), PassKind::MODULE_PASS)
+    {}
+
+    ///
+    /// @brief 对模块执行该Pass
+    /// @param module 要处理的模块
+    /// @return true IR被修改
+    /// @return false IR没有修改
+    ///
+    virtual bool runOnModule(Module * module) = 0;
+};
@@ -0,0 +1,312 @@
+///
+/// @file PassManager.cpp
+/// @brief 中间IR优化遍的管理，负责Pass的注册、流水线构建、执行、计时与IR检查
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+
+#include <chrono>
+#include <sstream>
+
+#include "Common.h"
+#include "CompileReport.h"
+#include "Module.h"
+#include "PassManager.h"
+#include "ConstFoldPass.h"
+#include "DeadCodeElimPass.h"
+#include "SimplifyCFGPass.h"
+#include "BlockLayoutPass.h"
+
+///
+/// @brief 构造函数
+/// @param _module 要优化的模块
+///
+PassManager::PassManager(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 析构函数，释放管理的Pass
+///
+PassManager::~PassManager()
+{
+    for (auto pass: pipeline) {
+        delete pass;
+    }
+
+    pipeline.clear();
+}
+
+///
+/// @brief 获取所有注册的Pass，新增Pass时在这里追加
+/// @return const std::vector<PassInfo>&
+///
+const std::vector<PassInfo> & PassManager::getRegisteredPasses()
+{
+    static const std::vector<PassInfo> registry = {
+        {"constfold", "常量折叠，常量条件的条件跳转变为无条件跳转", []() -> Pass * { return new ConstFoldPass(); }},
+        {"dce", "删除结果无用且无副作用的指令以及不再活跃的局部变量赋值", []() -> Pass * { return new DeadCodeElimPass(); }},
+        {"simplifycfg", "删除不可达指令以及跳转到下一条指令的跳转", []() -> Pass * { return new SimplifyCFGPass(); }},
+        {"blocklayout", "按--profile-use的执行次数布局基本块，热路径顺序执行", []() -> Pass * { return new BlockLayoutPass(); }},
+        {"verify", "IR合法性检查", []() -> Pass * { return new IRVerifier(); }},
+    };
+
+    return registry;
+}
+
+///
+/// @brief 根据名字创建已注册的Pass
+/// @param name Pass名
+/// @return Pass* 未注册时返回空指针
+///
+Pass * PassManager::createPass(const std::string & name)
+{
+    for (auto & info: getRegisteredPasses()) {
+        if (name == info.name) {
+            return info.create();
+        }
+    }
+
+    return nullptr;
+}
+
+///
+/// @brief 输出所有注册的Pass及描述
+/// @param fp 输出文件
+///
+void PassManager::printRegisteredPasses(FILE * fp)
+{
+    for (auto & info: getRegisteredPasses()) {
+        fprintf(fp, "  %-16s %s\n", info.name, info.description);
+    }
+}
+
+///
+/// @brief 追加Pass，所有权转移给PassManager
+/// @param pass Pass对象
+///
+void PassManager::addPass(Pass * pass)
+{
+    pipeline.push_back(pass);
+}
+
+///
+/// @brief 按名字追加已注册的Pass
+/// @param name Pass名
+/// @return true 成功
+/// @return false Pass未注册
+///
+bool PassManager::addPass(const std::string & name)
+{
+    Pass * pass = createPass(name);
+    if (!pass) {
+        minic_log(LOG_ERROR, "未知的Pass: %s", name.c_str());
+        return false;
+    }
+
+    addPass(pass);
+
+    return true;
+}
+
+///
+/// @brief 根据优化级别构建缺省的Pass流水线
+/// @param level 优化级别，0~3，大于3时按3处理
+///
+void PassManager::buildPipeline(int level)
+{
+    // -O0不做任何优化
+    if (level <= 0) {
+        return;
+    }
+
+    // -O1：局部的常量折叠与死代码删除，再删除不可达代码
+    addPass("constfold");
+    addPass("dce");
+    addPass("simplifycfg");
+
+    if (level == 1) {
+        return;
+    }
+
+    // -O2：有剖析数据时按执行次数布局基本块，再删除布局后跳转到下一条指令的跳转；
+    // 控制流简化后可能出现新的无用指令
+    addPass("blocklayout");
+    addPass("simplifycfg");
+    addPass("dce");
+
+    if (level == 2) {
+        return;
+    }
+
+    // -O3：再迭代一轮
+    addPass("constfold");
+    addPass("simplifycfg");
+    addPass("dce");
+}
+
+///
+/// @brief 根据逗号分隔的Pass名字构建自定义流水线，如constfold,dce
+/// @param passes Pass名字列表
+/// @return true 成功
+/// @return false 存在未注册的Pass名字
+///
+bool PassManager::parsePipeline(const std::string & passes)
+{
+    std::stringstream ss(passes);
+    std::string name;
+
+    while (std::getline(ss, name, ',')) {
+
+        name = trim(name);
+        if (name.empty()) {
+            continue;
+        }
+
+        if (!addPass(name)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 获取名字对应的统计项，没有时新建
+/// @param name Pass名字
+/// @return PassStat&
+///
+PassStat & PassManager::getStat(const std::string & name)
+{
+    for (auto & stat: stats) {
+        if (stat.name == name) {
+            return stat;
+        }
+    }
+
+    stats.emplace_back();
+    stats.back().name = name;
+
+    return stats.back();
+}
+
+///
+/// @brief 执行单个Pass
+/// @param pass Pass对象
+/// @return true IR被修改
+///
+bool PassManager::runPass(Pass * pass)
+{
+    bool changed = false;
+
+    pass->setModule(module);
+
+    if (pass->getKind() == PassKind::MODULE_PASS) {
+        changed = static_cast<ModulePass *>(pass)->runOnModule(module);
+    } else {
+        auto funcPass = static_cast<FunctionPass *>(pass);
+        for (auto func: module->getFunctionList()) {
+            if (!func->isBuiltin() && !func->isCodeReused()) {
+                changed |= funcPass->runOnFunction(func);
+            }
+        }
+    }
+
+    return changed;
+}
+
+///
+/// @brief 执行IR检查
+/// @param after 刚执行完的Pass名字，用于错误信息
+/// @return true 检查通过
+///
+bool PassManager::verify(const std::string & after)
+{
+    if (verifier.verifyModule(module)) {
+        return true;
+    }
+
+    minic_log(LOG_ERROR, "Pass(%s)执行后IR检查失败：%s", after.c_str(), verifier.getLastError().c_str());
+
+    return false;
+}
+
+///
+/// @brief 按顺序执行流水线中的所有Pass
+/// @return true 成功
+/// @return false IR检查失败
+///
+bool PassManager::run()
+{
+    // 先检查前端产生的IR，避免把前端的问题归咎于第一个Pass
+    if (verifyEach && !verify("irgen")) {
+        return false;
+    }
+
+    for (auto pass: pipeline) {
+
+        auto startTime = std::chrono::steady_clock::now();
+        long startRss = timePasses ? CompileReport::getPeakRssKB() : 0;
+
+        bool changed = runPass(pass);
+
+        PassStat & stat = getStat(pass->getName());
+        stat.runs++;
+        stat.changes += changed ? 1 : 0;
+
+        if (timePasses) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+            stat.wallSeconds += elapsed.count();
+            stat.peakRssDeltaKB += CompileReport::getPeakRssKB() - startRss;
+        }
+
+        // 显式指定的verify Pass检查失败同样终止
+        auto verifyPass = dynamic_cast<IRVerifier *>(pass);
+        if (verifyPass && !verifyPass->isValid()) {
+            return false;
+        }
+
+        if (verifyEach && !verify(pass->getName())) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 输出每个Pass的执行时间与内存统计
+/// @param fp 输出文件
+///
+void PassManager::printTimeReport(FILE * fp)
+{
+    double total = 0;
+    for (auto & stat: stats) {
+        total += stat.wallSeconds;
+    }
+
+    fprintf(fp, "===---------------------------------------------------------===\n");
+    fprintf(fp, "                  Pass execution timing report\n");
+    fprintf(fp, "===---------------------------------------------------------===\n");
+    fprintf(fp, "  Total Execution Time: %.6f seconds\n\n", total);
+    fprintf(fp, "  %-16s %6s %8s %12s %8s %14s\n", "Pass", "Runs", "Changed", "Wall(s)", "Wall(%)", "PeakRSS+(KB)");
+
+    for (auto & stat: stats) {
+        double percent = total > 0 ? stat.wallSeconds * 100.0 / total : 0.0;
+        fprintf(fp,
+                "  %-16s %6d %8d %12.6f %7.1f%% %14ld\n",
+                stat.name.c_str(),
+                stat.runs,
+                stat.changes,
+                stat.wallSeconds,
+                percent,
+                stat.peakRssDeltaKB);
+    }
+}
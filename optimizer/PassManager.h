@@ -0,0 +1,208 @@
+///
+/// @file PassManager.h
+/// @brief 中间IR优化遍的管理，负责Pass的注册、流水线构建、执行、计时与IR检查
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Pass.h"
+#include "IRVerifier.h"
+
+class Module;
+
+///
+/// @brief 注册的Pass信息
+///
+struct PassInfo {
+
+    /// @brief Pass的名字，--passes=中使用
+    const char * name;
+
+    /// @brief Pass的功能描述
+    const char * description;
+
+    /// @brief 创建Pass对象的工厂函数
+    Pass * (*create)();
+};
+
+///
+/// @brief 单个Pass的执行统计
+///
+struct PassStat {
+
+    /// @brief Pass的名字
+    std::string name;
+
+    /// @brief 执行次数
+    int32_t runs = 0;
+
+    /// @brief 修改IR的次数
+    int32_t changes = 0;
+
+    /// @brief 累计的墙钟时间，单位秒
+    double wallSeconds = 0;
+
+    /// @brief 累计的驻留内存峰值增量，单位KB
+    long peakRssDeltaKB = 0;
+};
+
+///
+/// @brief Pass管理器，按顺序对Module执行一组Pass
+///
+class PassManager {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要优化的模块
+    ///
+    explicit PassManager(Module * _module);
+
+    ///
+    /// @brief 析构函数，释放管理的Pass
+    ///
+    ~PassManager();
+
+    ///
+    /// @brief 获取所有注册的Pass
+    /// @return const std::vector<PassInfo>&
+    ///
+    static const std::vector<PassInfo> & getRegisteredPasses();
+
+    ///
+    /// @brief 根据名字创建已注册的Pass
+    /// @param name Pass名
+    /// @return Pass* 未注册时返回空指针
+    ///
+    static Pass * createPass(const std::string & name);
+
+    ///
+    /// @brief 输出所有注册的Pass及描述
+    /// @param fp 输出文件
+    ///
+    static void printRegisteredPasses(FILE * fp);
+
+    ///
+    /// @brief 追加Pass，所有权转移给PassManager
+    /// @param pass Pass对象
+    ///
+    void addPass(Pass * pass);
+
+    ///
+    /// @brief 按名字追加已注册的Pass
+    /// @param name Pass名
+    /// @return true 成功
+    /// @return false Pass未注册
+    ///
+    bool addPass(const std::string & name);
+
+    ///
+    /// @brief 根据优化级别构建缺省的Pass流水线
+    /// @param level 优化级别，0~3，大于3时按3处理
+    ///
+    void buildPipeline(int level);
+
+    ///
+    /// @brief 根据逗号分隔的Pass名字构建自定义流水线，如constfold,dce
+    /// @param passes Pass名字列表
+    /// @return true 成功
+    /// @return false 存在未注册的Pass名字
+    ///
+    bool parsePipeline(const std::string & passes);
+
+    ///
+    /// @brief 设置是否统计每个Pass的执行时间与内存
+    /// @param enable 是否开启
+    ///
+    void setTimePasses(bool enable)
+    {
+        timePasses = enable;
+    }
+
+    ///
+    /// @brief 设置是否在每个Pass执行之后进行IR检查
+    /// @param enable 是否开启
+    ///
+    void setVerifyEach(bool enable)
+    {
+        verifyEach = enable;
+    }
+
+    ///
+    /// @brief 按顺序执行流水线中的所有Pass
+    /// @return true 成功
+    /// @return false IR检查失败
+    ///
+    bool run();
+
+    ///
+    /// @brief 输出每个Pass的执行时间与内存统计
+    /// @param fp 输出文件
+    ///
+    void printTimeReport(FILE * fp);
+
+private:
+    ///
+    /// @brief 执行单个Pass
+    /// @param pass Pass对象
+    /// @return true IR被修改
+    ///
+    bool runPass(Pass * pass);
+
+    ///
+    /// @brief 执行IR检查
+    /// @param after 刚执行完的Pass名字，用于错误信息
+    /// @return true 检查通过
+    ///
+    bool verify(const std::string & after);
+
+    ///
+    /// @brief 获取名字对应的统计项，没有时新建
+    /// @param name Pass名字
+    /// @return PassStat&
+    ///
+    PassStat & getStat(const std::string & name);
+
+    ///
+    /// @brief 要优化的模块
+    ///
+    Module * module;
+
+    ///
+    /// @brief Pass流水线
+    ///
+    std::vector<Pass *> pipeline;
+
+    ///
+    /// @brief 每个Pass的统计，按首次执行的次序排列
+    ///
+    std::vector<PassStat> stats;
+
+    ///
+    /// @brief IR检查器
+    ///
+    IRVerifier verifier;
+
+    ///
+    /// @brief 是否统计执行时间与内存
+    ///
+    bool timePasses = false;
+
+    ///
+    /// @brief 每个Pass之后是否进行IR检查
+    ///
+    bool verifyEach = false;
+};
@@ -0,0 +1,171 @@
+///
+/// @file ProfileData.cpp
+/// @brief 剖析反馈优化(PGO)的插桩点布局以及剖析数据文件的读写
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <cstdio>
+
+#include "Module.h"
+#include "Function.h"
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "ProfileData.h"
+
+///
+/// @brief FNV-1a散列，用于计算插桩点布局的校验和
+/// @param hash 当前散列值
+/// @param data 数据
+/// @param size 字节数
+/// @return uint32_t 新的散列值
+///
+static uint32_t fnv1a(uint32_t hash, const void * data, size_t size)
+{
+    auto bytes = static_cast<const unsigned char *>(data);
+    for (size_t k = 0; k < size; ++k) {
+        hash = (hash ^ bytes[k]) * 16777619u;
+    }
+
+    return hash;
+}
+
+///
+/// @brief 按函数以及指令的次序收集模块内的所有插桩点
+/// @param module 模块
+/// @param sites 插桩点
+/// @return uint32_t 插桩点布局的校验和
+///
+uint32_t ProfileData::collectSites(Module * module, std::vector<ProfileSite> & sites)
+{
+    uint32_t hash = 2166136261u;
+
+    sites.clear();
+
+    for (auto func: module->getFunctionList()) {
+
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        // 函数名以及各插桩点的种类参与校验和
+        const std::string & name = func->getName();
+        hash = fnv1a(hash, name.c_str(), name.size() + 1);
+
+        for (auto inst: func->getInterCode().getInsts()) {
+
+            if (inst->isDead()) {
+                continue;
+            }
+
+            char kind = 0;
+
+            IRInstOperator op = inst->getOp();
+            if ((op == IRInstOperator::IRINST_OP_ENTRY) || (op == IRInstOperator::IRINST_OP_LABEL)) {
+                kind = 'B';
+            } else if ((op == IRInstOperator::IRINST_OP_GOTO) && (inst->getOperandsNum() == 1)) {
+                kind = 'E';
+            }
+
+            if (kind) {
+                sites.push_back(ProfileSite{func, inst});
+                hash = fnv1a(hash, &kind, 1);
+            }
+        }
+    }
+
+    return hash;
+}
+
+///
+/// @brief 根据Label与函数上的剖析数据得到每条指令的执行次数，与指令序列一一对应
+/// @param func 带有剖析数据的函数
+/// @param counts 执行次数
+///
+void ProfileData::getInstCounts(Function * func, std::vector<uint64_t> & counts)
+{
+    auto & insts = func->getInterCode().getInsts();
+
+    counts.assign(insts.size(), 0);
+
+    // 基本块内的指令与块首的Label执行次数相同
+    uint64_t current = func->getEntryCount();
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if (insts[k]->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            current = static_cast<LabelInstruction *>(insts[k])->getProfileCount();
+        }
+
+        counts[k] = current;
+    }
+}
+
+///
+/// @brief 读入剖析数据文件
+/// @param filename 文件名
+/// @return true 成功
+/// @return false 失败，错误信息通过getLastError获取
+///
+bool ProfileData::read(const std::string & filename)
+{
+    FILE * fp = fopen(filename.c_str(), "rb");
+    if (nullptr == fp) {
+        lastError = "文件(" + filename + ")打开失败";
+        return false;
+    }
+
+    uint32_t header[4] = {0, 0, 0, 0};
+    bool result = fread(header, sizeof(uint32_t), 4, fp) == 4;
+
+    if (!result || (header[0] != MAGIC)) {
+        lastError = "文件(" + filename + ")不是剖析数据文件";
+    } else if (header[1] != VERSION) {
+        lastError = "文件(" + filename + ")的版本" + std::to_string(header[1]) + "不支持";
+        result = false;
+    } else {
+        checksum = header[2];
+        counts.assign(header[3], 0);
+
+        result = fread(counts.data(), sizeof(uint32_t), counts.size(), fp) == counts.size();
+        if (!result) {
+            lastError = "文件(" + filename + ")被截断";
+        }
+    }
+
+    fclose(fp);
+
+    return result;
+}
+
+///
+/// @brief 写出剖析数据文件
+/// @param filename 文件名
+/// @return true 成功
+/// @return false 失败，错误信息通过getLastError获取
+///
+bool ProfileData::write(const std::string & filename)
+{
+    FILE * fp = fopen(filename.c_str(), "wb");
+    if (nullptr == fp) {
+        lastError = "文件(" + filename + ")打开失败";
+        return false;
+    }
+
+    uint32_t header[4] = {MAGIC, VERSION, checksum, (uint32_t) counts.size()};
+
+    bool result = fwrite(header, sizeof(uint32_t), 4, fp) == 4;
+    result = result && (fwrite(counts.data(), sizeof(uint32_t), counts.size(), fp) == counts.size());
+    result = (fclose(fp) == 0) && result;
+
+    if (!result) {
+        lastError = "文件(" + filename + ")写入失败";
+    }
+
+    return result;
+}
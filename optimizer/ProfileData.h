@@ -0,0 +1,130 @@
+///
+/// @file ProfileData.h
+/// @brief 剖析反馈优化(PGO)的插桩点布局以及剖析数据文件的读写
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Module;
+class Function;
+class Instruction;
+
+///
+/// @brief 插桩点，每个插桩点对应一个计数器
+///
+struct ProfileSite {
+
+    /// @brief 所在函数
+    Function * func;
+
+    /// @brief 基本块的首指令(entry或者Label)统计块的执行次数；条件跳转指令统计走真分支的次数
+    Instruction * inst;
+};
+
+///
+/// @brief 剖析数据。文件由若干32位小端整数组成：
+/// 魔数、版本、插桩点布局的校验和、计数器个数，之后依次是各计数器的值。
+/// 插桩与使用剖析数据时都在-O流水线之前按同样的次序收集插桩点，
+/// 因此同一源程序的计数器编号一致，校验和用于发现源程序或编译器已经变化的情形。
+///
+class ProfileData {
+
+public:
+    /// @brief 文件魔数，即"MPRF"
+    static constexpr uint32_t MAGIC = 0x4650524D;
+
+    /// @brief 文件格式版本
+    static constexpr uint32_t VERSION = 1;
+
+    /// @brief 计数器全局变量名的前缀
+    static constexpr const char * COUNTER_PREFIX = "__minic_prof_";
+
+    /// @brief 缺省的剖析数据文件名
+    static constexpr const char * DEFAULT_FILE = "minic.profdata";
+
+    ///
+    /// @brief 按函数以及指令的次序收集模块内的所有插桩点
+    /// @param module 模块
+    /// @param sites 插桩点
+    /// @return uint32_t 插桩点布局的校验和
+    ///
+    static uint32_t collectSites(Module * module, std::vector<ProfileSite> & sites);
+
+    ///
+    /// @brief 根据Label与函数上的剖析数据得到每条指令的执行次数，与指令序列一一对应
+    /// @param func 带有剖析数据的函数
+    /// @param counts 执行次数
+    ///
+    static void getInstCounts(Function * func, std::vector<uint64_t> & counts);
+
+    ///
+    /// @brief 读入剖析数据文件
+    /// @param filename 文件名
+    /// @return true 成功
+    /// @return false 失败，错误信息通过getLastError获取
+    ///
+    bool read(const std::string & filename);
+
+    ///
+    /// @brief 写出剖析数据文件
+    /// @param filename 文件名
+    /// @return true 成功
+    /// @return false 失败，错误信息通过getLastError获取
+    ///
+    bool write(const std::string & filename);
+
+    ///
+    /// @brief 获取插桩点布局的校验和
+    /// @return uint32_t 校验和
+    ///
+    [[nodiscard]] uint32_t getChecksum() const
+    {
+        return checksum;
+    }
+
+    ///
+    /// @brief 设置插桩点布局的校验和
+    /// @param _checksum 校验和
+    ///
+    void setChecksum(uint32_t _checksum)
+    {
+        checksum = _checksum;
+    }
+
+    ///
+    /// @brief 获取计数器的值
+    /// @return std::vector<uint32_t>&
+    ///
+    std::vector<uint32_t> & getCounts()
+    {
+        return counts;
+    }
+
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+private:
+    /// @brief 插桩点布局的校验和
+    uint32_t checksum = 0;
+
+    /// @brief 计数器的值，按编号排列
+    std::vector<uint32_t> counts;
+
+    /// @brief 错误信息
+    std::string lastError;
+};
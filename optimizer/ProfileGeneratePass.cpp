@@ -0,0 +1,114 @@
+///
+/// @file ProfileGeneratePass.cpp
+/// @brief 剖析反馈优化(PGO)的计数器插桩
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <unordered_map>
+#include <vector>
+
+#include "Common.h"
+#include "Module.h"
+#include "Function.h"
+#include "IntegerType.h"
+#include "BinaryInstruction.h"
+#include "MoveInstruction.h"
+#include "ProfileData.h"
+#include "ProfileGeneratePass.h"
+
+///
+/// @brief 产生计数器加上指定值的指令，即%t = add @c, step; @c = %t
+/// @param func 所在函数
+/// @param counter 计数器
+/// @param step 增加的值
+/// @param insts 指令追加到该序列
+///
+static void emitIncrement(Function * func, GlobalVariable * counter, Value * step, std::vector<Instruction *> & insts)
+{
+    auto addInst =
+        new BinaryInstruction(func, IRInstOperator::IRINST_OP_ADD_I, counter, step, IntegerType::getTypeInt());
+
+    insts.push_back(addInst);
+    insts.push_back(new MoveInstruction(func, counter, addInst));
+}
+
+///
+/// @brief 对模块的所有函数插桩
+/// @param module 模块
+/// @return true IR被修改
+///
+bool ProfileGeneratePass::runOnModule(Module * module)
+{
+    std::vector<ProfileSite> sites;
+    uint32_t checksum = ProfileData::collectSites(module, sites);
+
+    if (sites.empty()) {
+        return false;
+    }
+
+    // 在全局作用域中创建计数器，插桩点到计数器的映射
+    module->setCurrentFunction(nullptr);
+
+    std::vector<GlobalVariable *> counters;
+    std::unordered_map<Instruction *, GlobalVariable *> siteCounter;
+
+    for (size_t k = 0; k < sites.size(); ++k) {
+
+        std::string counterName = ProfileData::COUNTER_PREFIX + std::to_string(k);
+
+        auto counter = static_cast<GlobalVariable *>(module->newVarValue(IntegerType::getTypeInt(), counterName));
+        if (!counter) {
+            minic_log(LOG_ERROR, "插桩的计数器%s与已有的全局变量重名", counterName.c_str());
+            return false;
+        }
+
+        counters.push_back(counter);
+        siteCounter[sites[k].inst] = counter;
+    }
+
+    ConstInt * one = module->newConstInt(1);
+
+    for (auto func: module->getFunctionList()) {
+
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        auto & insts = func->getInterCode().getInsts();
+
+        std::vector<Instruction *> newInsts;
+        newInsts.reserve(insts.size() * 2);
+
+        for (auto inst: insts) {
+
+            auto pIter = siteCounter.find(inst);
+            if (pIter == siteCounter.end()) {
+                newInsts.push_back(inst);
+            } else if (inst->getOp() == IRInstOperator::IRINST_OP_GOTO) {
+
+                // 条件值为0或1，直接累加，不需要拆分跳转边
+                emitIncrement(func, pIter->second, inst->getOperand(0), newInsts);
+                newInsts.push_back(inst);
+            } else {
+
+                // 块计数器放在entry或者Label之后
+                newInsts.push_back(inst);
+                emitIncrement(func, pIter->second, one, newInsts);
+            }
+        }
+
+        insts.swap(newInsts);
+    }
+
+    module->setProfileCounters(counters, checksum, file);
+
+    return true;
+}
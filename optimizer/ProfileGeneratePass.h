@@ -0,0 +1,50 @@
+///
+/// @file ProfileGeneratePass.h
+/// @brief 剖析反馈优化(PGO)的计数器插桩
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "Pass.h"
+
+///
+/// @brief 计数器插桩，由--profile-generate在-O流水线之前执行：
+/// (1) 每个基本块的开始处块计数器加1，entry所在块的计数即函数的调用次数
+/// (2) 每个条件跳转之前边计数器加上条件值，即走真分支的次数，假分支的次数为块计数减去该值
+/// 计数器为全局变量，后端把它们输出为连续的数组，并在程序退出时写入剖析数据文件
+///
+class ProfileGeneratePass : public ModulePass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _file 程序退出时计数器写入的文件
+    ///
+    explicit ProfileGeneratePass(std::string _file) : ModulePass("profile-generate"), file(std::move(_file))
+    {}
+
+    ///
+    /// @brief 对模块的所有函数插桩
+    /// @param module 模块
+    /// @return true IR被修改
+    ///
+    bool runOnModule(Module * module) override;
+
+private:
+    ///
+    /// @brief 计数器写入的文件
+    ///
+    std::string file;
+};
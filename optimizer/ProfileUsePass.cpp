@@ -0,0 +1,65 @@
+///
+/// @file ProfileUsePass.cpp
+/// @brief 剖析反馈优化(PGO)的剖析数据读入与标注
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <vector>
+
+#include "Common.h"
+#include "Module.h"
+#include "Function.h"
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "ProfileData.h"
+#include "ProfileUsePass.h"
+
+///
+/// @brief 读入剖析数据并标注到IR上
+/// @param module 模块
+/// @return false 只标注执行次数，IR没有修改
+///
+bool ProfileUsePass::runOnModule(Module * module)
+{
+    ProfileData profile;
+    if (!profile.read(file)) {
+        minic_log(LOG_ERROR, "剖析数据读入失败，忽略：%s", profile.getLastError().c_str());
+        return false;
+    }
+
+    std::vector<ProfileSite> sites;
+    uint32_t checksum = ProfileData::collectSites(module, sites);
+
+    auto & counts = profile.getCounts();
+    if ((checksum != profile.getChecksum()) || (sites.size() != counts.size())) {
+        minic_log(LOG_ERROR, "剖析数据(%s)与程序不匹配，忽略", file.c_str());
+        return false;
+    }
+
+    for (size_t k = 0; k < sites.size(); ++k) {
+
+        Instruction * inst = sites[k].inst;
+
+        switch (inst->getOp()) {
+            case IRInstOperator::IRINST_OP_ENTRY:
+                sites[k].func->setEntryCount(counts[k]);
+                break;
+            case IRInstOperator::IRINST_OP_LABEL:
+                static_cast<LabelInstruction *>(inst)->setProfileCount(counts[k]);
+                break;
+            default:
+                static_cast<GotoInstruction *>(inst)->setTakenCount(counts[k]);
+                break;
+        }
+    }
+
+    return false;
+}
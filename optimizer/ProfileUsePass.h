@@ -0,0 +1,50 @@
+///
+/// @file ProfileUsePass.h
+/// @brief 剖析反馈优化(PGO)的剖析数据读入与标注
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "Pass.h"
+
+///
+/// @brief 读入--profile-generate产生的剖析数据，由--profile-use在-O流水线之前执行。
+/// 插桩点与插桩时按同样的次序收集，计数写到函数(调用次数)、Label(块执行次数)
+/// 以及条件跳转(走真分支的次数)上，供块布局以及后端的栈槽分配使用。
+/// 剖析数据与程序不匹配时给出提示并忽略，不影响编译
+///
+class ProfileUsePass : public ModulePass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _file 剖析数据文件
+    ///
+    explicit ProfileUsePass(std::string _file) : ModulePass("profile-use"), file(std::move(_file))
+    {}
+
+    ///
+    /// @brief 读入剖析数据并标注到IR上
+    /// @param module 模块
+    /// @return false 只标注执行次数，IR没有修改
+    ///
+    bool runOnModule(Module * module) override;
+
+private:
+    ///
+    /// @brief 剖析数据文件
+    ///
+    std::string file;
+};
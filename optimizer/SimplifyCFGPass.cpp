@@ -0,0 +1,127 @@
+///
+/// @file SimplifyCFGPass.cpp
+/// @brief 控制流简化
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+
+#include <unordered_map>
+#include <vector>
+
+#include "Function.h"
+#include "GotoInstruction.h"
+#include "SimplifyCFGPass.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+///
+/// @brief 对函数执行控制流简化
+/// @param func 要处理的函数
+/// @return true IR被修改
+///
+bool SimplifyCFGPass::runOnFunction(Function * func)
+{
+    auto & insts = func->getInterCode().getInsts();
+    if (insts.empty()) {
+        return false;
+    }
+
+    // 指令(主要是跳转目标Label)到其在指令序列中位置的映射
+    std::unordered_map<Instruction *, size_t> instIndex;
+    for (size_t k = 0; k < insts.size(); ++k) {
+        instIndex[insts[k]] = k;
+    }
+
+    // 从entry开始，沿顺序执行以及跳转边标记可达指令
+    std::vector<bool> reachable(insts.size(), false);
+    std::vector<size_t> worklist{0};
+
+    while (!worklist.empty()) {
+
+        size_t k = worklist.back();
+        worklist.pop_back();
+
+        for (; k < insts.size() && !reachable[k]; ++k) {
+
+            reachable[k] = true;
+
+            Instruction * inst = insts[k];
+            if (inst->getOp() == IRInstOperator::IRINST_OP_EXIT) {
+                break;
+            }
+
+            if (Instanceof(gotoInst, GotoInstruction *, inst)) {
+
+                // 无论有无条件，跳转指令之后都不会顺序执行
+                worklist.push_back(instIndex[gotoInst->getTarget()]);
+                if (gotoInst->getOperandsNum() == 1) {
+                    worklist.push_back(instIndex[gotoInst->getFalseTarget()]);
+                }
+                break;
+            }
+        }
+    }
+
+    // 出口Label与exit指令始终保留，以便后端产生函数的epilogue
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if ((insts[k] == func->getExitLabel()) || (insts[k]->getOp() == IRInstOperator::IRINST_OP_EXIT)) {
+            reachable[k] = true;
+        }
+    }
+
+    // 不可达指令的结果若被可达指令使用，说明IR不符合预期，保守处理不做修改
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if (reachable[k]) {
+            continue;
+        }
+
+        for (auto use: insts[k]->getUses()) {
+            Instanceof(userInst, Instruction *, use->getUser());
+            if (userInst && reachable[instIndex[userInst]]) {
+                return false;
+            }
+        }
+    }
+
+    bool changed = false;
+
+    for (size_t k = 0; k < insts.size(); ++k) {
+        if (!reachable[k]) {
+            insts[k]->setDead();
+            changed = true;
+        }
+    }
+
+    // 删除跳转到紧邻的下一条可达指令的无条件跳转
+    for (size_t k = 0; k < insts.size(); ++k) {
+
+        Instanceof(gotoInst, GotoInstruction *, insts[k]);
+        if (!gotoInst || gotoInst->isDead() || (gotoInst->getOperandsNum() != 0)) {
+            continue;
+        }
+
+        size_t next = k + 1;
+        while (next < insts.size() && insts[next]->isDead()) {
+            next++;
+        }
+
+        if ((next < insts.size()) && (insts[next] == gotoInst->getTarget())) {
+            gotoInst->setDead();
+            changed = true;
+        }
+    }
+
+    if (changed) {
+        func->getInterCode().removeDeadInsts();
+    }
+
+    return changed;
+}
@@ -0,0 +1,39 @@
+///
+/// @file SimplifyCFGPass.h
+/// @brief 控制流简化
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include "Pass.h"
+
+///
+/// @brief 控制流简化：
+/// (1) 从entry出发沿顺序执行与跳转边不可达的指令全部删除，函数出口Label与exit指令保留
+/// (2) 跳转目标正好是下一条指令的无条件跳转删除
+///
+class SimplifyCFGPass : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    SimplifyCFGPass() : FunctionPass("simplifycfg")
+    {}
+
+    ///
+    /// @brief 对函数执行控制流简化
+    /// @param func 要处理的函数
+    /// @return true IR被修改
+    ///
+    bool runOnFunction(Function * func) override;
+};
@@ -17,6 +17,7 @@
 
 #include "ScopeStack.h"
 #include "Common.h"
+#include "OutputBuffer.h"
 #include "VoidType.h"
 
 Module::Module(std::string _name) : name(_name)
@@ -148,14 +149,15 @@ Function * Module::newFunction(std::string name, Type * returnType, std::vector<
     }
 
     // 以下是原代码，创建新函数...
-    std::vector<Type *> paramsType(params.size());
+    std::vector<Type *> paramsType;
+    paramsType.reserve(params.size());
 
     for (auto & param: params) {
         paramsType.push_back(param->getType());
     }
 
-    /// 函数类型参数
-    FunctionType * type = new FunctionType(returnType, paramsType);
+    /// 函数类型参数，同样的函数类型只创建一个
+    FunctionType * type = FunctionType::get(returnType, paramsType);
 
     // 新建函数对象
     tempFunc = new Function(name, type, builtin);
@@ -338,7 +340,7 @@ Value * Module::newVarValueWithValue(Type * type, const std::string & name, Valu
     Value * tempValue = scopeStack->findCurrentScope(name);
     if (tempValue) {
         // 变量名已存在，对于函数参数这是正常的（覆盖）
-        printf("DEBUG: 覆盖已存在的变量: %s\n", name.c_str());
+        minic_log(LOG_DEBUG, "覆盖已存在的变量: %s", name.c_str());
     }
 
     // 确保Value对象有正确的名称
@@ -348,7 +350,7 @@ Value * Module::newVarValueWithValue(Type * type, const std::string & name, Valu
     // 直接在当前作用域中注册这个值（只传递value参数）
     scopeStack->insertValue(value);
 
-    printf("DEBUG: 成功注册变量到符号表: %s -> %p\n", name.c_str(), (void *) value);
+    minic_log(LOG_DEBUG, "成功注册变量到符号表: %s -> %p", name.c_str(), (void *) value);
     return value;
 }
 
@@ -403,6 +405,9 @@ void Module::Delete()
 
     funcMap.clear();
     funcVector.clear();
+
+    // 计数器属于全局变量，已经释放
+    profileCounters.clear();
 }
 
 ///
@@ -420,32 +425,39 @@ void Module::renameIR()
 }
 
 /// @brief 文本输出线性IR指令
-/// @param filePath 输出文件路径
+/// @param filePath 输出文件路径，为"-"时输出到标准输出
 void Module::outputIR(const std::string & filePath)
 {
     // 这里使用C的文件操作，也可以使用C++的文件操作
 
-    FILE * fp = fopen(filePath.c_str(), "w");
+    FILE * fp = filePath == "-" ? stdout : fopen(filePath.c_str(), "w");
     if (nullptr == fp) {
-        printf("fopen() failed\n");
+        minic_log(LOG_ERROR, "fopen() failed");
         return;
     }
 
-    // 全局变量遍历输出对应的declare指令
-    for (auto var: globalVariableVector) {
+    {
+        // 经过输出缓冲区逐条指令输出，不再产生整个函数的字符串
+        OutputBuffer out(fp);
 
+        // 全局变量遍历输出对应的declare指令
         std::string str;
-        var->toDeclareString(str);
-        fprintf(fp, "%s\n", str.c_str());
-    }
+        for (auto var: globalVariableVector) {
 
-    // 遍历所有的线性IR指令，文本输出
-    for (auto func: funcVector) {
+            str.clear();
+            var->toDeclareString(str);
+            out.put(str).put('\n');
+        }
 
-        std::string instStr;
-        func->toString(instStr);
-        fprintf(fp, "%s", instStr.c_str());
+        // 遍历所有的线性IR指令，文本输出
+        for (auto func: funcVector) {
+            func->toString(out);
+        }
     }
 
-    fclose(fp);
+    if (fp == stdout) {
+        fflush(fp);
+    } else {
+        fclose(fp);
+    }
 }
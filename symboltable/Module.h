@@ -15,7 +15,9 @@
 ///
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 #include <unordered_map>
 
@@ -105,6 +107,46 @@ public:
         return funcVector;
     }
 
+    ///
+    /// @brief 设置--profile-generate插桩产生的计数器，后端据此输出计数器数组以及退出时的转储代码
+    /// @param counters 计数器全局变量，按编号排列
+    /// @param checksum 插桩点布局的校验和
+    /// @param file 程序退出时计数器写入的文件
+    ///
+    void setProfileCounters(std::vector<GlobalVariable *> counters, uint32_t checksum, std::string file)
+    {
+        profileCounters = std::move(counters);
+        profileChecksum = checksum;
+        profileFile = std::move(file);
+    }
+
+    ///
+    /// @brief 获取插桩的计数器，没有插桩时为空
+    /// @return std::vector<GlobalVariable *>&
+    ///
+    std::vector<GlobalVariable *> & getProfileCounters()
+    {
+        return profileCounters;
+    }
+
+    ///
+    /// @brief 获取插桩点布局的校验和
+    /// @return uint32_t 校验和
+    ///
+    [[nodiscard]] uint32_t getProfileChecksum() const
+    {
+        return profileChecksum;
+    }
+
+    ///
+    /// @brief 获取计数器写入的文件
+    /// @return const std::string& 文件名
+    ///
+    [[nodiscard]] const std::string & getProfileFile() const
+    {
+        return profileFile;
+    }
+
     /// @brief 新建一个整型数值的Value，并加入到符号表，用于后续释放空间
     /// \param intVal 整数值
     /// \return 临时Value
@@ -204,4 +246,13 @@ private:
 
     /// @brief 常量表
     std::unordered_map<int32_t, ConstInt *> constIntMap;
+
+    /// @brief 插桩的计数器
+    std::vector<GlobalVariable *> profileCounters;
+
+    /// @brief 插桩点布局的校验和
+    uint32_t profileChecksum = 0;
+
+    /// @brief 计数器写入的文件
+    std::string profileFile;
 };
\ No newline at end of file
@@ -0,0 +1,395 @@
+///
+/// @file BitSet.cpp
+/// @brief 按机器字压缩存储的稠密位集合，集合运算按SIMD宽度成批进行
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cstring>
+
+#include "BitSet.h"
+
+// 按编译选项选择SIMD的宽度：-mavx2时256位，x86-64默认具备的SSE2时128位，其它平台逐字处理。
+// 定义BITSET_NO_SIMD时总是逐字处理，用于与SIMD的实现对照检查
+#if defined(BITSET_NO_SIMD)
+#elif defined(__AVX2__)
+#define BITSET_SIMD_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BITSET_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+using Word = BitSet::Word;
+
+/// @brief 并运算
+struct OrOp {
+    static Word scalar(Word a, Word b)
+    {
+        return a | b;
+    }
+#if defined(BITSET_SIMD_AVX2)
+    static __m256i vector(__m256i a, __m256i b)
+    {
+        return _mm256_or_si256(a, b);
+    }
+#elif defined(BITSET_SIMD_SSE2)
+    static __m128i vector(__m128i a, __m128i b)
+    {
+        return _mm_or_si128(a, b);
+    }
+#endif
+};
+
+/// @brief 交运算
+struct AndOp {
+    static Word scalar(Word a, Word b)
+    {
+        return a & b;
+    }
+#if defined(BITSET_SIMD_AVX2)
+    static __m256i vector(__m256i a, __m256i b)
+    {
+        return _mm256_and_si256(a, b);
+    }
+#elif defined(BITSET_SIMD_SSE2)
+    static __m128i vector(__m128i a, __m128i b)
+    {
+        return _mm_and_si128(a, b);
+    }
+#endif
+};
+
+/// @brief 差运算a & ~b
+struct AndNotOp {
+    static Word scalar(Word a, Word b)
+    {
+        return a & ~b;
+    }
+#if defined(BITSET_SIMD_AVX2)
+    static __m256i vector(__m256i a, __m256i b)
+    {
+        return _mm256_andnot_si256(b, a);
+    }
+#elif defined(BITSET_SIMD_SSE2)
+    static __m128i vector(__m128i a, __m128i b)
+    {
+        return _mm_andnot_si128(b, a);
+    }
+#endif
+};
+
+/// @brief 异或运算
+struct XorOp {
+    static Word scalar(Word a, Word b)
+    {
+        return a ^ b;
+    }
+#if defined(BITSET_SIMD_AVX2)
+    static __m256i vector(__m256i a, __m256i b)
+    {
+        return _mm256_xor_si256(a, b);
+    }
+#elif defined(BITSET_SIMD_SSE2)
+    static __m128i vector(__m128i a, __m128i b)
+    {
+        return _mm_xor_si128(a, b);
+    }
+#endif
+};
+
+///
+/// @brief 对n个字做dst = dst op src，同时记录是否有字发生了改变
+/// @tparam Op 运算
+/// @param dst 目的字
+/// @param src 源字
+/// @param n 字数
+/// @return true 有字改变
+///
+template <typename Op>
+static bool applyWords(Word * dst, const Word * src, size_t n)
+{
+    size_t k = 0;
+    Word changed = 0;
+
+#if defined(BITSET_SIMD_AVX2)
+    __m256i diff = _mm256_setzero_si256();
+    for (; k + 4 <= n; k += 4) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (dst + k));
+        __m256i b = _mm256_loadu_si256((const __m256i *) (src + k));
+        __m256i r = Op::vector(a, b);
+        diff = _mm256_or_si256(diff, _mm256_xor_si256(a, r));
+        _mm256_storeu_si256((__m256i *) (dst + k), r);
+    }
+    changed = !_mm256_testz_si256(diff, diff);
+#elif defined(BITSET_SIMD_SSE2)
+    __m128i diff = _mm_setzero_si128();
+    for (; k + 2 <= n; k += 2) {
+        __m128i a = _mm_loadu_si128((const __m128i *) (dst + k));
+        __m128i b = _mm_loadu_si128((const __m128i *) (src + k));
+        __m128i r = Op::vector(a, b);
+        diff = _mm_or_si128(diff, _mm_xor_si128(a, r));
+        _mm_storeu_si128((__m128i *) (dst + k), r);
+    }
+    changed = _mm_movemask_epi8(_mm_cmpeq_epi8(diff, _mm_setzero_si128())) != 0xFFFF;
+#endif
+
+    for (; k < n; ++k) {
+        Word r = Op::scalar(dst[k], src[k]);
+        changed |= dst[k] ^ r;
+        dst[k] = r;
+    }
+
+    return changed != 0;
+}
+
+///
+/// @brief n个字中是否有a & b不为0的字
+/// @param a 字
+/// @param b 字
+/// @param n 字数
+/// @return true 有
+///
+static bool anyCommon(const Word * a, const Word * b, size_t n)
+{
+    size_t k = 0;
+
+#if defined(BITSET_SIMD_AVX2)
+    for (; k + 4 <= n; k += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i *) (a + k));
+        __m256i y = _mm256_loadu_si256((const __m256i *) (b + k));
+        if (!_mm256_testz_si256(x, y)) {
+            return true;
+        }
+    }
+#elif defined(BITSET_SIMD_SSE2)
+    for (; k + 2 <= n; k += 2) {
+        __m128i x = _mm_loadu_si128((const __m128i *) (a + k));
+        __m128i y = _mm_loadu_si128((const __m128i *) (b + k));
+        __m128i r = _mm_and_si128(x, y);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(r, _mm_setzero_si128())) != 0xFFFF) {
+            return true;
+        }
+    }
+#endif
+
+    for (; k < n; ++k) {
+        if (a[k] & b[k]) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///
+/// @brief n个字是否全为0
+/// @param a 字
+/// @param n 字数
+/// @return true 全为0
+///
+static bool allZero(const Word * a, size_t n)
+{
+    for (size_t k = 0; k < n; ++k) {
+        if (a[k]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+BitSet::BitSet(uint32_t _size, bool val)
+{
+    resize(_size, val);
+}
+
+void BitSet::resize(uint32_t _size, bool val)
+{
+    uint32_t oldBits = bits;
+
+    bits = _size;
+    words.resize((bits + WORD_BITS - 1) / WORD_BITS, val ? ~(Word) 0 : 0);
+
+    // 原来最后一个字中新增的位
+    if (val && (_size > oldBits)) {
+        setRange(oldBits, std::min(_size, (oldBits + WORD_BITS - 1) / WORD_BITS * WORD_BITS));
+    }
+
+    clearUnusedBits();
+}
+
+void BitSet::setRange(uint32_t from, uint32_t to)
+{
+    to = std::min(to, bits);
+
+    while (from < to) {
+
+        uint32_t offset = from % WORD_BITS;
+        uint32_t len = std::min(to - from, WORD_BITS - offset);
+
+        Word mask = (len == WORD_BITS) ? ~(Word) 0 : (((Word) 1 << len) - 1) << offset;
+        words[from / WORD_BITS] |= mask;
+
+        from += len;
+    }
+}
+
+void BitSet::setAll()
+{
+    std::fill(words.begin(), words.end(), ~(Word) 0);
+    clearUnusedBits();
+}
+
+void BitSet::clear()
+{
+    std::fill(words.begin(), words.end(), 0);
+}
+
+void BitSet::clearUnusedBits()
+{
+    uint32_t tail = bits % WORD_BITS;
+    if (tail) {
+        words.back() &= ((Word) 1 << tail) - 1;
+    }
+}
+
+uint32_t BitSet::count() const
+{
+    uint32_t total = 0;
+    for (Word word: words) {
+        total += popCount64(word);
+    }
+
+    return total;
+}
+
+bool BitSet::empty() const
+{
+    return allZero(words.data(), words.size());
+}
+
+int32_t BitSet::findFirst() const
+{
+    for (size_t k = 0; k < words.size(); ++k) {
+        if (words[k]) {
+            return (int32_t) (k * WORD_BITS + countTrailingZeros64(words[k]));
+        }
+    }
+
+    return -1;
+}
+
+int32_t BitSet::findNext(uint32_t prev) const
+{
+    uint32_t n = prev + 1;
+    if (n >= bits) {
+        return -1;
+    }
+
+    size_t k = n / WORD_BITS;
+
+    // 当前字中去掉prev及之前的位
+    Word word = words[k] & (~(Word) 0 << (n % WORD_BITS));
+
+    while (true) {
+        if (word) {
+            return (int32_t) (k * WORD_BITS + countTrailingZeros64(word));
+        }
+        if (++k >= words.size()) {
+            return -1;
+        }
+        word = words[k];
+    }
+}
+
+bool BitSet::unionWith(const BitSet & val)
+{
+    if (val.bits > bits) {
+        resize(val.bits);
+    }
+
+    return applyWords<OrOp>(words.data(), val.words.data(), val.words.size());
+}
+
+bool BitSet::intersectWith(const BitSet & val)
+{
+    size_t common = std::min(words.size(), val.words.size());
+
+    bool changed = applyWords<AndOp>(words.data(), val.words.data(), common);
+
+    // 超出val范围的部分都不在交集中
+    if (!allZero(words.data() + common, words.size() - common)) {
+        std::fill(words.begin() + (std::ptrdiff_t) common, words.end(), 0);
+        changed = true;
+    }
+
+    return changed;
+}
+
+bool BitSet::subtract(const BitSet & val)
+{
+    size_t common = std::min(words.size(), val.words.size());
+
+    return applyWords<AndNotOp>(words.data(), val.words.data(), common);
+}
+
+bool BitSet::intersects(const BitSet & val) const
+{
+    return anyCommon(words.data(), val.words.data(), std::min(words.size(), val.words.size()));
+}
+
+BitSet & BitSet::operator^=(const BitSet & val)
+{
+    if (val.bits > bits) {
+        resize(val.bits);
+    }
+
+    applyWords<XorOp>(words.data(), val.words.data(), val.words.size());
+
+    return *this;
+}
+
+BitSet BitSet::operator~() const
+{
+    BitSet ret = *this;
+    for (Word & word: ret.words) {
+        word = ~word;
+    }
+    ret.clearUnusedBits();
+
+    return ret;
+}
+
+bool BitSet::operator==(const BitSet & val) const
+{
+    size_t common = std::min(words.size(), val.words.size());
+
+    if (common && std::memcmp(words.data(), val.words.data(), common * sizeof(Word)) != 0) {
+        return false;
+    }
+
+    // 范围较大的集合超出的部分必须为空
+    return allZero(words.data() + common, words.size() - common) &&
+           allZero(val.words.data() + common, val.words.size() - common);
+}
+
+std::string BitSet::toString() const
+{
+    std::string str;
+
+    forEach([&str](uint32_t n) {
+        str += std::to_string(n);
+        str += ' ';
+    });
+
+    return str;
+}
@@ -0,0 +1,348 @@
+///
+/// @file BitSet.h
+/// @brief 按机器字压缩存储的稠密位集合，集合运算按SIMD宽度成批进行
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+///
+/// @brief 64位字中置位的个数
+/// @param word 字
+/// @return uint32_t 置位的个数
+///
+inline uint32_t popCount64(uint64_t word)
+{
+#if defined(_MSC_VER)
+    return (uint32_t) __popcnt64(word);
+#else
+    return (uint32_t) __builtin_popcountll(word);
+#endif
+}
+
+///
+/// @brief 64位字中最低置位的位置，word不能为0
+/// @param word 字
+/// @return uint32_t 最低置位的位置
+///
+inline uint32_t countTrailingZeros64(uint64_t word)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return (uint32_t) index;
+#else
+    return (uint32_t) __builtin_ctzll(word);
+#endif
+}
+
+///
+/// @brief 稠密位集合。元素为[0, size)之间的整数，每个元素占一位，按64位字连续存储，
+/// 适合活跃变量、到达定值以及冲突图等元素编号连续的数据流集合。
+/// 并、交、差运算在编译时开启AVX2时每次处理256位，否则在SSE2下每次处理128位，都返回集合是否改变，
+/// 便于数据流迭代判断是否到达不动点
+///
+class BitSet {
+
+public:
+    /// @brief 存储的字
+    using Word = uint64_t;
+
+    /// @brief 每个字的位数
+    static constexpr uint32_t WORD_BITS = 64;
+
+    /// @brief 构造空的集合
+    BitSet() = default;
+
+    ///
+    /// @brief 构造指定元素范围的集合
+    /// @param _size 元素的范围[0, size)
+    /// @param val 真时为全集，否则为空集
+    ///
+    explicit BitSet(uint32_t _size, bool val = false);
+
+    ///
+    /// @brief 改变元素的范围，新增的元素按val设置
+    /// @param _size 元素的范围[0, size)
+    /// @param val 新增元素是否在集合中
+    ///
+    void resize(uint32_t _size, bool val = false);
+
+    ///
+    /// @brief 元素的范围
+    /// @return uint32_t 范围的上界
+    ///
+    [[nodiscard]] uint32_t size() const
+    {
+        return bits;
+    }
+
+    ///
+    /// @brief 加入元素
+    /// @param n 元素，需小于size
+    ///
+    void set(uint32_t n)
+    {
+        words[n / WORD_BITS] |= (Word) 1 << (n % WORD_BITS);
+    }
+
+    ///
+    /// @brief 删除元素
+    /// @param n 元素，需小于size
+    ///
+    void reset(uint32_t n)
+    {
+        words[n / WORD_BITS] &= ~((Word) 1 << (n % WORD_BITS));
+    }
+
+    ///
+    /// @brief 元素是否在集合中
+    /// @param n 元素，超出范围时不在集合中
+    /// @return true 在
+    ///
+    [[nodiscard]] bool test(uint32_t n) const
+    {
+        return (n < bits) && ((words[n / WORD_BITS] >> (n % WORD_BITS)) & 1);
+    }
+
+    ///
+    /// @brief 加入[from, to)之间的全部元素
+    /// @param from 开始元素
+    /// @param to 结束元素，不含
+    ///
+    void setRange(uint32_t from, uint32_t to);
+
+    ///
+    /// @brief 设置为全集
+    ///
+    void setAll();
+
+    ///
+    /// @brief 设置为空集，元素的范围不变
+    ///
+    void clear();
+
+    ///
+    /// @brief 元素个数
+    /// @return uint32_t 元素个数
+    ///
+    [[nodiscard]] uint32_t count() const;
+
+    ///
+    /// @brief 是否为空集
+    /// @return true 空集
+    ///
+    [[nodiscard]] bool empty() const;
+
+    ///
+    /// @brief 最小的元素
+    /// @return int32_t 最小的元素，空集时为-1
+    ///
+    [[nodiscard]] int32_t findFirst() const;
+
+    ///
+    /// @brief 大于prev的最小元素
+    /// @param prev 前一个元素
+    /// @return int32_t 下一个元素，没有时为-1
+    ///
+    [[nodiscard]] int32_t findNext(uint32_t prev) const;
+
+    ///
+    /// @brief 按从小到大的次序访问每个元素，只访问非0的字，字内按最低置位逐个取出
+    /// @param fn 访问函数，参数为元素
+    ///
+    template <typename Fn>
+    void forEach(Fn fn) const
+    {
+        for (size_t k = 0; k < words.size(); ++k) {
+            Word word = words[k];
+            while (word) {
+                fn((uint32_t) (k * WORD_BITS + countTrailingZeros64(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
+    ///
+    /// @brief 并集，范围不够时扩大到val的范围
+    /// @param val 参与运算的集合
+    /// @return true 集合发生了改变
+    ///
+    bool unionWith(const BitSet & val);
+
+    ///
+    /// @brief 交集，超出val范围的元素被删除
+    /// @param val 参与运算的集合
+    /// @return true 集合发生了改变
+    ///
+    bool intersectWith(const BitSet & val);
+
+    ///
+    /// @brief 差集，删除在val中的元素
+    /// @param val 参与运算的集合
+    /// @return true 集合发生了改变
+    ///
+    bool subtract(const BitSet & val);
+
+    ///
+    /// @brief 是否有公共元素
+    /// @param val 参与比较的集合
+    /// @return true 有
+    ///
+    [[nodiscard]] bool intersects(const BitSet & val) const;
+
+    ///
+    /// @brief 并集运算
+    /// @param val 参与运算的集合
+    /// @return BitSet& 运算后的集合
+    ///
+    BitSet & operator|=(const BitSet & val)
+    {
+        unionWith(val);
+        return *this;
+    }
+
+    ///
+    /// @brief 交集运算
+    /// @param val 参与运算的集合
+    /// @return BitSet& 运算后的集合
+    ///
+    BitSet & operator&=(const BitSet & val)
+    {
+        intersectWith(val);
+        return *this;
+    }
+
+    ///
+    /// @brief 差集运算
+    /// @param val 参与运算的集合
+    /// @return BitSet& 运算后的集合
+    ///
+    BitSet & operator-=(const BitSet & val)
+    {
+        subtract(val);
+        return *this;
+    }
+
+    ///
+    /// @brief 异或运算，范围不够时扩大到val的范围
+    /// @param val 参与运算的集合
+    /// @return BitSet& 运算后的集合
+    ///
+    BitSet & operator^=(const BitSet & val);
+
+    ///
+    /// @brief 并集运算
+    /// @param val 参与运算集合
+    /// @return BitSet 运算结果集合
+    ///
+    BitSet operator|(const BitSet & val) const
+    {
+        BitSet ret = *this;
+        return ret |= val;
+    }
+
+    ///
+    /// @brief 交集运算
+    /// @param val 参与运算集合
+    /// @return BitSet 运算结果集合
+    ///
+    BitSet operator&(const BitSet & val) const
+    {
+        BitSet ret = *this;
+        return ret &= val;
+    }
+
+    ///
+    /// @brief 差集运算
+    /// @param val 参与运算集合
+    /// @return BitSet 运算结果集合
+    ///
+    BitSet operator-(const BitSet & val) const
+    {
+        BitSet ret = *this;
+        return ret -= val;
+    }
+
+    ///
+    /// @brief 异或运算
+    /// @param val 参与运算集合
+    /// @return BitSet 运算结果集合
+    ///
+    BitSet operator^(const BitSet & val) const
+    {
+        BitSet ret = *this;
+        return ret ^= val;
+    }
+
+    ///
+    /// @brief 补集运算，相对于[0, size)
+    /// @return BitSet 运算结果集合
+    ///
+    BitSet operator~() const;
+
+    ///
+    /// @brief 比较运算（等于），只比较元素，不比较范围
+    /// @param val 参与运算的集合
+    /// @return bool 等于为真，否则为假
+    ///
+    bool operator==(const BitSet & val) const;
+
+    ///
+    /// @brief 比较运算（不等于）
+    /// @param val 参与运算的集合
+    /// @return bool 不等为真，否则为假
+    ///
+    bool operator!=(const BitSet & val) const
+    {
+        return !(*this == val);
+    }
+
+    ///
+    /// @brief 变换成字符串显示，元素之间以空格分隔
+    /// @return std::string 字符串
+    ///
+    [[nodiscard]] std::string toString() const;
+
+    ///
+    /// @brief 存储的字
+    /// @return const std::vector<Word>& 字
+    ///
+    [[nodiscard]] const std::vector<Word> & getWords() const
+    {
+        return words;
+    }
+
+protected:
+    ///
+    /// @brief 清除最后一个字中超出范围的位，保证补集与计数等运算正确
+    ///
+    void clearUnusedBits();
+
+private:
+    ///
+    /// @brief 按位存储的元素，第k个字的第j位对应元素k * 64 + j
+    ///
+    std::vector<Word> words;
+
+    ///
+    /// @brief 元素的范围[0, bits)
+    ///
+    uint32_t bits = 0;
+};
@@ -13,7 +13,10 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <cstdarg>
 #include <cstdint>
+#include <cstdio>
+#include <mutex>
 #include <string>
 #include <iostream>
 
@@ -95,11 +98,86 @@ std::string trim(const std::string & str)
     return str.substr(pos);
 }
 
-void minic_log_common(int level, const char * content)
+int gMinicLogLevel = LOG_ERROR;
+
+/// @brief 日志输出的文件，为空时输出到标准错误输出
+static FILE * logFile = nullptr;
+
+/// @brief 保护日志文件的切换与写入
+static std::mutex logMutex;
+
+void minic_log_set_level(int level)
+{
+    gMinicLogLevel = level;
+}
+
+bool minic_log_parse_level(const std::string & name, int & level)
 {
-    if (level != LOG_ERROR) {
-        std::cerr << content << std::endl;
+    if (name == "debug") {
+        level = LOG_DEBUG;
+    } else if (name == "info") {
+        level = LOG_INFO;
+    } else if (name == "error") {
+        level = LOG_ERROR;
+    } else if (name == "none") {
+        level = LOG_NONE;
     } else {
-        std::cout << content << std::endl;
+        return false;
     }
+
+    return true;
+}
+
+bool minic_log_set_file(const std::string & filename)
+{
+    FILE * fp = fopen(filename.c_str(), "a");
+    if (!fp) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(logMutex);
+
+    if (logFile) {
+        fclose(logFile);
+    }
+
+    logFile = fp;
+
+    return true;
+}
+
+void minic_log_common(int level, const char * file, int line, const char * fmt, ...)
+{
+    (void) level;
+
+    char buf[1024];
+
+    // snprintf返回的是完整输出的长度，文件名过长时前缀会被截断，需限制在buf内，避免后续写越界
+    int len = snprintf(buf, sizeof(buf), "%s:%d ", file, line);
+    if (len < 0) {
+        len = 0;
+    } else if (len > (int) sizeof(buf) - 1) {
+        len = (int) sizeof(buf) - 1;
+    }
+
+    va_list ap;
+    va_start(ap, fmt);
+    int msgLen = vsnprintf(buf + len, sizeof(buf) - (size_t) len, fmt, ap);
+    va_end(ap);
+
+    if (msgLen > 0) {
+        len += msgLen;
+    }
+
+    // 超长的日志截断，保证以换行结尾
+    if (len > (int) sizeof(buf) - 2) {
+        len = (int) sizeof(buf) - 2;
+    }
+    buf[len++] = '\n';
+
+    std::lock_guard<std::mutex> lock(logMutex);
+
+    FILE * fp = logFile ? logFile : stderr;
+    fwrite(buf, 1, (size_t) len, fp);
+    fflush(fp);
 }
\ No newline at end of file
@@ -60,12 +60,49 @@ std::string trim(const std::string & str);
 #define LOG_DEBUG 0
 #define LOG_INFO 1
 #define LOG_ERROR 2
+#define LOG_NONE 3
 
-void minic_log_common(int level, const char * content);
+///
+/// @brief 编译期的日志级别，低于该级别的minic_log连同其参数一起被编译器删除。
+/// 可在编译时通过-DMINIC_LOG_COMPILE_LEVEL=LOG_INFO等指定，默认全部保留，由运行时级别过滤
+///
+#ifndef MINIC_LOG_COMPILE_LEVEL
+#define MINIC_LOG_COMPILE_LEVEL LOG_DEBUG
+#endif
+
+/// @brief 运行时的日志级别，低于该级别的日志不输出，默认只输出错误
+extern int gMinicLogLevel;
+
+/// @brief 设置运行时的日志级别
+/// @param level 日志级别，LOG_DEBUG到LOG_NONE
+void minic_log_set_level(int level);
+
+/// @brief 日志级别的名字转换为级别，名字为debug、info、error或none
+/// @param name 级别名
+/// @param level 转换后的级别
+/// @return true：成功，false：名字不合法
+bool minic_log_parse_level(const std::string & name, int & level);
 
+/// @brief 设置日志输出的文件，默认输出到标准错误输出
+/// @param filename 文件名，追加写入
+/// @return true：成功，false：文件打开失败
+bool minic_log_set_file(const std::string & filename);
+
+/// @brief 格式化并输出一条日志，一条日志一次写入，多线程的日志不会交错
+/// @param level 日志级别
+/// @param file 源文件名
+/// @param line 行号
+/// @param fmt 格式化字符串，和printf的格式化字符串一样
+void minic_log_common(int level, const char * file, int line, const char * fmt, ...)
+    __attribute__((format(printf, 4, 5)));
+
+///
+/// @brief 输出日志。先按编译期与运行时的级别过滤，被过滤的日志不格式化，参数也不求值，
+/// 编译期过滤掉的级别整条语句被删除
+///
 #define minic_log(level, fmt, args...)                                                                                 \
     do {                                                                                                               \
-        char max_buf[1024];                                                                                            \
-        snprintf(max_buf, sizeof(max_buf), "%s:%d " fmt "\n", __FILE__, __LINE__, ##args);                             \
-        minic_log_common(level, max_buf);                                                                              \
+        if ((level) >= MINIC_LOG_COMPILE_LEVEL && (level) >= gMinicLogLevel) {                                         \
+            minic_log_common(level, __FILE__, __LINE__, fmt, ##args);                                                  \
+        }                                                                                                              \
     } while (0)
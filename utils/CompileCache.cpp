@@ -0,0 +1,371 @@
+///
+/// @file CompileCache.cpp
+/// @brief 以源文件内容与编译选项的散列为键的编译结果缓存
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include "CompileCache.h"
+
+namespace fs = std::filesystem;
+
+///
+/// @brief 缓存目录的互斥锁，用于stats文件的更新与淘汰，多个进程之间互斥。
+/// Windows下不加锁，统计可能丢失个别的计数，不影响缓存内容的正确性
+///
+class CacheDirLock {
+
+public:
+    explicit CacheDirLock(const std::string & dir)
+    {
+#ifndef _WIN32
+        fd = ::open((dir + "/lock").c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd >= 0) {
+            flock(fd, LOCK_EX);
+        }
+#else
+        (void) dir;
+#endif
+    }
+
+    ~CacheDirLock()
+    {
+#ifndef _WIN32
+        if (fd >= 0) {
+            flock(fd, LOCK_UN);
+            ::close(fd);
+        }
+#endif
+    }
+
+    CacheDirLock(const CacheDirLock &) = delete;
+    CacheDirLock & operator=(const CacheDirLock &) = delete;
+
+private:
+    /// @brief 锁文件
+    int fd = -1;
+};
+
+bool CompileCache::open(const std::string & _dir, uint64_t _maxBytes)
+{
+    std::error_code ec;
+    fs::create_directories(_dir, ec);
+    if (ec || !fs::is_directory(_dir, ec)) {
+        lastError = "缓存目录(" + _dir + ")创建失败";
+        return false;
+    }
+
+    dir = _dir;
+    maxBytes = _maxBytes;
+
+    return true;
+}
+
+std::string CompileCache::entryPath(const std::string & key, const std::string & suffix) const
+{
+    return dir + "/" + key.substr(0, 2) + "/" + key.substr(2) + suffix;
+}
+
+std::string CompileCache::tempPath(const std::string & to)
+{
+    return to + ".tmp." + std::to_string(getpid()) + "." + std::to_string(tempIndex++);
+}
+
+bool CompileCache::copyAtomically(const std::string & from, const std::string & to)
+{
+    std::string temp = tempPath(to);
+
+    std::error_code ec;
+    fs::copy_file(from, temp, fs::copy_options::overwrite_existing, ec);
+    if (ec) {
+        fs::remove(temp, ec);
+        return false;
+    }
+
+    // 同一文件系统内的改名是原子的，读者看到的要么是旧文件，要么是完整的新文件
+    fs::rename(temp, to, ec);
+    if (ec) {
+        fs::remove(temp, ec);
+        return false;
+    }
+
+    return true;
+}
+
+bool CompileCache::writeAtomically(const std::string & text, const std::string & to)
+{
+    std::string temp = tempPath(to);
+
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out.write(text.data(), (std::streamsize) text.size())) {
+            out.close();
+            std::error_code ec;
+            fs::remove(temp, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(temp, to, ec);
+    if (ec) {
+        fs::remove(temp, ec);
+        return false;
+    }
+
+    return true;
+}
+
+bool CompileCache::lookup(const std::string & key, const std::string & suffix, const std::string & outputFile)
+{
+    std::string path = entryPath(key, suffix);
+
+    std::error_code ec;
+    if (!fs::is_regular_file(path, ec) || !copyAtomically(path, outputFile)) {
+        misses++;
+        return false;
+    }
+
+    // 更新修改时间，淘汰时按最久未用处理
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+
+    hits++;
+
+    return true;
+}
+
+void CompileCache::store(const std::string & key, const std::string & suffix, const std::string & outputFile)
+{
+    std::string path = entryPath(key, suffix);
+
+    std::error_code ec;
+    fs::create_directories(fs::path(path).parent_path(), ec);
+    if (ec) {
+        return;
+    }
+
+    if (copyAtomically(outputFile, path)) {
+        stores++;
+    }
+}
+
+bool CompileCache::lookupText(const std::string & key, const std::string & suffix, std::string & text)
+{
+    std::string path = entryPath(key, suffix);
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        functionMisses++;
+        return false;
+    }
+
+    text.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    in.close();
+
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+
+    functionHits++;
+
+    return true;
+}
+
+void CompileCache::storeText(const std::string & key, const std::string & suffix, const std::string & text)
+{
+    std::string path = entryPath(key, suffix);
+
+    std::error_code ec;
+    fs::create_directories(fs::path(path).parent_path(), ec);
+    if (ec) {
+        return;
+    }
+
+    if (writeAtomically(text, path)) {
+        stores++;
+    }
+}
+
+void CompileCache::readStats(Stats & stats) const
+{
+    std::ifstream in(dir + "/stats");
+
+    std::string name;
+    uint64_t value;
+    while (in >> name >> value) {
+        if (name == "hits") {
+            stats.hits = value;
+        } else if (name == "misses") {
+            stats.misses = value;
+        } else if (name == "stores") {
+            stats.stores = value;
+        } else if (name == "evictions") {
+            stats.evictions = value;
+        } else if (name == "function-hits") {
+            stats.functionHits = value;
+        } else if (name == "function-misses") {
+            stats.functionMisses = value;
+        }
+    }
+}
+
+uint64_t CompileCache::evict(uint64_t & evicted)
+{
+    struct Entry {
+        fs::path path;
+        fs::file_time_type time;
+        uint64_t size;
+    };
+
+    std::vector<Entry> entries;
+    uint64_t total = 0;
+
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(dir, ec); !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec)) {
+
+        // 条目都在两位十六进制的子目录中，其它的是lock与stats文件
+        if (it.depth() != 1 || !it->is_regular_file(ec)) {
+            continue;
+        }
+
+        Entry entry{it->path(), it->last_write_time(ec), (uint64_t) it->file_size(ec)};
+        total += entry.size;
+        entries.push_back(entry);
+    }
+
+    evicted = 0;
+
+    if (total <= maxBytes) {
+        return total;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry & a, const Entry & b) { return a.time < b.time; });
+
+    uint64_t target = maxBytes / 10 * 9;
+    for (auto & entry: entries) {
+        if (total <= target) {
+            break;
+        }
+
+        if (fs::remove(entry.path, ec)) {
+            total -= entry.size;
+            evicted++;
+        }
+    }
+
+    return total;
+}
+
+void CompileCache::finish()
+{
+    if (!isOpen()) {
+        return;
+    }
+
+    CacheDirLock lock(dir);
+
+    Stats stats;
+    readStats(stats);
+
+    stats.hits += hits.exchange(0);
+    stats.misses += misses.exchange(0);
+    stats.functionHits += functionHits.exchange(0);
+    stats.functionMisses += functionMisses.exchange(0);
+
+    uint64_t stored = stores.exchange(0);
+    stats.stores += stored;
+
+    if (stored) {
+        uint64_t evicted;
+        evict(evicted);
+        stats.evictions += evicted;
+    }
+
+    // 先写临时文件再改名
+    std::string temp = dir + "/stats.tmp." + std::to_string(getpid());
+    {
+        std::ofstream out(temp, std::ios::trunc);
+        out << "hits " << stats.hits << "\n";
+        out << "misses " << stats.misses << "\n";
+        out << "stores " << stats.stores << "\n";
+        out << "evictions " << stats.evictions << "\n";
+        out << "function-hits " << stats.functionHits << "\n";
+        out << "function-misses " << stats.functionMisses << "\n";
+    }
+
+    std::error_code ec;
+    fs::rename(temp, dir + "/stats", ec);
+    if (ec) {
+        fs::remove(temp, ec);
+    }
+}
+
+void CompileCache::printStats(FILE * fp)
+{
+    Stats stats;
+    uint64_t size = 0;
+    uint64_t entries = 0;
+
+    {
+        CacheDirLock lock(dir);
+
+        readStats(stats);
+
+        std::error_code ec;
+        for (auto it = fs::recursive_directory_iterator(dir, ec); !ec && it != fs::recursive_directory_iterator();
+             it.increment(ec)) {
+            if (it.depth() == 1 && it->is_regular_file(ec)) {
+                size += (uint64_t) it->file_size(ec);
+                entries++;
+            }
+        }
+    }
+
+    uint64_t lookups = stats.hits + stats.misses;
+    double hitRate = lookups ? stats.hits * 100.0 / lookups : 0.0;
+
+    fprintf(fp, "===---------------------------------------------------------===\n");
+    fprintf(fp, "                   Compile cache statistics\n");
+    fprintf(fp, "===---------------------------------------------------------===\n");
+    fprintf(fp, "  Directory: %s\n", dir.c_str());
+    fprintf(fp,
+            "  Hits: %llu  Misses: %llu  Hit rate: %.1f%%\n",
+            (unsigned long long) stats.hits,
+            (unsigned long long) stats.misses,
+            hitRate);
+    fprintf(fp,
+            "  Function hits: %llu  Function misses: %llu\n",
+            (unsigned long long) stats.functionHits,
+            (unsigned long long) stats.functionMisses);
+    fprintf(fp,
+            "  Stores: %llu  Evictions: %llu\n",
+            (unsigned long long) stats.stores,
+            (unsigned long long) stats.evictions);
+    fprintf(fp,
+            "  Entries: %llu  Size: %.1f MB / %.1f MB\n",
+            (unsigned long long) entries,
+            size / (1024.0 * 1024.0),
+            maxBytes / (1024.0 * 1024.0));
+}
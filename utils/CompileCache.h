@@ -0,0 +1,194 @@
+///
+/// @file CompileCache.h
+/// @brief 以源文件内容与编译选项的散列为键的编译结果缓存
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+///
+/// @brief 编译结果缓存。键为源文件内容与影响输出的选项的SHA-256散列(由调用者计算)，
+/// 值为产生的汇编或线性IR文件，保存在缓存目录下的<键的前两位>/<键的其余部分><后缀>中。
+/// 写入缓存与写出结果都先写临时文件再改名，多个进程或线程同时使用同一缓存目录时不会读到不完整的文件。
+/// 命中时更新条目的修改时间，超过容量时按修改时间淘汰最久未用的条目。
+/// 除整个文件的输出外，也保存增量编译时单个函数的汇编，由调用者按函数的指纹查找。
+/// 命中、未命中、写入与淘汰的次数累计保存在缓存目录的stats文件中
+///
+class CompileCache {
+
+public:
+    /// @brief 缓存的统计
+    struct Stats {
+
+        /// @brief 命中次数
+        uint64_t hits = 0;
+
+        /// @brief 未命中次数
+        uint64_t misses = 0;
+
+        /// @brief 写入的条目数
+        uint64_t stores = 0;
+
+        /// @brief 淘汰的条目数
+        uint64_t evictions = 0;
+
+        /// @brief 函数级条目的命中次数
+        uint64_t functionHits = 0;
+
+        /// @brief 函数级条目的未命中次数
+        uint64_t functionMisses = 0;
+    };
+
+    ///
+    /// @brief 打开缓存目录，不存在时创建
+    /// @param _dir 缓存目录
+    /// @param _maxBytes 缓存容量，单位字节
+    /// @return true 成功
+    /// @return false 失败，错误信息通过getLastError获取
+    ///
+    bool open(const std::string & _dir, uint64_t _maxBytes);
+
+    ///
+    /// @brief 查找缓存，命中时把缓存的内容复制为输出文件
+    /// @param key 键
+    /// @param suffix 输出的后缀，如.s与.ir
+    /// @param outputFile 输出文件
+    /// @return true 命中，输出文件已产生
+    /// @return false 未命中
+    ///
+    bool lookup(const std::string & key, const std::string & suffix, const std::string & outputFile);
+
+    ///
+    /// @brief 把编译产生的输出文件加入缓存，失败时只是不缓存
+    /// @param key 键
+    /// @param suffix 输出的后缀
+    /// @param outputFile 输出文件
+    ///
+    void store(const std::string & key, const std::string & suffix, const std::string & outputFile);
+
+    ///
+    /// @brief 查找函数级的缓存，命中时读入缓存的内容
+    /// @param key 键
+    /// @param suffix 后缀
+    /// @param text 缓存的内容
+    /// @return true 命中
+    /// @return false 未命中
+    ///
+    bool lookupText(const std::string & key, const std::string & suffix, std::string & text);
+
+    ///
+    /// @brief 把函数级的内容加入缓存，失败时只是不缓存
+    /// @param key 键
+    /// @param suffix 后缀
+    /// @param text 内容
+    ///
+    void storeText(const std::string & key, const std::string & suffix, const std::string & text);
+
+    ///
+    /// @brief 结束使用：本进程的统计累加到stats文件中，有新条目时超过容量则淘汰
+    ///
+    void finish();
+
+    ///
+    /// @brief 输出累计的统计以及缓存的大小
+    /// @param fp 输出文件
+    ///
+    void printStats(FILE * fp);
+
+    /// @brief 缓存是否已打开
+    [[nodiscard]] bool isOpen() const
+    {
+        return !dir.empty();
+    }
+
+    [[nodiscard]] std::string getLastError() const
+    {
+        return lastError;
+    }
+
+protected:
+    ///
+    /// @brief 条目的文件路径
+    /// @param key 键
+    /// @param suffix 后缀
+    /// @return std::string 路径
+    ///
+    std::string entryPath(const std::string & key, const std::string & suffix) const;
+
+    ///
+    /// @brief 复制文件，先写同目录下的临时文件，再改名为目标文件
+    /// @param from 源文件
+    /// @param to 目标文件
+    /// @return true 成功
+    ///
+    bool copyAtomically(const std::string & from, const std::string & to);
+
+    ///
+    /// @brief 写文件，先写同目录下的临时文件，再改名为目标文件
+    /// @param text 内容
+    /// @param to 目标文件
+    /// @return true 成功
+    ///
+    bool writeAtomically(const std::string & text, const std::string & to);
+
+    ///
+    /// @brief 临时文件名，与进程号、序号相关，不同的进程与线程不会冲突
+    /// @param to 目标文件
+    /// @return std::string 临时文件名
+    ///
+    std::string tempPath(const std::string & to);
+
+    ///
+    /// @brief 读取stats文件中的累计统计
+    /// @param stats 统计
+    ///
+    void readStats(Stats & stats) const;
+
+    ///
+    /// @brief 统计缓存的大小，超过容量时淘汰最久未用的条目，直到不超过容量的90%
+    /// @param evicted 淘汰的条目数
+    /// @return uint64_t 淘汰后的字节数
+    ///
+    uint64_t evict(uint64_t & evicted);
+
+private:
+    /// @brief 缓存目录，为空时没有打开
+    std::string dir;
+
+    /// @brief 缓存容量，单位字节
+    uint64_t maxBytes = 0;
+
+    /// @brief 本进程的命中次数
+    std::atomic<uint64_t> hits{0};
+
+    /// @brief 本进程的未命中次数
+    std::atomic<uint64_t> misses{0};
+
+    /// @brief 本进程写入的条目数
+    std::atomic<uint64_t> stores{0};
+
+    /// @brief 本进程函数级条目的命中次数
+    std::atomic<uint64_t> functionHits{0};
+
+    /// @brief 本进程函数级条目的未命中次数
+    std::atomic<uint64_t> functionMisses{0};
+
+    /// @brief 临时文件的序号，与进程号一起保证临时文件名唯一
+    std::atomic<uint64_t> tempIndex{0};
+
+    /// @brief 错误信息
+    std::string lastError;
+};
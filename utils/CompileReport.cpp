@@ -0,0 +1,174 @@
+///
+/// @file CompileReport.cpp
+/// @brief 编译各阶段的时间、内存与对象数目统计，用于--time-report与--mem-report
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "CompileReport.h"
+
+std::atomic<uint64_t> gObjectCounts[(int) CountedObject::MAX] = {};
+
+/// @brief 各类对象在文本表格中的列名
+static const char * const objectColumnNames[(int) CountedObject::MAX] = {"ASTNodes", "Insts", "Uses", "ArmInsts"};
+
+/// @brief 各类对象在JSON中的键名
+static const char * const objectJsonNames[(int) CountedObject::MAX] = {"ast_nodes", "instructions", "uses", "arm_insts"};
+
+long CompileReport::getPeakRssKB()
+{
+#ifndef _WIN32
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return usage.ru_maxrss;
+    }
+#endif
+    return 0;
+}
+
+void CompileReport::begin(const std::string & name)
+{
+    end();
+
+    active = true;
+    currentName = name;
+
+    for (int i = 0; i < (int) CountedObject::MAX; i++) {
+        objectsStart[i] = gObjectCounts[i].load(std::memory_order_relaxed);
+    }
+
+    rssStart = getPeakRssKB();
+    cpuStart = std::clock();
+    wallStart = std::chrono::steady_clock::now();
+}
+
+void CompileReport::end()
+{
+    if (!active) {
+        return;
+    }
+
+    auto wallEnd = std::chrono::steady_clock::now();
+    std::clock_t cpuEnd = std::clock();
+
+    PhaseStat stat;
+    stat.name = currentName;
+    stat.wallSeconds = std::chrono::duration<double>(wallEnd - wallStart).count();
+    stat.cpuSeconds = (double) (cpuEnd - cpuStart) / CLOCKS_PER_SEC;
+    stat.peakRssDeltaKB = getPeakRssKB() - rssStart;
+
+    for (int i = 0; i < (int) CountedObject::MAX; i++) {
+        stat.objects[i] = gObjectCounts[i].load(std::memory_order_relaxed) - objectsStart[i];
+    }
+
+    phases.push_back(stat);
+
+    active = false;
+}
+
+void CompileReport::print(FILE * fp, bool showTime, bool showMem, bool json)
+{
+    end();
+
+    // 合计
+    PhaseStat total;
+    total.name = "total";
+    for (auto & stat: phases) {
+        total.wallSeconds += stat.wallSeconds;
+        total.cpuSeconds += stat.cpuSeconds;
+        total.peakRssDeltaKB += stat.peakRssDeltaKB;
+        for (int i = 0; i < (int) CountedObject::MAX; i++) {
+            total.objects[i] += stat.objects[i];
+        }
+    }
+
+    long peakRss = getPeakRssKB();
+
+    if (json) {
+
+        // 阶段名都是固定的标识符，不需要转义
+        auto printStat = [&](const PhaseStat & stat) {
+            fprintf(fp, "{\"name\": \"%s\"", stat.name.c_str());
+            if (showTime) {
+                fprintf(fp, ", \"wall_seconds\": %.6f, \"cpu_seconds\": %.6f", stat.wallSeconds, stat.cpuSeconds);
+            }
+            if (showMem) {
+                fprintf(fp, ", \"peak_rss_delta_kb\": %ld", stat.peakRssDeltaKB);
+                for (int i = 0; i < (int) CountedObject::MAX; i++) {
+                    fprintf(fp, ", \"%s\": %llu", objectJsonNames[i], (unsigned long long) stat.objects[i]);
+                }
+            }
+            fprintf(fp, "}");
+        };
+
+        fprintf(fp, "{\n  \"phases\": [");
+        for (size_t k = 0; k < phases.size(); k++) {
+            fprintf(fp, k == 0 ? "\n    " : ",\n    ");
+            printStat(phases[k]);
+        }
+        fprintf(fp, "\n  ],\n  \"total\": ");
+        printStat(total);
+        if (showMem) {
+            fprintf(fp, ",\n  \"peak_rss_kb\": %ld", peakRss);
+        }
+        fprintf(fp, "\n}\n");
+
+        return;
+    }
+
+    fprintf(fp, "===---------------------------------------------------------===\n");
+    fprintf(fp, "                  Compilation phase report\n");
+    fprintf(fp, "===---------------------------------------------------------===\n");
+    if (showTime) {
+        fprintf(fp, "  Total Wall Time: %.6f seconds, CPU Time: %.6f seconds\n", total.wallSeconds, total.cpuSeconds);
+    }
+    if (showMem) {
+        fprintf(fp, "  Peak RSS: %ld KB\n", peakRss);
+    }
+    fprintf(fp, "\n");
+
+    // 表头
+    fprintf(fp, "  %-12s", "Phase");
+    if (showTime) {
+        fprintf(fp, " %12s %8s %12s", "Wall(s)", "Wall(%)", "CPU(s)");
+    }
+    if (showMem) {
+        fprintf(fp, " %14s", "PeakRSS+(KB)");
+        for (int i = 0; i < (int) CountedObject::MAX; i++) {
+            fprintf(fp, " %10s", objectColumnNames[i]);
+        }
+    }
+    fprintf(fp, "\n");
+
+    auto printRow = [&](const PhaseStat & stat) {
+        fprintf(fp, "  %-12s", stat.name.c_str());
+        if (showTime) {
+            double percent = total.wallSeconds > 0 ? stat.wallSeconds * 100.0 / total.wallSeconds : 0.0;
+            fprintf(fp, " %12.6f %7.1f%% %12.6f", stat.wallSeconds, percent, stat.cpuSeconds);
+        }
+        if (showMem) {
+            fprintf(fp, " %14ld", stat.peakRssDeltaKB);
+            for (int i = 0; i < (int) CountedObject::MAX; i++) {
+                fprintf(fp, " %10llu", (unsigned long long) stat.objects[i]);
+            }
+        }
+        fprintf(fp, "\n");
+    };
+
+    for (auto & stat: phases) {
+        printRow(stat);
+    }
+
+    printRow(total);
+}
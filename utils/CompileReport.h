@@ -0,0 +1,134 @@
+///
+/// @file CompileReport.h
+/// @brief 编译各阶段的时间、内存与对象数目统计，用于--time-report与--mem-report
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+
+///
+/// @brief 统计创建数目的对象类别
+///
+enum class CountedObject : int {
+
+    /// @brief 抽象语法树节点ast_node
+    AST_NODE,
+
+    /// @brief 线性IR指令Instruction
+    INSTRUCTION,
+
+    /// @brief 线性IR的Define-Use边Use
+    USE,
+
+    /// @brief ARM32汇编指令ArmInst
+    ARM_INST,
+
+    /// @brief 类别数目
+    MAX
+};
+
+/// @brief 各类对象累计创建的数目，下标为CountedObject
+extern std::atomic<uint64_t> gObjectCounts[(int) CountedObject::MAX];
+
+///
+/// @brief 对象创建时计数，在对象的构造处调用。后端并行时多个线程同时计数，只要求原子性，不要求顺序
+/// @param kind 对象类别
+///
+inline void countObject(CountedObject kind)
+{
+    gObjectCounts[(int) kind].fetch_add(1, std::memory_order_relaxed);
+}
+
+///
+/// @brief 编译的阶段统计。编译过程依次划分为前端、IR产生、优化、代码生成等阶段，
+/// 每个阶段记录墙上时间、进程的CPU时间、驻留内存峰值的增长以及各类对象的创建数目。
+/// CPU时间是进程所有线程的合计，后端并行时会大于墙上时间
+///
+class CompileReport {
+
+public:
+    ///
+    /// @brief 一个阶段的统计结果
+    ///
+    struct PhaseStat {
+
+        /// @brief 阶段名
+        std::string name;
+
+        /// @brief 墙上时间，单位秒
+        double wallSeconds = 0;
+
+        /// @brief CPU时间，单位秒
+        double cpuSeconds = 0;
+
+        /// @brief 驻留内存峰值的增长，单位KB
+        long peakRssDeltaKB = 0;
+
+        /// @brief 阶段内各类对象的创建数目
+        uint64_t objects[(int) CountedObject::MAX] = {};
+    };
+
+    ///
+    /// @brief 开始一个阶段，若上一个阶段还没有结束则先结束
+    /// @param name 阶段名
+    ///
+    void begin(const std::string & name);
+
+    ///
+    /// @brief 结束当前阶段，没有进行中的阶段时不做任何事。出错提前结束编译时也可调用
+    ///
+    void end();
+
+    ///
+    /// @brief 输出统计结果
+    /// @param fp 输出文件
+    /// @param showTime 是否输出时间
+    /// @param showMem 是否输出内存与对象数目
+    /// @param json true输出JSON，false输出文本表格
+    ///
+    void print(FILE * fp, bool showTime, bool showMem, bool json);
+
+    ///
+    /// @brief 获取当前进程的驻留内存峰值，单位KB，不支持的平台返回0
+    /// @return long 内存峰值
+    ///
+    static long getPeakRssKB();
+
+private:
+    /// @brief 已结束的阶段
+    std::vector<PhaseStat> phases;
+
+    /// @brief 是否有进行中的阶段
+    bool active = false;
+
+    /// @brief 进行中阶段的名字
+    std::string currentName;
+
+    /// @brief 进行中阶段开始时的墙上时间
+    std::chrono::steady_clock::time_point wallStart;
+
+    /// @brief 进行中阶段开始时的CPU时间
+    std::clock_t cpuStart = 0;
+
+    /// @brief 进行中阶段开始时的内存峰值
+    long rssStart = 0;
+
+    /// @brief 进行中阶段开始时的各类对象数目
+    uint64_t objectsStart[(int) CountedObject::MAX] = {};
+};
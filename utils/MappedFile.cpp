@@ -0,0 +1,128 @@
+///
+/// @file MappedFile.cpp
+/// @brief 以内存映射方式只读打开源文件，供词法分析直接在内存上扫描
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+///
+/// @brief 映射文件，之前映射的文件先解除映射
+/// @param filename 文件名
+/// @param padding 内容之后保证为0的字节数
+/// @return true 成功
+/// @return false 失败，错误信息通过getLastError获取
+///
+bool MappedFile::open(const std::string & filename, size_t padding)
+{
+    close();
+
+#ifdef _WIN32
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    if (!in) {
+        lastError = "文件(" + filename + ")打开失败";
+        return false;
+    }
+
+    fileSize = (size_t) in.tellg();
+    in.seekg(0);
+
+    content.assign(fileSize + padding, 0);
+    in.read(content.data(), (std::streamsize) fileSize);
+
+    base = content.data();
+    mappedSize = content.size();
+
+    return true;
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        lastError = "文件(" + filename + ")打开失败";
+        return false;
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        lastError = "文件(" + filename + ")状态获取失败";
+        return false;
+    }
+
+    size_t size = (size_t) st.st_size;
+    size_t total = size + padding;
+    if (total == 0) {
+        // 长度为0的映射不合法，空文件且不需要padding时只需一个合法的地址
+        total = 1;
+    }
+
+    // 先保留足够的匿名页面，再把文件映射到其开头。文件末尾所在页的剩余部分以及之后的匿名页都是0，
+    // 从而在文件长度恰好是页大小的整数倍时，访问padding也不会越过文件末尾而出错
+    void * addr = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+        ::close(fd);
+        lastError = "文件(" + filename + ")映射失败";
+        return false;
+    }
+
+    if (size > 0) {
+        void * fileAddr = mmap(addr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+        if (fileAddr == MAP_FAILED) {
+            munmap(addr, total);
+            ::close(fd);
+            lastError = "文件(" + filename + ")映射失败";
+            return false;
+        }
+    }
+
+    ::close(fd);
+
+    base = static_cast<char *>(addr);
+    fileSize = size;
+    mappedSize = total;
+
+    return true;
+#endif
+}
+
+///
+/// @brief 解除映射
+///
+void MappedFile::close()
+{
+    if (base == nullptr) {
+        return;
+    }
+
+#ifdef _WIN32
+    content.clear();
+    content.shrink_to_fit();
+#else
+    munmap(base, mappedSize);
+#endif
+
+    base = nullptr;
+    fileSize = 0;
+    mappedSize = 0;
+}
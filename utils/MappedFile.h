@@ -0,0 +1,90 @@
+///
+/// @file MappedFile.h
+/// @brief 以内存映射方式只读打开源文件，供词法分析直接在内存上扫描
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///
+/// @brief 映射到内存的文件。
+/// 映射为私有的写时复制页面，内容之后保证有指定字节数的0，
+/// 因此flex的yy_scan_buffer可直接在其上扫描(会临时改写记号末尾的字符)，
+/// 手写的词法分析器也可以用0作为结束哨兵。文件在对象析构时解除映射
+///
+class MappedFile {
+
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    ///
+    /// @brief 映射文件，之前映射的文件先解除映射
+    /// @param filename 文件名
+    /// @param padding 内容之后保证为0的字节数
+    /// @return true 成功
+    /// @return false 失败，错误信息通过getLastError获取
+    ///
+    bool open(const std::string & filename, size_t padding = 0);
+
+    ///
+    /// @brief 解除映射
+    ///
+    void close();
+
+    ///
+    /// @brief 文件内容的起始地址，内容之后有padding个0
+    /// @return char*
+    ///
+    char * data()
+    {
+        return base;
+    }
+
+    ///
+    /// @brief 文件内容的字节数，不含padding
+    /// @return size_t
+    ///
+    [[nodiscard]] size_t size() const
+    {
+        return fileSize;
+    }
+
+    std::string getLastError() const
+    {
+        return lastError;
+    }
+
+private:
+    /// @brief 内容的起始地址
+    char * base = nullptr;
+
+    /// @brief 文件的字节数
+    size_t fileSize = 0;
+
+    /// @brief 映射的总字节数，含padding
+    size_t mappedSize = 0;
+
+#ifdef _WIN32
+    /// @brief 不支持mmap的平台上读入的文件内容
+    std::vector<char> content;
+#endif
+
+    /// @brief 错误信息
+    std::string lastError;
+};
@@ -0,0 +1,156 @@
+///
+/// @file OutputBuffer.cpp
+/// @brief 汇编与线性IR输出用的写缓冲区，可输出到文件、标准输出或内存
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <charconv>
+#include <cstdarg>
+#include <cstring>
+
+#include "OutputBuffer.h"
+
+/// @brief 内存目标第一次扩容时的最小字节数
+static constexpr size_t MEMORY_INITIAL_SIZE = 4096;
+
+/// @brief 64位整数格式化后的最大字节数
+static constexpr size_t MAX_INT_CHARS = 24;
+
+OutputBuffer::OutputBuffer(FILE * _file) : file(_file), storage(new char[FILE_BUFFER_SIZE])
+{
+    begin = storage.get();
+    cur = begin;
+    end = begin + FILE_BUFFER_SIZE;
+}
+
+OutputBuffer::OutputBuffer(std::string & _memory) : memory(&_memory)
+{
+    // 可写区域为空，第一次写入时扩容
+    begin = memory->data() + memory->size();
+    cur = begin;
+    end = begin;
+}
+
+OutputBuffer::~OutputBuffer()
+{
+    flush();
+}
+
+void OutputBuffer::flush()
+{
+    if (file) {
+        if (cur != begin) {
+            fwrite(begin, 1, (size_t) (cur - begin), file);
+        }
+
+        cur = begin;
+    } else {
+        // 截去字符串尾部未写的部分
+        memory->resize((size_t) (cur - memory->data()));
+
+        begin = memory->data() + memory->size();
+        cur = begin;
+        end = begin;
+    }
+}
+
+void OutputBuffer::grow(size_t n)
+{
+    if (file) {
+        // 调用者保证n不超过缓冲区的大小
+        flush();
+        return;
+    }
+
+    size_t used = (size_t) (cur - memory->data());
+    size_t newSize = std::max({memory->size() * 2, used + n, MEMORY_INITIAL_SIZE});
+
+    memory->resize(newSize);
+
+    begin = memory->data();
+    cur = begin + used;
+    end = begin + memory->size();
+}
+
+OutputBuffer & OutputBuffer::put(std::string_view s)
+{
+    size_t n = s.size();
+
+    if ((size_t) (end - cur) < n) {
+
+        if (file && n >= FILE_BUFFER_SIZE / 2) {
+            // 大块内容不经过缓冲区，直接写出
+            flush();
+            fwrite(s.data(), 1, n, file);
+            return *this;
+        }
+
+        grow(n);
+    }
+
+    memcpy(cur, s.data(), n);
+    cur += n;
+
+    return *this;
+}
+
+OutputBuffer & OutputBuffer::putInt(int64_t v)
+{
+    if ((size_t) (end - cur) < MAX_INT_CHARS) {
+        grow(MAX_INT_CHARS);
+    }
+
+    cur = std::to_chars(cur, end, v).ptr;
+
+    return *this;
+}
+
+OutputBuffer & OutputBuffer::putUInt(uint64_t v)
+{
+    if ((size_t) (end - cur) < MAX_INT_CHARS) {
+        grow(MAX_INT_CHARS);
+    }
+
+    cur = std::to_chars(cur, end, v).ptr;
+
+    return *this;
+}
+
+OutputBuffer & OutputBuffer::format(const char * fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+
+    va_list retry;
+    va_copy(retry, ap);
+
+    // vsnprintf要写入结尾的'\0'，可写的空间需多留一个字节
+    size_t room = (size_t) (end - cur);
+    int len = vsnprintf(cur, room, fmt, ap);
+
+    if (len >= 0) {
+        if ((size_t) len >= room) {
+            // 空间不够，扩容后重新格式化
+            std::string text((size_t) len + 1, '\0');
+            vsnprintf(text.data(), text.size(), fmt, retry);
+            text.pop_back();
+            put(text);
+        } else {
+            cur += len;
+        }
+    }
+
+    va_end(retry);
+    va_end(ap);
+
+    return *this;
+}
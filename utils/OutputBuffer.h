@@ -0,0 +1,123 @@
+///
+/// @file OutputBuffer.h
+/// @brief 汇编与线性IR输出用的写缓冲区，可输出到文件、标准输出或内存
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+
+///
+/// @brief 输出缓冲区。内容先写入缓冲区，满了或flush时一次写到目标，避免每条指令产生临时字符串。
+/// 目标为文件(含stdout)时，缓冲区是固定大小的数组，满了以后用fwrite写出，之后反复使用；
+/// 目标为内存时，直接写入目标字符串的尾部，字符串按倍数扩容，析构或flush时截去未用部分。
+/// 整数用std::to_chars直接格式化到缓冲区中。一个缓冲区只能在一个线程中使用
+///
+class OutputBuffer {
+
+public:
+    /// @brief 文件目标时缓冲区的字节数
+    static constexpr size_t FILE_BUFFER_SIZE = 64 * 1024;
+
+    ///
+    /// @brief 构造函数，输出到文件
+    /// @param _file 文件，可以是stdout，不负责关闭
+    ///
+    explicit OutputBuffer(FILE * _file);
+
+    ///
+    /// @brief 构造函数，输出追加到内存中的字符串
+    /// @param _memory 目标字符串，需在缓冲区使用期间有效
+    ///
+    explicit OutputBuffer(std::string & _memory);
+
+    ///
+    /// @brief 析构函数，写出剩余内容
+    ///
+    ~OutputBuffer();
+
+    OutputBuffer(const OutputBuffer &) = delete;
+    OutputBuffer & operator=(const OutputBuffer &) = delete;
+
+    ///
+    /// @brief 输出一个字符
+    /// @param c 字符
+    ///
+    OutputBuffer & put(char c)
+    {
+        if (cur == end) {
+            grow(1);
+        }
+
+        *cur++ = c;
+
+        return *this;
+    }
+
+    ///
+    /// @brief 输出字符串
+    /// @param s 字符串
+    ///
+    OutputBuffer & put(std::string_view s);
+
+    ///
+    /// @brief 输出有符号整数
+    /// @param v 整数
+    ///
+    OutputBuffer & putInt(int64_t v);
+
+    ///
+    /// @brief 输出无符号整数
+    /// @param v 整数
+    ///
+    OutputBuffer & putUInt(uint64_t v);
+
+    ///
+    /// @brief 按printf的格式输出，用于不常用的输出
+    /// @param fmt 格式化字符串
+    ///
+    OutputBuffer & format(const char * fmt, ...) __attribute__((format(printf, 2, 3)));
+
+    ///
+    /// @brief 把缓冲区中的内容写到目标
+    ///
+    void flush();
+
+private:
+    ///
+    /// @brief 保证缓冲区至少还有n个字节的空间
+    /// @param n 字节数
+    ///
+    void grow(size_t n);
+
+    /// @brief 文件目标，内存目标时为空
+    FILE * file = nullptr;
+
+    /// @brief 内存目标，文件目标时为空
+    std::string * memory = nullptr;
+
+    /// @brief 文件目标时的缓冲区
+    std::unique_ptr<char[]> storage;
+
+    /// @brief 可写区域的开始，文件目标时为storage，内存目标时为字符串中已写内容之后的位置
+    char * begin = nullptr;
+
+    /// @brief 下一个写入的位置
+    char * cur = nullptr;
+
+    /// @brief 可写区域的结束
+    char * end = nullptr;
+};
@@ -0,0 +1,65 @@
+///
+/// @file Sha256.h
+/// @brief SHA-256散列，用于编译缓存的内容寻址
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+///
+/// @brief 增量计算的SHA-256散列。缓存的键由源文件内容与选项决定，
+/// 需要抗碰撞，不同的输入得到相同的键会取到错误的输出，因此不用FNV等简单散列
+///
+class Sha256 {
+
+public:
+    Sha256();
+
+    ///
+    /// @brief 追加要散列的内容
+    /// @param data 内容
+    /// @param size 字节数
+    ///
+    void update(const void * data, size_t size);
+
+    ///
+    /// @brief 追加字符串，先追加长度，避免相邻的两个字符串拼接后产生歧义
+    /// @param str 字符串
+    ///
+    void updateField(std::string_view str);
+
+    ///
+    /// @brief 结束计算，得到十六进制表示的散列值，之后不能再追加
+    /// @return std::string 64个十六进制字符
+    ///
+    std::string hexDigest();
+
+private:
+    ///
+    /// @brief 处理一个64字节的块
+    /// @param block 块
+    ///
+    void transform(const uint8_t * block);
+
+    /// @brief 散列状态
+    uint32_t state[8];
+
+    /// @brief 未满一块的内容
+    uint8_t buffer[64];
+
+    /// @brief 已追加的字节数
+    uint64_t length = 0;
+};
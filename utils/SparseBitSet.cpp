@@ -0,0 +1,212 @@
+///
+/// @file SparseBitSet.cpp
+/// @brief 只保存非空字的稀疏位集合
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include <algorithm>
+
+#include "SparseBitSet.h"
+
+std::vector<SparseBitSet::Element>::iterator SparseBitSet::lowerBound(uint32_t index)
+{
+    return std::lower_bound(elements.begin(), elements.end(), index, [](const Element & element, uint32_t key) {
+        return element.index < key;
+    });
+}
+
+void SparseBitSet::set(uint32_t n)
+{
+    uint32_t index = n / WORD_BITS;
+    Word mask = (Word) 1 << (n % WORD_BITS);
+
+    auto iter = lowerBound(index);
+    if ((iter != elements.end()) && (iter->index == index)) {
+        iter->bits |= mask;
+    } else {
+        elements.insert(iter, Element{index, mask});
+    }
+}
+
+void SparseBitSet::reset(uint32_t n)
+{
+    uint32_t index = n / WORD_BITS;
+
+    auto iter = lowerBound(index);
+    if ((iter != elements.end()) && (iter->index == index)) {
+        iter->bits &= ~((Word) 1 << (n % WORD_BITS));
+
+        // 不保存全0的字
+        if (!iter->bits) {
+            elements.erase(iter);
+        }
+    }
+}
+
+bool SparseBitSet::test(uint32_t n) const
+{
+    uint32_t index = n / WORD_BITS;
+
+    auto iter = std::lower_bound(elements.begin(), elements.end(), index, [](const Element & element, uint32_t key) {
+        return element.index < key;
+    });
+
+    return (iter != elements.end()) && (iter->index == index) && ((iter->bits >> (n % WORD_BITS)) & 1);
+}
+
+uint32_t SparseBitSet::count() const
+{
+    uint32_t total = 0;
+    for (auto & element: elements) {
+        total += popCount64(element.bits);
+    }
+
+    return total;
+}
+
+bool SparseBitSet::unionWith(const SparseBitSet & val)
+{
+    if (val.elements.empty()) {
+        return false;
+    }
+
+    std::vector<Element> result;
+    result.reserve(elements.size() + val.elements.size());
+
+    bool changed = false;
+    auto a = elements.begin();
+    auto b = val.elements.begin();
+
+    while ((a != elements.end()) || (b != val.elements.end())) {
+        if ((b == val.elements.end()) || ((a != elements.end()) && (a->index < b->index))) {
+            result.push_back(*a++);
+        } else if ((a == elements.end()) || (b->index < a->index)) {
+            result.push_back(*b++);
+            changed = true;
+        } else {
+            Word bits = a->bits | b->bits;
+            changed |= (bits != a->bits);
+            result.push_back(Element{a->index, bits});
+            ++a;
+            ++b;
+        }
+    }
+
+    elements.swap(result);
+
+    return changed;
+}
+
+bool SparseBitSet::intersectWith(const SparseBitSet & val)
+{
+    size_t size = 0;
+    bool changed = false;
+    auto b = val.elements.begin();
+
+    // 结果不多于原来的字，原地压缩
+    for (auto & element: elements) {
+
+        while ((b != val.elements.end()) && (b->index < element.index)) {
+            ++b;
+        }
+
+        Word bits = ((b != val.elements.end()) && (b->index == element.index)) ? (element.bits & b->bits) : 0;
+        changed |= (bits != element.bits);
+
+        if (bits) {
+            elements[size++] = Element{element.index, bits};
+        }
+    }
+
+    elements.resize(size);
+
+    return changed;
+}
+
+bool SparseBitSet::subtract(const SparseBitSet & val)
+{
+    size_t size = 0;
+    bool changed = false;
+    auto b = val.elements.begin();
+
+    for (auto & element: elements) {
+
+        while ((b != val.elements.end()) && (b->index < element.index)) {
+            ++b;
+        }
+
+        Word bits = element.bits;
+        if ((b != val.elements.end()) && (b->index == element.index)) {
+            bits &= ~b->bits;
+        }
+        changed |= (bits != element.bits);
+
+        if (bits) {
+            elements[size++] = Element{element.index, bits};
+        }
+    }
+
+    elements.resize(size);
+
+    return changed;
+}
+
+bool SparseBitSet::intersects(const SparseBitSet & val) const
+{
+    auto a = elements.begin();
+    auto b = val.elements.begin();
+
+    while ((a != elements.end()) && (b != val.elements.end())) {
+        if (a->index < b->index) {
+            ++a;
+        } else if (b->index < a->index) {
+            ++b;
+        } else {
+            if (a->bits & b->bits) {
+                return true;
+            }
+            ++a;
+            ++b;
+        }
+    }
+
+    return false;
+}
+
+bool SparseBitSet::operator==(const SparseBitSet & val) const
+{
+    return elements == val.elements;
+}
+
+BitSet SparseBitSet::toBitSet(uint32_t size) const
+{
+    BitSet ret(size);
+
+    forEach([&ret, size](uint32_t n) {
+        if (n < size) {
+            ret.set(n);
+        }
+    });
+
+    return ret;
+}
+
+std::string SparseBitSet::toString() const
+{
+    std::string str;
+
+    forEach([&str](uint32_t n) {
+        str += std::to_string(n);
+        str += ' ';
+    });
+
+    return str;
+}
@@ -0,0 +1,179 @@
+///
+/// @file SparseBitSet.h
+/// @brief 只保存非空字的稀疏位集合
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "BitSet.h"
+
+///
+/// @brief 稀疏位集合。元素范围很大而元素很少时使用，如按指令编号的集合。
+/// 按字序号有序地保存非0的64位字，并、交、差运算为有序数组的归并，不需要逐个元素分配结点
+///
+class SparseBitSet {
+
+public:
+    /// @brief 存储的字
+    using Word = BitSet::Word;
+
+    /// @brief 每个字的位数
+    static constexpr uint32_t WORD_BITS = BitSet::WORD_BITS;
+
+    ///
+    /// @brief 加入元素
+    /// @param n 元素
+    ///
+    void set(uint32_t n);
+
+    ///
+    /// @brief 删除元素
+    /// @param n 元素
+    ///
+    void reset(uint32_t n);
+
+    ///
+    /// @brief 元素是否在集合中
+    /// @param n 元素
+    /// @return true 在
+    ///
+    [[nodiscard]] bool test(uint32_t n) const;
+
+    ///
+    /// @brief 设置为空集
+    ///
+    void clear()
+    {
+        elements.clear();
+    }
+
+    ///
+    /// @brief 元素个数
+    /// @return uint32_t 元素个数
+    ///
+    [[nodiscard]] uint32_t count() const;
+
+    ///
+    /// @brief 是否为空集，不保存全0的字，因此没有字即为空集
+    /// @return true 空集
+    ///
+    [[nodiscard]] bool empty() const
+    {
+        return elements.empty();
+    }
+
+    ///
+    /// @brief 按从小到大的次序访问每个元素
+    /// @param fn 访问函数，参数为元素
+    ///
+    template <typename Fn>
+    void forEach(Fn fn) const
+    {
+        for (auto & element: elements) {
+            Word word = element.bits;
+            while (word) {
+                fn(element.index * WORD_BITS + countTrailingZeros64(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+    ///
+    /// @brief 并集
+    /// @param val 参与运算的集合
+    /// @return true 集合发生了改变
+    ///
+    bool unionWith(const SparseBitSet & val);
+
+    ///
+    /// @brief 交集
+    /// @param val 参与运算的集合
+    /// @return true 集合发生了改变
+    ///
+    bool intersectWith(const SparseBitSet & val);
+
+    ///
+    /// @brief 差集
+    /// @param val 参与运算的集合
+    /// @return true 集合发生了改变
+    ///
+    bool subtract(const SparseBitSet & val);
+
+    ///
+    /// @brief 是否有公共元素
+    /// @param val 参与比较的集合
+    /// @return true 有
+    ///
+    [[nodiscard]] bool intersects(const SparseBitSet & val) const;
+
+    ///
+    /// @brief 比较运算（等于）
+    /// @param val 参与运算的集合
+    /// @return bool 等于为真，否则为假
+    ///
+    bool operator==(const SparseBitSet & val) const;
+
+    ///
+    /// @brief 比较运算（不等于）
+    /// @param val 参与运算的集合
+    /// @return bool 不等为真，否则为假
+    ///
+    bool operator!=(const SparseBitSet & val) const
+    {
+        return !(*this == val);
+    }
+
+    ///
+    /// @brief 转换为稠密位集合
+    /// @param size 稠密位集合的元素范围，需大于最大的元素
+    /// @return BitSet 稠密位集合
+    ///
+    [[nodiscard]] BitSet toBitSet(uint32_t size) const;
+
+    ///
+    /// @brief 变换成字符串显示，元素之间以空格分隔
+    /// @return std::string 字符串
+    ///
+    [[nodiscard]] std::string toString() const;
+
+private:
+    /// @brief 一个非0的字
+    struct Element {
+
+        /// @brief 字序号，对应元素[index * 64, index * 64 + 64)
+        uint32_t index;
+
+        /// @brief 字的内容，不为0
+        Word bits;
+
+        bool operator==(const Element & other) const
+        {
+            return (index == other.index) && (bits == other.bits);
+        }
+    };
+
+    ///
+    /// @brief 查找字序号不小于index的第一个字
+    /// @param index 字序号
+    /// @return std::vector<Element>::iterator 位置
+    ///
+    std::vector<Element>::iterator lowerBound(uint32_t index);
+
+    ///
+    /// @brief 按字序号有序的非0字
+    ///
+    std::vector<Element> elements;
+};
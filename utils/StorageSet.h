@@ -15,16 +15,23 @@
 ///
 #pragma once
 
+#include <mutex>
 #include <unordered_set>
 
+///
+/// @brief 存储集合，相同的对象只保存一份。后端可按函数并行，因此加锁保护
+///
 template <typename T, typename Hasher, typename Equal>
 class StorageSet final {
     std::unordered_set<T, Hasher, Equal> mStorage;
 
+    std::mutex mMutex;
+
 public:
     template <typename... Args>
     const T * get(Args &&... args)
     {
+        std::lock_guard<std::mutex> lock(mMutex);
         return &*mStorage.emplace(std::forward<Args>(args)...).first;
     }
 };
@@ -0,0 +1,190 @@
+///
+/// @file ThreadPool.cpp
+/// @brief 固定线程数、任务可窃取的线程池
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#include "ThreadPool.h"
+
+/// @brief 当前线程所属的线程池，非工作线程为空
+static thread_local ThreadPool * currentPool = nullptr;
+
+/// @brief 当前线程在线程池中的编号
+static thread_local int32_t currentIndex = -1;
+
+///
+/// @brief 构造函数
+/// @param threads 线程数，0表示取硬件的并发数
+///
+ThreadPool::ThreadPool(int32_t threads)
+{
+    if (threads <= 0) {
+        threads = hardwareConcurrency();
+    }
+
+    if (threads > 1) {
+
+        for (int32_t k = 0; k < threads; ++k) {
+            queues.push_back(std::make_unique<WorkQueue>());
+        }
+
+        for (int32_t k = 0; k < threads; ++k) {
+            workers.emplace_back(&ThreadPool::workerLoop, this, k);
+        }
+    }
+}
+
+///
+/// @brief 析构函数，等待所有任务完成后结束线程
+///
+ThreadPool::~ThreadPool()
+{
+    wait();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    taskReady.notify_all();
+
+    for (auto & worker: workers) {
+        worker.join();
+    }
+}
+
+///
+/// @brief 获取硬件的并发数，无法获取时为1
+/// @return int32_t 并发数
+///
+int32_t ThreadPool::hardwareConcurrency()
+{
+    unsigned count = std::thread::hardware_concurrency();
+
+    return count > 0 ? (int32_t) count : 1;
+}
+
+///
+/// @brief 提交任务
+/// @param task 任务
+///
+void ThreadPool::submit(std::function<void()> task)
+{
+    if (workers.empty()) {
+        task();
+        return;
+    }
+
+    // 任务中提交的子任务放入本线程的队列，外部提交的轮流放入各队列
+    size_t index;
+    if (currentPool == this) {
+        index = (size_t) currentIndex;
+    } else {
+        index = nextQueue++ % queues.size();
+    }
+
+    pending++;
+
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+
+    {
+        // 在锁内修改，避免工作线程检查条件后、休眠前的唤醒丢失
+        std::lock_guard<std::mutex> lock(mutex);
+        queued++;
+    }
+
+    taskReady.notify_one();
+}
+
+///
+/// @brief 等待已提交的任务全部完成，不能在任务中调用
+///
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    allDone.wait(lock, [this]() { return pending == 0; });
+}
+
+///
+/// @brief 取一个任务：先从自己队列的尾部取，再从其它队列的头部窃取
+/// @param index 工作线程的编号
+/// @param task 取到的任务
+/// @return true 取到
+///
+bool ThreadPool::takeTask(int32_t index, std::function<void()> & task)
+{
+    size_t count = queues.size();
+
+    for (size_t k = 0; k < count; ++k) {
+
+        WorkQueue & queue = *queues[(index + k) % count];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+
+        if (k == 0) {
+            // 自己的队列，后进先出，子任务的数据多半还在缓存中
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            // 窃取，先进先出，取走最早提交的任务
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            steals++;
+        }
+
+        queued--;
+
+        return true;
+    }
+
+    return false;
+}
+
+///
+/// @brief 工作线程的主循环
+/// @param index 工作线程的编号
+///
+void ThreadPool::workerLoop(int32_t index)
+{
+    currentPool = this;
+    currentIndex = index;
+
+    for (;;) {
+
+        std::function<void()> task;
+
+        if (!takeTask(index, task)) {
+
+            std::unique_lock<std::mutex> lock(mutex);
+            taskReady.wait(lock, [this]() { return stopping || (queued > 0); });
+
+            if (stopping && (queued == 0)) {
+                // 结束且没有剩余任务
+                return;
+            }
+
+            continue;
+        }
+
+        task();
+
+        if (--pending == 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+            allDone.notify_all();
+        }
+    }
+}
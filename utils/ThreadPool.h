@@ -0,0 +1,141 @@
+///
+/// @file ThreadPool.h
+/// @brief 固定线程数、任务可窃取的线程池
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2026
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>新建
+/// </table>
+///
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///
+/// @brief 固定线程数的线程池，采用任务窃取调度。
+/// 每个工作线程有各自的任务队列：外部提交的任务轮流放入各队列，任务中提交的子任务放入本线程的队列；
+/// 工作线程从自己队列的尾部取任务，自己的队列为空时从其它队列的头部窃取，耗时不均的任务也能均衡到各线程。
+/// 线程数不大于1时不创建线程，任务在submit中直接执行，便于调试以及保证单线程时的行为不变
+///
+class ThreadPool {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param threads 线程数，0表示取硬件的并发数
+    ///
+    explicit ThreadPool(int32_t threads);
+
+    ///
+    /// @brief 析构函数，等待所有任务完成后结束线程
+    ///
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    ///
+    /// @brief 提交任务
+    /// @param task 任务
+    ///
+    void submit(std::function<void()> task);
+
+    ///
+    /// @brief 等待已提交的任务全部完成，不能在任务中调用
+    ///
+    void wait();
+
+    ///
+    /// @brief 获取线程数
+    /// @return int32_t 线程数，没有创建线程时为1
+    ///
+    [[nodiscard]] int32_t size() const
+    {
+        return workers.empty() ? 1 : (int32_t) workers.size();
+    }
+
+    ///
+    /// @brief 获取窃取到的任务数，用于观察负载均衡的情况
+    /// @return uint64_t 任务数
+    ///
+    [[nodiscard]] uint64_t getStealCount() const
+    {
+        return steals.load();
+    }
+
+    ///
+    /// @brief 获取硬件的并发数，无法获取时为1
+    /// @return int32_t 并发数
+    ///
+    static int32_t hardwareConcurrency();
+
+private:
+    ///
+    /// @brief 工作线程的任务队列
+    ///
+    struct WorkQueue {
+
+        /// @brief 待执行的任务
+        std::deque<std::function<void()>> tasks;
+
+        /// @brief 保护任务队列
+        std::mutex mutex;
+    };
+
+    ///
+    /// @brief 工作线程的主循环
+    /// @param index 工作线程的编号
+    ///
+    void workerLoop(int32_t index);
+
+    ///
+    /// @brief 取一个任务：先从自己队列的尾部取，再从其它队列的头部窃取
+    /// @param index 工作线程的编号
+    /// @param task 取到的任务
+    /// @return true 取到
+    ///
+    bool takeTask(int32_t index, std::function<void()> & task);
+
+    /// @brief 工作线程
+    std::vector<std::thread> workers;
+
+    /// @brief 各工作线程的任务队列，与workers一一对应
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+
+    /// @brief 外部提交任务时下一个放入的队列
+    std::atomic<uint32_t> nextQueue{0};
+
+    /// @brief 队列中还没有被取走的任务数
+    std::atomic<size_t> queued{0};
+
+    /// @brief 已提交但没有完成的任务数
+    std::atomic<size_t> pending{0};
+
+    /// @brief 窃取到的任务数
+    std::atomic<uint64_t> steals{0};
+
+    /// @brief 与条件变量配合，保护休眠与唤醒
+    std::mutex mutex;
+
+    /// @brief 有新任务或者结束时通知工作线程
+    std::condition_variable taskReady;
+
+    /// @brief 任务全部完成时通知等待者
+    std::condition_variable allDone;
+
+    /// @brief 是否结束
+    bool stopping = false;
+};